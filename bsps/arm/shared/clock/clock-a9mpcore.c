@@ -189,6 +189,28 @@ CPU_Counter_ticks _CPU_Counter_read(void)
   return gt->cntrlower;
 }
 
+#if !defined(RTEMS_SMP) || !defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+static void a9mpcore_clock_set_next_interrupt(uint64_t ns)
+{
+  volatile a9mpcore_gt *gt = A9MPCORE_GT;
+  uint64_t cmpval;
+
+  /*
+   * The comparator is banked per processor.  The auto-increment continues
+   * with the periodic clock interrupt after the next comparator event.
+   */
+  cmpval = a9mpcore_clock_get_counter(gt);
+  cmpval += (ns * a9mpcore_clock_periphclk()) / 1000000000;
+  gt->ctrl &= ~A9MPCORE_GT_CTRL_COMP_EN;
+  gt->cmpvallower = (uint32_t) cmpval;
+  gt->cmpvalupper = (uint32_t) (cmpval >> 32);
+  gt->ctrl |= A9MPCORE_GT_CTRL_COMP_EN;
+}
+
+#define Clock_driver_support_set_next_interrupt(ns) \
+  a9mpcore_clock_set_next_interrupt(ns)
+#endif
+
 #define Clock_driver_support_at_tick(arg) \
   a9mpcore_clock_at_tick(arg)
 
@@ -58,6 +58,12 @@ volatile uint32_t pc386_microseconds_per_isr;
 volatile uint32_t pc386_isrs_per_tick;
 uint32_t pc386_clock_click_count;
 
+/* i8254 interrupts since initialization, used by the i8254 timecounter */
+static volatile uint32_t pc386_clock_isrs;
+
+/* i8254 interrupts until the next clock tick */
+static uint32_t pc386_isrs_until_tick;
+
 /* forward declaration */
 void Clock_isr(void *param);
 static void Clock_isr_handler(void *param);
@@ -73,12 +79,6 @@ static uint64_t pc586_tsc_frequency;
 
 static struct timecounter pc386_tc;
 
-/* this driver may need to count ISRs per tick */
-#define CLOCK_DRIVER_ISRS_PER_TICK       1
-#define CLOCK_DRIVER_ISRS_PER_TICK_VALUE pc386_isrs_per_tick
-
-extern volatile uint32_t Clock_driver_ticks;
-
 #define READ_8254( _lsb, _msb )                               \
   do { outport_byte(TIMER_MODE, TIMER_SEL0|TIMER_LATCH);      \
      inport_byte(TIMER_CNTR0, _lsb);                          \
@@ -121,7 +121,7 @@ static uint32_t pc386_get_timecount_i8254(struct timecounter *tc)
   rtems_interrupt_lock_acquire(&rtems_i386_i8254_access_lock, &lock_context);
 
     READ_8254(lsb, msb);
-    irqs = Clock_driver_ticks;
+    irqs = pc386_clock_isrs;
 
   rtems_interrupt_lock_release(&rtems_i386_i8254_access_lock, &lock_context);
 
@@ -173,6 +173,104 @@ static void calibrate_tsc(void)
 #endif
 }
 
+/*
+ * Start the periodic i8254 interrupt.  The i8254 access lock shall be owned.
+ */
+static void pc386_clock_start_periodic(void)
+{
+  outport_byte(TIMER_MODE, TIMER_SEL0|TIMER_16BIT|TIMER_RATEGEN);
+  outport_byte(TIMER_CNTR0, pc386_clock_click_count >> 0 & 0xff);
+  outport_byte(TIMER_CNTR0, pc386_clock_click_count >> 8 & 0xff);
+}
+
+#if !defined(RTEMS_SMP)
+/*
+ * In the tickless idle and high resolution mode, the next clock interrupt is
+ * programmed through the i8254 in the one-shot mode (interrupt on terminal
+ * count).  The 16-bit counter limits one interval to about 55ms.  Longer
+ * intervals are divided into chunks and the i8254 is re-armed by the clock
+ * interrupt until the interval is done.  The periodic interrupt resumes after
+ * the interval.  This needs the TSC timecounter, since the i8254 timecounter
+ * relies on the periodic interrupt.
+ */
+static bool pc386_clock_one_shot;
+
+/* i8254 counts of the one-shot interval after the current chunk */
+static uint64_t pc386_clock_one_shot_remaining;
+
+/*
+ * Arm the next chunk of the one-shot interval.  The i8254 access lock shall
+ * be owned.
+ */
+static void pc386_clock_arm_one_shot(void)
+{
+  uint32_t count;
+
+  if (pc386_clock_one_shot_remaining > 0xffff) {
+    count = 0xffff;
+  } else if (pc386_clock_one_shot_remaining > 0) {
+    count = (uint32_t) pc386_clock_one_shot_remaining;
+  } else {
+    count = 1;
+  }
+
+  pc386_clock_one_shot_remaining -= count;
+  outport_byte(TIMER_MODE, TIMER_SEL0|TIMER_16BIT|TIMER_INTTC);
+  outport_byte(TIMER_CNTR0, count >> 0 & 0xff);
+  outport_byte(TIMER_CNTR0, count >> 8 & 0xff);
+}
+
+static void pc386_clock_set_next_interrupt(uint64_t ns)
+{
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire(&rtems_i386_i8254_access_lock, &lock_context);
+  pc386_clock_one_shot = true;
+  pc386_clock_one_shot_remaining = (ns * TIMER_TICK) / 1000000000;
+  pc386_clock_arm_one_shot();
+  rtems_interrupt_lock_release(&rtems_i386_i8254_access_lock, &lock_context);
+}
+
+/*
+ * Returns true, if the clock interrupt was for a chunk of the one-shot
+ * interval and the next chunk was armed.  At the end of the interval, the
+ * periodic interrupt resumes and the clock interrupt is a clock tick.
+ */
+static bool pc386_clock_continue_one_shot(void)
+{
+  rtems_interrupt_lock_context lock_context;
+  bool                         next_chunk;
+
+  next_chunk = false;
+  rtems_interrupt_lock_acquire(&rtems_i386_i8254_access_lock, &lock_context);
+
+  if (pc386_clock_one_shot) {
+    if (pc386_clock_one_shot_remaining > 0) {
+      pc386_clock_arm_one_shot();
+      next_chunk = true;
+    } else {
+      pc386_clock_one_shot = false;
+      pc386_clock_start_periodic();
+      pc386_isrs_until_tick = 1;
+    }
+  }
+
+  rtems_interrupt_lock_release(&rtems_i386_i8254_access_lock, &lock_context);
+  return next_chunk;
+}
+
+static bool pc386_clock_can_set_next_interrupt(void)
+{
+  return pc386_tc.tc_get_timecount == pc386_get_timecount_tsc;
+}
+
+#define Clock_driver_support_set_next_interrupt(ns) \
+  pc386_clock_set_next_interrupt(ns)
+
+#define Clock_driver_support_can_set_next_interrupt() \
+  pc386_clock_can_set_next_interrupt()
+#endif
+
 static void clockOn(void)
 {
 
@@ -202,10 +300,10 @@ static void clockOn(void)
     printk( "final timer counts=%d\n", pc386_clock_click_count );
   #endif
 
+  pc386_isrs_until_tick = pc386_isrs_per_tick;
+
   rtems_interrupt_lock_acquire(&rtems_i386_i8254_access_lock, &lock_context);
-  outport_byte(TIMER_MODE, TIMER_SEL0|TIMER_16BIT|TIMER_RATEGEN);
-  outport_byte(TIMER_CNTR0, pc386_clock_click_count >> 0 & 0xff);
-  outport_byte(TIMER_CNTR0, pc386_clock_click_count >> 8 & 0xff);
+  pc386_clock_start_periodic();
   rtems_interrupt_lock_release(&rtems_i386_i8254_access_lock, &lock_context);
 
   bsp_interrupt_vector_enable( BSP_PERIODIC_TIMER );
@@ -214,8 +312,29 @@ static void clockOn(void)
 bool Clock_isr_enabled = false;
 static void Clock_isr_handler(void *param)
 {
-  if ( Clock_isr_enabled )
-    Clock_isr( param );
+  if ( !Clock_isr_enabled ) {
+    return;
+  }
+
+  ++pc386_clock_isrs;
+
+#ifdef Clock_driver_support_set_next_interrupt
+  if ( pc386_clock_continue_one_shot() ) {
+    return;
+  }
+#endif
+
+  /*
+   * If the clock tick interval exceeds the range of the i8254, then the
+   * driver is multiple ISRs per clock tick.
+   */
+  if ( pc386_isrs_until_tick > 1 ) {
+    --pc386_isrs_until_tick;
+    return;
+  }
+
+  pc386_isrs_until_tick = pc386_isrs_per_tick;
+  Clock_isr( param );
 }
 
 void Clock_driver_install_handler(void)
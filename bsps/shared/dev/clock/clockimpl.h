@@ -47,6 +47,7 @@
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/timecounter.h>
 
 /**
  * @defgroup RTEMSDriverClockImpl Clock Driver Implementation
@@ -132,6 +133,388 @@ static void Clock_driver_timecounter_tick( Clock_isr_argument arg )
 }
 #endif
 
+#ifdef Clock_driver_support_set_next_interrupt
+#if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+#error "Tickless idle PLUS Fast Idle or n ISRs per tick is not supported"
+#endif
+
+#if defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER) || \
+  (defined(RTEMS_SMP) && defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR))
+#error "Tickless idle needs a timecounter and per-processor clock interrupts"
+#endif
+
+/*
+ * A Clock Driver may define Clock_driver_support_can_set_next_interrupt(), if
+ * the support of Clock_driver_support_set_next_interrupt() depends on the
+ * clock hardware selected during the hardware initialization.
+ */
+#ifndef Clock_driver_support_can_set_next_interrupt
+  #define Clock_driver_support_can_set_next_interrupt() true
+#endif
+
+/**
+ * @brief Tickless idle and high resolution mode state of a processor.
+ *
+ * The members are protected by the watchdog lock of the processor.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the uptime in nanoseconds of the last
+   *   accounted clock tick.
+   */
+  uint64_t base;
+
+  /**
+   * @brief This member contains the count of clock ticks relative to the last
+   *   accounted clock tick at which the next clock interrupt is programmed.
+   */
+  uint64_t next;
+
+  /**
+   * @brief This member contains the uptime in nanoseconds at which the next
+   *   monotonic or realtime watchdog expires in high resolution mode.
+   */
+  uint64_t deadline;
+
+#ifdef RTEMS_SMP
+  /**
+   * @brief This member is true, if the job to reprogram the clock interrupt
+   *   was submitted to the processor and is not yet done.
+   */
+  bool job_pending;
+
+  /**
+   * @brief This member provides the job context to reprogram the clock
+   *   interrupt on behalf of another processor.
+   */
+  Per_CPU_Job_context job_context;
+
+  /**
+   * @brief This member provides the job to reprogram the clock interrupt on
+   *   behalf of another processor.
+   */
+  Per_CPU_Job job;
+#endif
+} Clock_tickless_control;
+
+#ifdef RTEMS_SMP
+static Clock_tickless_control Clock_tickless[ CPU_MAXIMUM_PROCESSORS ];
+#else
+static Clock_tickless_control Clock_tickless[ 1 ];
+#endif
+
+/**
+ * @brief Maximum count of clock ticks which may be skipped.
+ *
+ * The timecounter hardware shall not wrap around between two clock ticks.
+ */
+static uint64_t Clock_tickless_maximum;
+
+/**
+ * @brief This member is true, if the tickless idle or high resolution mode is
+ *   configured and supported by the clock hardware.
+ */
+static bool Clock_tickless_is_available;
+
+static Clock_tickless_control *Clock_tickless_get( const Per_CPU_Control *cpu )
+{
+  return &Clock_tickless[ _Per_CPU_Get_index( cpu ) ];
+}
+
+static uint64_t Clock_tickless_next_tick(
+  const Clock_tickless_control *control
+)
+{
+  return control->base + control->next * _Watchdog_Nanoseconds_per_tick;
+}
+
+static void Clock_tickless_program(
+  Clock_tickless_control *control,
+  uint64_t                now
+)
+{
+  uint64_t next;
+
+  next = Clock_tickless_next_tick( control );
+
+  if ( control->deadline < next ) {
+    next = control->deadline;
+  }
+
+  Clock_driver_support_set_next_interrupt( next > now ? next - now : 0 );
+}
+
+#ifdef RTEMS_SMP
+static void Clock_tickless_job( void *arg )
+{
+  Clock_tickless_control *control;
+  Per_CPU_Control        *cpu;
+  ISR_lock_Context        lock_context;
+
+  control = arg;
+  cpu = _Per_CPU_Get();
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  control->job_pending = false;
+
+  /*
+   * If the processor entered the tickless idle mode again in the meantime,
+   * then the next clock tick accounts for the current watchdogs.
+   */
+  if ( cpu->Watchdog.tickless_exit == NULL ) {
+    control->next = 1;
+  }
+
+  Clock_tickless_program( control, rtems_clock_get_uptime_nanoseconds() );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+static void Clock_tickless_submit_job(
+  Per_CPU_Control        *cpu,
+  Clock_tickless_control *control
+)
+{
+  /* Only the processor itself can program its clock interrupt */
+  if ( !control->job_pending ) {
+    control->job_pending = true;
+    _Per_CPU_Submit_job( cpu, &control->job );
+  }
+}
+#endif
+
+/*
+ * This handler is called with the watchdog lock of the processor acquired
+ * through _Watchdog_Per_CPU_acquire_critical().
+ */
+static void Clock_tickless_exit( Per_CPU_Control *cpu )
+{
+  Clock_tickless_control *control;
+  uint64_t                now;
+  uint64_t                elapsed;
+
+  control = Clock_tickless_get( cpu );
+  now = rtems_clock_get_uptime_nanoseconds();
+  elapsed = 0;
+
+  if ( now > control->base ) {
+    elapsed = ( now - control->base ) / _Watchdog_Nanoseconds_per_tick;
+  }
+
+  /* The programmed clock interrupt accounts for its own clock tick */
+  if ( elapsed >= control->next ) {
+    elapsed = control->next - 1;
+  }
+
+  _Watchdog_Skip_ticks( cpu, elapsed );
+  control->base += elapsed * _Watchdog_Nanoseconds_per_tick;
+  control->next -= elapsed;
+  cpu->Watchdog.tickless_exit = NULL;
+
+#ifdef RTEMS_SMP
+  if ( cpu != _Per_CPU_Get() ) {
+    Clock_tickless_submit_job( cpu, control );
+    return;
+  }
+#endif
+
+  control->next = 1;
+  Clock_tickless_program( control, now );
+}
+
+/*
+ * This handler is called in high resolution mode with the watchdog lock of
+ * the processor acquired if a new first monotonic or realtime watchdog was
+ * inserted.
+ */
+static void Clock_high_resolution_update( Per_CPU_Control *cpu )
+{
+  Clock_tickless_control *control;
+
+  control = Clock_tickless_get( cpu );
+  control->deadline = _Watchdog_Next_clock_expiry( cpu );
+
+#ifdef RTEMS_SMP
+  if ( cpu != _Per_CPU_Get() ) {
+    Clock_tickless_submit_job( cpu, control );
+    return;
+  }
+#endif
+
+  Clock_tickless_program( control, rtems_clock_get_uptime_nanoseconds() );
+}
+
+/*
+ * In high resolution mode, the clock interrupt is also programmed for the
+ * next monotonic or realtime watchdog.  Returns true, if this clock interrupt
+ * was not for a clock tick.  The clock interrupt may occur a bit before the
+ * programmed time due to the resolution of the clock hardware.
+ */
+static bool Clock_high_resolution_at_interrupt( void )
+{
+  Per_CPU_Control        *cpu;
+  Clock_tickless_control *control;
+  ISR_lock_Context        lock_context;
+  uint64_t                now;
+
+  if ( !_Watchdog_High_resolution_timers || !Clock_tickless_is_available ) {
+    return false;
+  }
+
+  cpu = _Per_CPU_Get();
+  control = Clock_tickless_get( cpu );
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  now = rtems_clock_get_uptime_nanoseconds();
+
+  if (
+    now + _Watchdog_Nanoseconds_per_tick / 16 >=
+      Clock_tickless_next_tick( control )
+  ) {
+    _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+    return false;
+  }
+
+  _Watchdog_Tickle_clocks( cpu, &lock_context );
+  control->deadline = _Watchdog_Next_clock_expiry( cpu );
+  Clock_tickless_program( control, rtems_clock_get_uptime_nanoseconds() );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return true;
+}
+
+/*
+ * Account for the clock ticks skipped before the clock tick of this clock
+ * interrupt.
+ */
+static void Clock_tickless_at_tick( void )
+{
+  Per_CPU_Control        *cpu;
+  Clock_tickless_control *control;
+  ISR_lock_Context        lock_context;
+
+  if ( !Clock_tickless_is_available ) {
+    return;
+  }
+
+  cpu = _Per_CPU_Get();
+  control = Clock_tickless_get( cpu );
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  cpu->Watchdog.tickless_exit = NULL;
+  _Watchdog_Skip_ticks( cpu, control->next - 1 );
+  control->base += control->next * _Watchdog_Nanoseconds_per_tick;
+  control->next = 1;
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+/*
+ * Enter the tickless idle mode if the idle thread continues to execute after
+ * the clock tick and the next watchdog expires after the next clock tick.  In
+ * high resolution mode, program the clock interrupt for the next clock tick
+ * or the next monotonic or realtime watchdog, whatever comes first.
+ */
+static void Clock_tickless_enter( void )
+{
+  Per_CPU_Control        *cpu;
+  Clock_tickless_control *control;
+  Thread_Control         *executing;
+  ISR_lock_Context        lock_context;
+  bool                    program;
+
+  if ( !Clock_tickless_is_available ) {
+    return;
+  }
+
+  cpu = _Per_CPU_Get();
+  control = Clock_tickless_get( cpu );
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  program = _Watchdog_High_resolution_timers;
+
+  if ( program ) {
+    control->deadline = _Watchdog_Next_clock_expiry( cpu );
+  }
+
+  executing = cpu->executing;
+
+  if (
+    _Watchdog_Tickless_idle && executing->is_idle && cpu->heir == executing
+  ) {
+    uint64_t ticks;
+
+    ticks = _Watchdog_Ticks_until_next_expiry( cpu, Clock_tickless_maximum );
+
+    if ( ticks > 1 ) {
+      control->next = ticks;
+      cpu->Watchdog.tickless_exit = Clock_tickless_exit;
+      program = true;
+    }
+  }
+
+  if ( program ) {
+    Clock_tickless_program( control, rtems_clock_get_uptime_nanoseconds() );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+static void Clock_tickless_initialize( void )
+{
+  const struct timecounter *tc;
+  uint64_t                  now;
+  uint32_t                  cpu_index;
+
+  Clock_tickless_is_available =
+    ( _Watchdog_Tickless_idle || _Watchdog_High_resolution_timers ) &&
+    Clock_driver_support_can_set_next_interrupt();
+
+  if ( !Clock_tickless_is_available ) {
+    return;
+  }
+
+  tc = _Timecounter;
+  Clock_tickless_maximum =
+    ( (uint64_t) ( tc->tc_counter_mask / 2 ) * 1000000000 /
+      tc->tc_frequency ) / _Watchdog_Nanoseconds_per_tick;
+  now = rtems_clock_get_uptime_nanoseconds();
+
+  for (
+    cpu_index = 0;
+    cpu_index < RTEMS_ARRAY_SIZE( Clock_tickless );
+    ++cpu_index
+  ) {
+    Clock_tickless_control *control;
+
+    control = &Clock_tickless[ cpu_index ];
+    control->base = now;
+    control->next = 1;
+    control->deadline = UINT64_MAX;
+#ifdef RTEMS_SMP
+    control->job_context.handler = Clock_tickless_job;
+    control->job_context.arg = control;
+    control->job.context = &control->job_context;
+#endif
+  }
+
+  if ( _Watchdog_High_resolution_timers ) {
+    uint32_t cpu_max;
+
+    cpu_max = _SMP_Get_processor_maximum();
+
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Per_CPU_Control  *cpu;
+      ISR_lock_Context  lock_context;
+
+      cpu = _Per_CPU_Get_by_index( cpu_index );
+      _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+      cpu->Watchdog.clock_update = Clock_high_resolution_update;
+      _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+    }
+  }
+}
+#else
+#define Clock_high_resolution_at_interrupt() false
+#define Clock_tickless_at_tick() do { } while (0)
+#define Clock_tickless_enter() do { } while (0)
+#define Clock_tickless_initialize() do { } while (0)
+#endif
+
 /**
  * @brief ISRs until next clock tick
  */
@@ -154,7 +537,7 @@ static bool _Clock_Has_watchdogs(const Per_CPU_Control *cpu)
   size_t i;
 
   for (i = 0; i < RTEMS_ARRAY_SIZE(cpu->Watchdog.Header); ++i) {
-    if (_Watchdog_Header_first(&cpu->Watchdog.Header[i]) != NULL) {
+    if (!_Watchdog_Header_is_empty(&cpu->Watchdog.Header[i])) {
       return true;
     }
   }
@@ -234,7 +617,11 @@ void Clock_isr( Clock_isr_argument arg )
       /*
        *  The driver is one ISR per clock tick.
        */
-      Clock_driver_timecounter_tick( arg );
+      if ( !Clock_high_resolution_at_interrupt() ) {
+        Clock_tickless_at_tick();
+        Clock_driver_timecounter_tick( arg );
+        Clock_tickless_enter();
+      }
     #endif
   #endif
 }
@@ -263,6 +650,7 @@ void _Clock_Initialize( void )
    *  Now initialize the hardware that is the source of the tick ISR.
    */
   Clock_driver_support_initialize_hardware();
+  Clock_tickless_initialize();
 
   /*
    *  If we are counting ISRs per tick, then initialize the counter.
@@ -201,6 +201,25 @@ static void leon3_clock_initialize(void)
 #define Clock_driver_support_initialize_hardware() \
   leon3_clock_initialize()
 
+#if !defined(RTEMS_SMP)
+static void leon3_clock_set_next_interrupt(uint64_t ns)
+{
+  gptimer_timer *timer;
+  uint64_t us;
+
+  /*
+   * The timer counts microseconds.  After the next underflow, the timer is
+   * reloaded with the clock tick interval.
+   */
+  timer = &LEON3_Timer_Regs->timer[LEON3_CLOCK_INDEX];
+  us = ns / 1000;
+  grlib_store_32(&timer->tcntval, us > 0 ? (uint32_t) (us - 1) : 0);
+}
+
+#define Clock_driver_support_set_next_interrupt(ns) \
+  leon3_clock_set_next_interrupt(ns)
+#endif
+
 #define Clock_driver_timecounter_tick(arg) leon3_tc_do_tick()
 
 #define BSP_FEATURE_IRQ_EXTENSION
@@ -171,6 +171,46 @@
  */
 #define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE
 
+/* Generated from spec:/acfg/if/bdbuf-io-scheduler */
+
+/**
+ * @brief This configuration option is an initializer define.
+ *
+ * @anchor CONFIGURE_BDBUF_IO_SCHEDULER
+ *
+ * The value of this configuration option defines the I/O scheduler which
+ * orders the writes of modified buffers by the swap-out task.
+ *
+ * @par Default Value
+ * The default value is ``RTEMS_BDBUF_IO_SCHEDULER_SORT``.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be one of
+ * ``RTEMS_BDBUF_IO_SCHEDULER_SORT``, ``RTEMS_BDBUF_IO_SCHEDULER_ELEVATOR``, or
+ * ``RTEMS_BDBUF_IO_SCHEDULER_DEADLINE``.
+ *
+ * @par Notes
+ * @parblock
+ * The ``RTEMS_BDBUF_IO_SCHEDULER_SORT`` scheduler writes the buffers of the
+ * device of the first buffer found with an expired hold time in ascending block
+ * order.
+ *
+ * The ``RTEMS_BDBUF_IO_SCHEDULER_ELEVATOR`` scheduler sweeps each device in a
+ * circular manner, so that a write continues at the block following the
+ * previous write of the device.  Modified buffers adjacent to the buffers due
+ * are merged into the write up to #CONFIGURE_BDBUF_MAX_WRITE_BLOCKS even if
+ * their hold time has not expired yet.  This reduces the number of write
+ * requests for sequential writes spread over time.
+ *
+ * The ``RTEMS_BDBUF_IO_SCHEDULER_DEADLINE`` scheduler works like the elevator
+ * scheduler, however, it serves the device of the buffer which waits the
+ * longest time to be written first.  Use it together with
+ * #CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS to bound the flush latency of each
+ * device.
+ * @endparblock
+ */
+#define CONFIGURE_BDBUF_IO_SCHEDULER
+
 /* Generated from spec:/acfg/if/bdbuf-max-read-ahead-blocks */
 
 /**
@@ -228,6 +268,74 @@
  */
 #define CONFIGURE_BDBUF_MAX_WRITE_BLOCKS
 
+/* Generated from spec:/acfg/if/bdbuf-min-read-ahead-blocks */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS
+ *
+ * The value of this configuration option defines the initial and minimum
+ * blocks per read-ahead request of a sequential read stream.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * * The value of the configuration option shall be greater than or equal to
+ *   zero.
+ *
+ * * The value of the configuration option shall be less than or equal to <a
+ *   href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ * @endparblock
+ *
+ * @par Notes
+ * A value of 0 selects a fixed read-ahead window of
+ * #CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS blocks (default).  Otherwise, the
+ * window of a stream starts with this value and doubles each time the stream
+ * reaches its read-ahead trigger up to #CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS.
+ * Each buffer read ahead which is recycled without an access halves the
+ * window of its stream.  Values greater than
+ * #CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS are clamped to it.
+ */
+#define CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS
+
+/* Generated from spec:/acfg/if/bdbuf-read-ahead-streams */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_BDBUF_READ_AHEAD_STREAMS
+ *
+ * The value of this configuration option defines the number of concurrent
+ * sequential read streams tracked for each disk by the read-ahead.
+ *
+ * @par Default Value
+ * The default value is 1.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * * The value of the configuration option shall be greater than or equal to
+ *   one.
+ *
+ * * The value of the configuration option shall be less than or equal to
+ *   four.
+ * @endparblock
+ *
+ * @par Notes
+ * Each stream has its own read-ahead trigger and window.  A read miss which
+ * does not continue a stream replaces the least recently used stream of the
+ * disk.  Several streams allow to detect interleaved sequential reads, for
+ * example of two files read in parallel.  The read-ahead hits, misses and
+ * waste are reported in the device statistics.
+ */
+#define CONFIGURE_BDBUF_READ_AHEAD_STREAMS
+
 /* Generated from spec:/acfg/if/bdbuf-read-ahead-task-priority */
 
 /**
@@ -247,6 +355,74 @@
  */
 #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
 
+/* Generated from spec:/acfg/if/bdbuf-shard-count */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_BDBUF_SHARD_COUNT
+ *
+ * The value of this configuration option defines the number of independently
+ * locked shards of the Block Device Cache.
+ *
+ * @par Default Value
+ * The default value is 1.
+ *
+ * @par Constraints
+ * The value of the configuration option shall be greater than or equal to one.
+ *
+ * @par Notes
+ * @parblock
+ * The buffer groups of the cache are distributed evenly to the shards.  Each
+ * block of a device is cached in the shard selected by a hash of the device
+ * and the block number.  Each shard has its own lock, lookup tree and lists,
+ * so that threads accessing blocks in different shards do not contend for a
+ * single cache lock.  Consecutive media blocks are kept in the same shard in
+ * runs of 128 media blocks so that multi-block transfers are still possible.
+ *
+ * The buffer memory is split into fixed pools, one for each shard.  The
+ * shards do not share buffers.  A shard which runs out of buffers waits for
+ * one of its own buffers to become available, even if other shards have free
+ * buffers.  Each shard shall provide enough buffers for the blocks held
+ * concurrently by the application in this shard.  The number of shards is
+ * limited to the number of buffer groups defined by
+ * @ref CONFIGURE_BDBUF_CACHE_MEMORY_SIZE divided by
+ * @ref CONFIGURE_BDBUF_BUFFER_MAX_SIZE.
+ * @endparblock
+ */
+#define CONFIGURE_BDBUF_SHARD_COUNT
+
+/* Generated from spec:/acfg/if/bdbuf-swapout-batch-blocks */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS
+ *
+ * The value of this configuration option defines the maximum blocks written
+ * to one device in a swap-out pass before the next device is served.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * * The value of the configuration option shall be greater than or equal to
+ *   zero.
+ *
+ * * The value of the configuration option shall be less than or equal to <a
+ *   href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ * @endparblock
+ *
+ * @par Notes
+ * A value of 0 means no limit (default).  In this case all buffers of a device
+ * with an expired hold time are written in one swap-out pass, so a device with
+ * a large backlog of modified buffers may delay the writes to other devices.
+ */
+#define CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS
+
 /* Generated from spec:/acfg/if/bdbuf-task-stack-size */
 
 /**
@@ -2409,6 +2585,58 @@
  */
 #define CONFIGURE_IMFS_DISABLE_UTIME
 
+/* Generated from spec:/acfg/if/imfs-enable-directory-index */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+ *
+ * In case this configuration option is defined, then the directories of the
+ * root IMFS with more than 32 entries get a hash index for the lookup of
+ * their entries.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the entries of a directory
+ * of the root IMFS are searched linearly.
+ *
+ * @par Notes
+ * The index makes the path evaluation, the creation, and the removal of
+ * entries in large directories independent of the directory size.  Each
+ * directory needs some more memory for the index control.  Large directories
+ * need a hash table with at least two slots per entry.  The order of the
+ * entries returned by readdir() does not change.  For an IMFS mounted through
+ * mount(), the index is enabled through the IMFS_mount_options passed as the
+ * data argument.
+ */
+#define CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+
+/* Generated from spec:/acfg/if/imfs-enable-extent-files */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+ *
+ * In case this configuration option is defined, then the regular files of the
+ * root IMFS store their data in contiguous extents.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the regular files of the
+ * root IMFS store their data in blocks of
+ * #CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK bytes.
+ *
+ * @par Notes
+ * The capacity of an extent file grows geometrically, so sequential reads and
+ * writes need only a few memcpy() calls and the file size is not limited by
+ * the block tables.  A file which consists of one extent can be mapped with
+ * mmap() using MAP_SHARED without copying.  In the worst case, the capacity of
+ * a file is twice its size.  The extents need large contiguous memory areas
+ * from the C Program Heap.  This configuration option has no effect if
+ * #CONFIGURE_IMFS_DISABLE_MKNOD_FILE is defined.
+ */
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
 /* Generated from spec:/acfg/if/imfs-enable-mkfifo */
 
 /**
@@ -2754,6 +2982,41 @@
  */
 #define CONFIGURE_EXTRA_TASK_STACKS
 
+/* Generated from spec:/acfg/if/high-resolution-timers */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_HIGH_RESOLUTION_TIMERS
+ *
+ * In case this configuration option is defined, then the Clock Driver
+ * programs its interrupt for the expiration time of the next monotonic or
+ * realtime watchdog of a processor, if it expires before the next clock tick.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * This configuration option has no impact if the Clock Driver is not
+ * configured, see @ref CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER, or if
+ * the Clock Driver of the BSP does not support programming of its next
+ * interrupt.  In this case, the monotonic and realtime watchdogs are serviced
+ * by the first clock tick at or after their expiration time.
+ *
+ * The monotonic and realtime watchdogs are used for example by
+ * clock_nanosleep(), nanosleep(), timer_settime(), and timed waits with an
+ * absolute timeout such as pthread_cond_timedwait().  Directives which
+ * specify an interval in clock ticks, for example rtems_task_wake_after(),
+ * are serviced by clock ticks.
+ *
+ * Each additional clock interrupt adds overhead.  The clock interrupt may be
+ * programmed at most once for each monotonic or realtime watchdog.
+ * @endparblock
+ */
+#define CONFIGURE_HIGH_RESOLUTION_TIMERS
+
 /* Generated from spec:/acfg/if/init */
 
 /**
@@ -2885,6 +3148,61 @@
  */
 #define CONFIGURE_MALLOC_DIRTY
 
+/* Generated from spec:/acfg/if/malloc-per-cpu-cache */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_MALLOC_PER_CPU_CACHE
+ *
+ * In case this configuration option is defined, then small memory areas of
+ * the C Program Heap are cached in per-processor magazines.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * Allocation requests up to 256 bytes without an alignment or boundary
+ * constraint are satisfied from the magazine of the current processor
+ * without obtaining the allocator mutex.  The magazines are refilled from and
+ * drained to the heap in batches.  Memory areas may be returned to the
+ * magazines by free() also from interrupt context.  Cached memory areas are
+ * accounted as used by the heap.  They are returned to the heap by
+ * malloc_info() and in case an allocation request cannot be satisfied
+ * otherwise.
+ *
+ * Invalid or double frees of cacheable memory areas are detected not before
+ * the memory area is returned to the heap.
+ */
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+/* Generated from spec:/acfg/if/malloc-segregated-fit */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_MALLOC_SEGREGATED_FIT
+ *
+ * In case this configuration option is defined, then the C Program Heap uses
+ * a segregated fit index to find a free block for an allocation request.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * The index groups the free blocks in size classes.  It bounds the search
+ * time of an allocation by the number of free blocks in one size class.
+ * Without the index, all free blocks which are too small for the request may
+ * be visited.  The index needs ( 1 + 8 + 32 * P ) * P bytes of memory, where
+ * P is the size of a pointer in bytes.  This is 548 bytes on targets with
+ * 32-bit pointers and 2120 bytes on targets with 64-bit pointers.
+ *
+ * See also @ref CONFIGURE_WORKSPACE_SEGREGATED_FIT.
+ */
+#define CONFIGURE_MALLOC_SEGREGATED_FIT
+
 /* Generated from spec:/acfg/if/max-file-descriptors */
 
 /**
@@ -3272,6 +3590,46 @@
  */
 #define CONFIGURE_MINIMUM_TASK_STACK_SIZE
 
+/* Generated from spec:/acfg/if/mutex-adaptive-spin-time */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * @anchor CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME
+ *
+ * The value of this configuration option defines the maximum time in
+ * nanoseconds a thread spins while the owner of a mutex with adaptive
+ * spinning executes on another processor before the thread blocks on the
+ * mutex.
+ *
+ * @par Default Value
+ * The default value is 10000.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this configuration option:
+ *
+ * * The value of the configuration option shall be greater than or equal to
+ *   zero.
+ *
+ * * The value of the configuration option shall be less than or equal to
+ *   1000000000.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ * Adaptive spinning is selected for Classic API mutexes by the
+ * #RTEMS_ADAPTIVE_SPIN attribute and for POSIX mutexes by the
+ * ``PTHREAD_MUTEX_ADAPTIVE_NP`` mutex type.  A value of zero disables adaptive
+ * spinning.
+ *
+ * This configuration option is only evaluated in SMP configurations of RTEMS
+ * (e.g. RTEMS was built with the SMP build configuration option enabled). In
+ * all other configurations it has no effect.
+ * @endparblock
+ */
+#define CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME
+
 /* Generated from spec:/acfg/if/stack-checker-enabled */
 
 /**
@@ -3297,6 +3655,42 @@
  */
 #define CONFIGURE_STACK_CHECKER_ENABLED
 
+/* Generated from spec:/acfg/if/tickless-idle */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_TICKLESS_IDLE
+ *
+ * In case this configuration option is defined, then the Clock Driver
+ * suppresses the clock tick interrupts of a processor while its idle thread
+ * executes until the next watchdog of the processor expires.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * This configuration option has no impact if the Clock Driver is not
+ * configured, see @ref CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER, or if
+ * the Clock Driver of the BSP does not support the tickless idle mode.
+ *
+ * The Clock Driver decides in the clock tick interrupt to enter the tickless
+ * idle mode.  The skipped clock ticks are accounted for in the watchdog ticks
+ * and in the value returned by rtems_clock_get_ticks_since_boot() when the
+ * next clock tick interrupt occurs, when the idle thread is replaced by
+ * another thread, or when a watchdog of the processor is changed.  The
+ * timeslice budget of tasks is not affected since only the idle thread
+ * executes while clock ticks are skipped.  The CPU usage statistics use the
+ * timecounter and are not affected.
+ *
+ * The clock tick interrupt is suppressed for at most half of the period of
+ * the timecounter hardware.
+ * @endparblock
+ */
+#define CONFIGURE_TICKLESS_IDLE
+
 /* Generated from spec:/acfg/if/ticks-per-time-slice */
 
 /**
@@ -3436,6 +3830,63 @@
  */
 #define CONFIGURE_VERBOSE_SYSTEM_INITIALIZATION
 
+/* Generated from spec:/acfg/if/watchdog-timing-wheel */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_WATCHDOG_TIMING_WHEEL
+ *
+ * In case this configuration option is defined, then the watchdogs of the
+ * clock tick based time services are managed by a per-processor hierarchical
+ * timing wheel.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the watchdogs are managed by
+ * a per-processor red-black tree.
+ *
+ * @par Notes
+ * @parblock
+ * The timing wheel inserts and removes watchdogs in constant time.  This
+ * benefits applications which start and cancel many timeouts, for example
+ * blocking directive calls with a timeout which are mostly satisfied before
+ * the timeout expires.  The red-black tree needs logarithmic time for these
+ * operations.
+ *
+ * The clock tick processing moves the watchdogs of a higher level slot to the
+ * lower levels each time the current time reaches the slot.  The worst-case
+ * execution time of a clock tick depends therefore on the count of watchdogs
+ * in such a slot.
+ *
+ * Each processor needs memory for 257 chain controls.  The watchdogs of the
+ * realtime and monotonic clocks are not affected by this configuration
+ * option.
+ * @endparblock
+ */
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
+/* Generated from spec:/acfg/if/workspace-segregated-fit */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_WORKSPACE_SEGREGATED_FIT
+ *
+ * In case this configuration option is defined, then the RTEMS Workspace uses
+ * a segregated fit index to find a free block for an allocation request.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * In case @ref CONFIGURE_UNIFIED_WORK_AREAS is defined, then the index is
+ * shared with the C Program Heap.
+ *
+ * See also @ref CONFIGURE_MALLOC_SEGREGATED_FIT.
+ */
+#define CONFIGURE_WORKSPACE_SEGREGATED_FIT
+
 /* Generated from spec:/acfg/if/zero-workspace-automatically */
 
 /**
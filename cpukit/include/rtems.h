@@ -79,6 +79,7 @@
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/support.h>
 #include <rtems/rtems/tasks.h>
+#include <rtems/rtems/threadpool.h>
 #include <rtems/rtems/timer.h>
 #include <rtems/rtems/types.h>
 
@@ -331,9 +331,15 @@ typedef struct rtems_bdbuf_buffer
                                   * part of. */
   uint32_t hold_timer;           /**< Timer to indicate how long a buffer
                                   * has been held in the cache modified. */
+  rtems_interval modified_ticks; /**< The clock tick of the first
+                                  * modification since the last write. */
 
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
+
+  uint8_t read_ahead_stream;     /**< The read-ahead stream index plus one if
+                                  * the buffer was read ahead and not accessed
+                                  * since, otherwise zero. */
 } rtems_bdbuf_buffer;
 
 /**
@@ -354,6 +360,31 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * The I/O schedulers available to order the writes of the swap-out task.
+ */
+typedef enum
+{
+  /**
+   * Write the buffers due of the first device found in ascending block order.
+   */
+  RTEMS_BDBUF_IO_SCHEDULER_SORT,
+
+  /**
+   * Write the buffers due in a circular sweep over the device which continues
+   * at the block following the previous write of the device.  Modified
+   * buffers adjacent to the buffers due are merged into the write even if
+   * their hold time has not expired yet.
+   */
+  RTEMS_BDBUF_IO_SCHEDULER_ELEVATOR,
+
+  /**
+   * Like the elevator scheduler, but select the device of the buffer which
+   * waits the longest time for its write.
+   */
+  RTEMS_BDBUF_IO_SCHEDULER_DEADLINE
+} rtems_bdbuf_io_scheduler;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -383,6 +414,21 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  uint32_t            shard_count;             /**< Number of independently
+                                                * locked cache shards. */
+  uint32_t            read_ahead_streams;      /**< Number of concurrent
+                                                * sequential read-ahead
+                                                * streams per disk. */
+  uint32_t            min_read_ahead_blocks;   /**< Initial and minimum
+                                                * read-ahead window. Zero
+                                                * selects a fixed window of
+                                                * max_read_ahead_blocks. */
+  rtems_bdbuf_io_scheduler io_scheduler;       /**< The I/O scheduler of the
+                                                * swap-out task. */
+  uint32_t            swapout_batch_blocks;    /**< Maximum blocks written to
+                                                * one device before the next
+                                                * device is served. Zero
+                                                * means no limit. */
 } rtems_bdbuf_config;
 
 /**
@@ -455,6 +501,32 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default number of cache shards.
+ */
+#define RTEMS_BDBUF_SHARD_COUNT_DEFAULT (1)
+
+/**
+ * Default number of read-ahead streams per disk.
+ */
+#define RTEMS_BDBUF_READ_AHEAD_STREAMS_DEFAULT (1)
+
+/**
+ * Default minimum read-ahead window.  Zero selects a fixed window.
+ */
+#define RTEMS_BDBUF_MIN_READ_AHEAD_BLOCKS_DEFAULT (0)
+
+/**
+ * Default swap-out I/O scheduler.
+ */
+#define RTEMS_BDBUF_IO_SCHEDULER_DEFAULT RTEMS_BDBUF_IO_SCHEDULER_SORT
+
+/**
+ * Default maximum blocks written to one device per swap-out pass.  Zero means
+ * no limit.
+ */
+#define RTEMS_BDBUF_SWAPOUT_BATCH_BLOCKS_DEFAULT (0)
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIBRLock
+ *
+ * @brief This header file provides the big reader lock API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_BRLOCK_H
+#define _RTEMS_BRLOCK_H
+
+#include <rtems/rtems/status.h>
+#include <rtems/score/brlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPIBRLock Big Reader Locks
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief The big reader locks are reader-writer locks for read-mostly data.
+ *
+ * Each big reader lock has a reader counter on each processor.  As long as no
+ * writer is present, a read lock or unlock only modifies the reader counter of
+ * the current processor.  Readers on different processors do not write to a
+ * shared cache line.  A writer announces its presence so that new readers
+ * block and then waits until the readers drained.  Write locks are much more
+ * expensive than with other reader-writer locks, so big reader locks should
+ * be used only for data which is rarely modified.
+ *
+ * At most #RTEMS_BRLOCK_MAXIMUM_COUNT big reader locks may be initialized at
+ * the same time.  The big reader locks are self-contained objects, they are
+ * not managed through object identifiers.
+ *
+ * A read lock of a thread which owns the lock for writing and a write lock of
+ * a thread which owns the lock for reading are not allowed.  Read locks are
+ * recursive, only the outermost read lock and unlock of a thread change the
+ * reader counter.  Each thread records its read lock nest level for each big
+ * reader lock, so that these errors and unlocks of threads which do not own
+ * the lock are detected.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the maximum count of concurrently initialized
+ *   big reader locks.
+ */
+#define RTEMS_BRLOCK_MAXIMUM_COUNT BRLOCK_MAXIMUM_COUNT
+
+/**
+ * @brief This type represents a big reader lock.
+ */
+typedef BRLock_Control rtems_brlock;
+
+/**
+ * @brief Initializes the big reader lock.
+ *
+ * @param[out] lock is the big reader lock to initialize.
+ *
+ * @param name is the name of the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_TOO_MANY There were already #RTEMS_BRLOCK_MAXIMUM_COUNT big
+ *   reader locks initialized.
+ */
+rtems_status_code rtems_brlock_initialize(
+  rtems_brlock *lock,
+  const char   *name
+);
+
+/**
+ * @brief Destroys the big reader lock.
+ *
+ * @param[in, out] lock is the big reader lock to destroy.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The big reader lock was owned by a writer or
+ *   there were threads waiting for the big reader lock.
+ */
+rtems_status_code rtems_brlock_destroy( rtems_brlock *lock );
+
+/**
+ * @brief Obtains the big reader lock for reading.
+ *
+ * The calling task waits while a writer is present, unless it owns the big
+ * reader lock already for reading.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The calling task owned the big reader lock
+ *   for writing.
+ *
+ * @retval ::RTEMS_TOO_MANY The read lock nest level of the calling task would
+ *   overflow.
+ */
+rtems_status_code rtems_brlock_read_lock( rtems_brlock *lock );
+
+/**
+ * @brief Tries to obtain the big reader lock for reading.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_UNSATISFIED A writer was present.
+ *
+ * @retval ::RTEMS_TOO_MANY The read lock nest level of the calling task would
+ *   overflow.
+ */
+rtems_status_code rtems_brlock_try_read_lock( rtems_brlock *lock );
+
+/**
+ * @brief Releases the big reader lock obtained for reading.
+ *
+ * The big reader lock is released if the read lock nest level of the calling
+ * task reaches zero.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_NOT_OWNER_OF_RESOURCE The calling task did not own the big
+ *   reader lock.
+ */
+rtems_status_code rtems_brlock_read_unlock( rtems_brlock *lock );
+
+/**
+ * @brief Obtains the big reader lock for writing.
+ *
+ * The calling task waits while another writer is present and until all
+ * readers released the big reader lock.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The calling task owned the big reader lock
+ *   for writing.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The calling task owned the big reader lock
+ *   for reading.
+ */
+rtems_status_code rtems_brlock_write_lock( rtems_brlock *lock );
+
+/**
+ * @brief Tries to obtain the big reader lock for writing.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_UNSATISFIED A writer or a reader was present.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The calling task owned the big reader lock
+ *   for reading.
+ */
+rtems_status_code rtems_brlock_try_write_lock( rtems_brlock *lock );
+
+/**
+ * @brief Releases the big reader lock obtained for writing.
+ *
+ * @param[in, out] lock is the big reader lock.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_NOT_OWNER_OF_RESOURCE The calling task did not own the big
+ *   reader lock.
+ */
+rtems_status_code rtems_brlock_write_unlock( rtems_brlock *lock );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_BRLOCK_H */
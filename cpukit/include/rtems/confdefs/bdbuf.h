@@ -116,6 +116,29 @@
     RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
 #endif
 
+#ifndef CONFIGURE_BDBUF_SHARD_COUNT
+  #define CONFIGURE_BDBUF_SHARD_COUNT RTEMS_BDBUF_SHARD_COUNT_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_READ_AHEAD_STREAMS
+  #define CONFIGURE_BDBUF_READ_AHEAD_STREAMS \
+    RTEMS_BDBUF_READ_AHEAD_STREAMS_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS
+  #define CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS \
+    RTEMS_BDBUF_MIN_READ_AHEAD_BLOCKS_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_IO_SCHEDULER
+  #define CONFIGURE_BDBUF_IO_SCHEDULER RTEMS_BDBUF_IO_SCHEDULER_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS
+  #define CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS \
+    RTEMS_BDBUF_SWAPOUT_BATCH_BLOCKS_DEFAULT
+#endif
+
 #define _CONFIGURE_LIBBLOCK_TASKS \
   ( 1 + CONFIGURE_SWAPOUT_WORKER_TASKS \
     + ( CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS != 0 ) )
@@ -142,7 +165,12 @@ const rtems_bdbuf_config rtems_bdbuf_configuration = {
   CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
   CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
   CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+  CONFIGURE_BDBUF_SHARD_COUNT,
+  CONFIGURE_BDBUF_READ_AHEAD_STREAMS,
+  CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS,
+  CONFIGURE_BDBUF_IO_SCHEDULER,
+  CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS
 };
 
 #ifdef __cplusplus
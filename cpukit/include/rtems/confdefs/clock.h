@@ -106,6 +106,14 @@ const uint32_t _Watchdog_Ticks_per_second =
     CONFIGURE_TICKS_PER_TIMESLICE;
 #endif
 
+#ifdef CONFIGURE_TICKLESS_IDLE
+  const bool _Watchdog_Tickless_idle = true;
+#endif
+
+#ifdef CONFIGURE_HIGH_RESOLUTION_TIMERS
+  const bool _Watchdog_High_resolution_timers = true;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -276,6 +276,8 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #endif
   #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
     &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+    &IMFS_mknod_control_extfile,
   #else
     &IMFS_mknod_control_memfile,
   #endif
@@ -289,7 +291,12 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
 static const IMFS_mount_data IMFS_root_mount_data = {
   &IMFS_root_fs_info,
   &IMFS_root_ops,
-  &IMFS_root_mknod_controls
+  &IMFS_root_mknod_controls,
+  #ifdef CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+    true
+  #else
+    false
+  #endif
 };
 
 const rtems_filesystem_table_t rtems_filesystem_table[] = {
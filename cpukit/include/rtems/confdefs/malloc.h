@@ -50,10 +50,17 @@
 #define _CONFIGURE_HEAP_EXTEND_VIA_SBRK
 #endif
 
-#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY)
+#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || \
+  defined(CONFIGURE_MALLOC_DIRTY) || defined(CONFIGURE_MALLOC_SEGREGATED_FIT) || \
+  defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
 #include <rtems/malloc.h>
 #endif
 
+#if defined(CONFIGURE_MALLOC_SEGREGATED_FIT) || \
+  defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
+#include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +75,24 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+Heap_Segregated_index _Malloc_Segregated_index;
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Enable_segregated_fit,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Enable_per_CPU_cache,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
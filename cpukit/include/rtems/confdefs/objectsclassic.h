@@ -74,6 +74,7 @@
 #if CONFIGURE_MAXIMUM_SEMAPHORES > 0
   #include <rtems/confdefs/scheduler.h>
   #include <rtems/rtems/semdata.h>
+  #include <rtems/score/objectimpl.h>
 #endif
 
 #if CONFIGURE_MAXIMUM_TIMERS > 0
@@ -113,6 +114,14 @@ extern "C" {
     CONFIGURE_MAXIMUM_SEMAPHORES,
     _CONFIGURE_SCHEDULER_COUNT
   );
+
+  OBJECTS_GET_CONFIGURED_DEFINE(
+    _Semaphore,
+    &_Semaphore_Information,
+    OBJECTS_CLASSIC_API,
+    OBJECTS_RTEMS_SEMAPHORES,
+    CONFIGURE_MAXIMUM_SEMAPHORES
+  )
 #endif
 
 #if CONFIGURE_MAXIMUM_TIMERS > 0
@@ -55,6 +55,9 @@
 #include <rtems/score/context.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
+#include <rtems/score/threadq.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/sysinit.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +76,15 @@ extern "C" {
 
   Per_CPU_Control_envelope
     _Per_CPU_Information[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  #ifdef CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME
+    #if CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME > 1000000000
+      #error "CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME must be less than or equal to one second"
+    #endif
+
+    const uint32_t _Thread_queue_Adaptive_spin_time =
+      CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME;
+  #endif
 #endif
 
 /* Interrupt stack configuration */
@@ -150,6 +162,18 @@ const size_t _Thread_Idle_stack_size = CONFIGURE_IDLE_TASK_STACK_SIZE;
   const Thread_Idle_body _Thread_Idle_body = CONFIGURE_IDLE_TASK_BODY;
 #endif
 
+/* Watchdog timing wheel configuration */
+
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize_processors,
+    RTEMS_SYSINIT_PER_CPU_DATA,
+    RTEMS_SYSINIT_ORDER_MIDDLE
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,7 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/confdefs/percpu.h>
+#include <rtems/score/schedulerstats.h>
 
 #if !defined(CONFIGURE_SCHEDULER_CBS) \
   && !defined(CONFIGURE_SCHEDULER_EDF) \
@@ -253,6 +254,12 @@ const Scheduler_Control _Scheduler_Table[] = {
 
 #define _CONFIGURE_SCHEDULER_COUNT RTEMS_ARRAY_SIZE( _Scheduler_Table )
 
+#ifdef RTEMS_SCHEDULER_STATISTICS
+
+Scheduler_Statistics _Scheduler_Statistics[ _CONFIGURE_SCHEDULER_COUNT ];
+
+#endif
+
 #ifdef RTEMS_SMP
 
 const size_t _Scheduler_Count = _CONFIGURE_SCHEDULER_COUNT;
@@ -50,6 +50,7 @@
 #include <rtems/confdefs/unlimited.h>
 #include <rtems/score/thread.h>
 #include <rtems/rtems/tasksdata.h>
+#include <rtems/score/objectimpl.h>
 
 #ifdef RTEMS_POSIX_API
   #include <rtems/posix/threadsup.h>
@@ -262,6 +263,14 @@ THREAD_INFORMATION_DEFINE(
     OBJECTS_RTEMS_TASKS,
     _CONFIGURE_TASKS
   );
+
+  OBJECTS_GET_CONFIGURED_DEFINE(
+    _RTEMS_tasks,
+    &_RTEMS_tasks_Information.Objects,
+    OBJECTS_CLASSIC_API,
+    OBJECTS_RTEMS_TASKS,
+    _CONFIGURE_TASKS
+  )
 #endif
 
 #if CONFIGURE_MAXIMUM_POSIX_THREADS > 0
@@ -54,6 +54,7 @@
 #include <rtems/score/context.h>
 #include <rtems/score/memory.h>
 #include <rtems/score/stack.h>
+#include <rtems/score/wkspace.h>
 #include <rtems/sysinit.h>
 
 #if CPU_STACK_ALIGNMENT > CPU_HEAP_ALIGNMENT
@@ -257,6 +258,16 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
 const Stack_Allocator_allocate_for_idle _Stack_Allocator_allocate_for_idle =
   CONFIGURE_TASK_STACK_ALLOCATOR_FOR_IDLE;
 
+#ifdef CONFIGURE_WORKSPACE_SEGREGATED_FIT
+  Heap_Segregated_index _Workspace_Segregated_index;
+
+  RTEMS_SYSINIT_ITEM(
+    _Workspace_Enable_segregated_fit,
+    RTEMS_SYSINIT_WORKSPACE,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 #ifdef CONFIGURE_DIRTY_MEMORY
   RTEMS_SYSINIT_ITEM(
     _Memory_Dirty_free_areas,
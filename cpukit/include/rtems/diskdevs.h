@@ -63,8 +63,18 @@ typedef int (*rtems_block_device_ioctl)(
  */
 #define RTEMS_DISK_READ_AHEAD_SIZE_AUTO (0)
 
+/**
+ * @brief Maximum count of concurrent sequential read-ahead streams per disk.
+ *
+ * The count of streams used by the block device buffer cache is defined by
+ * the read_ahead_streams configuration value.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAM_COUNT 4
+
 /**
  * @brief Block device read-ahead control.
+ *
+ * Each control describes one sequential read-ahead stream of a disk.
  */
 typedef struct {
   /**
@@ -93,9 +103,32 @@ typedef struct {
    * @brief Size of the next read-ahead request in blocks.
    *
    * A value of @ref RTEMS_DISK_READ_AHEAD_SIZE_AUTO will try to read the rest
-   * of the disk but at most the configured max_read_ahead_blocks.
+   * of the disk but at most the current window of the stream.
    */
   uint32_t nr_blocks;
+
+  /**
+   * @brief Current read-ahead window of the stream in blocks.
+   *
+   * A value of zero indicates a new stream which did not issue a read-ahead
+   * request yet.  The window grows each time the stream reaches its trigger
+   * and shrinks each time a block read ahead by this stream is recycled
+   * without an access.  It is limited by the configured
+   * min_read_ahead_blocks and max_read_ahead_blocks.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Least recently used stamp of the stream.
+   *
+   * The least recently used stream is replaced by a new stream.
+   */
+  uint32_t stamp;
+
+  /**
+   * @brief The disk of this stream.
+   */
+  rtems_disk_device *dd;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -164,6 +197,32 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * block was read ahead and is accessed for the first time.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead miss count.
+   *
+   * A read-ahead miss occurs in the rtems_bdbuf_read() function in case a
+   * read miss hits the trigger block of a sequential stream which already
+   * issued a read-ahead request, so the stream was detected but the
+   * read-ahead did not cover the block.  It is only counted if the read-ahead
+   * is enabled.
+   */
+  uint32_t read_ahead_misses;
+
+  /**
+   * @brief Read-ahead waste count.
+   *
+   * Count of blocks read ahead which were recycled without an access.
+   */
+  uint32_t read_ahead_waste;
 } rtems_blkdev_stats;
 
 /**
@@ -288,8 +347,33 @@ struct rtems_disk_device {
 
   /**
    * @brief Read-ahead control for this disk.
+   *
+   * This is the first read-ahead stream.  It is also used by
+   * rtems_bdbuf_peek().
    */
   rtems_blkdev_read_ahead read_ahead;
+
+  /**
+   * @brief Additional read-ahead streams of this disk.
+   *
+   * They are only used if more than one stream is configured.
+   */
+  rtems_blkdev_read_ahead
+    read_ahead_streams[RTEMS_DISK_READ_AHEAD_STREAM_COUNT - 1];
+
+  /**
+   * @brief Stamp counter for the least recently used read-ahead stream.
+   */
+  uint32_t read_ahead_stamp;
+
+  /**
+   * @brief The media block following the last block scheduled for a write by
+   * the swapout I/O scheduler.
+   *
+   * The elevator schedulers continue the next write sweep of this disk at
+   * this block.
+   */
+  rtems_blkdev_bnum swapout_position;
 };
 
 /**
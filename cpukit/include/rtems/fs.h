@@ -41,6 +41,7 @@
 #define _RTEMS_FS_H
 
 #include <rtems/chain.h>
+#include <rtems/score/atomic.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -94,12 +95,18 @@ typedef struct rtems_filesystem_location_info_tt {
  * To support a release within critical sections of the operating system a
  * deferred release is supported.  This is similar to malloc() and free().
  *
+ * The global location pointers are published with RTEMS_RCU_PUBLISH(), so
+ * that rtems_filesystem_global_location_obtain() can increment the reference
+ * count without a lock in a read-side critical section.  For this reason, the
+ * memory of a global location is reclaimed only after a grace period, see
+ * rtems_rcu_synchronize().
+ *
  * @see rtems_filesystem_global_location_obtain() and
  * rtems_filesystem_global_location_release().
  */
 typedef struct rtems_filesystem_global_location_t {
   rtems_filesystem_location_info_t location;
-  int reference_count;
+  Atomic_Uint reference_count;
 
   /**
    * A release within a critical section of the operating system will add this
@@ -205,6 +205,8 @@ IMFS_jnode_t *IMFS_node_remove_default(
 
 IMFS_jnode_t *IMFS_node_remove_directory( IMFS_jnode_t *node );
 
+void IMFS_node_destroy_directory( IMFS_jnode_t *node );
+
 /**
  * @brief Destroys an IMFS node.
  *
@@ -283,10 +285,31 @@ struct IMFS_jnode_tt {
   const IMFS_node_control *control;
 };
 
+/*
+ *  The number of directory entries above which an indexed directory gets a
+ *  hash table.
+ */
+
+#define IMFS_DIRECTORY_INDEX_THRESHOLD 32
+
+/*
+ *  The optional hash index of a directory.  The entries chain stays the
+ *  reference for readdir(), so the index does not change the entry order.
+ */
+
+typedef struct {
+  IMFS_jnode_t **table;          /* open addressing hash table or NULL */
+  uint32_t       size;           /* size of the table, a power of two */
+  uint32_t       used;           /* used and deleted slots of the table */
+  uint32_t       count;          /* count of directory entries */
+  bool           enabled;        /* index this directory if it is large */
+} IMFS_directory_index;
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+  IMFS_directory_index                  Index;
 } IMFS_directory_t;
 
 typedef struct {
@@ -322,6 +345,32 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+/*
+ *  IMFS "extfile" information
+ *
+ *  The extent files store their data in a small number of contiguous memory
+ *  areas.  The capacity of a file grows geometrically.  As long as the file
+ *  data consists of one extent, the extent is resized in place if possible,
+ *  so that files written sequentially stay contiguous.  Once a part of the
+ *  file is mapped, the existing extents are pinned and the file grows by
+ *  appending new extents.
+ */
+
+#define IMFS_EXTFILE_MINIMUM_CAPACITY 64
+
+typedef struct {
+  unsigned char *data;
+  size_t         size;
+} IMFS_extent;
+
+typedef struct {
+  IMFS_filebase_t File;
+  IMFS_extent    *extents;          /* array of extent_count extents */
+  uint32_t        extent_count;
+  bool            pinned;           /* extents must not move */
+  size_t          capacity;         /* sum of all extent sizes */
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -372,6 +421,11 @@ static inline IMFS_memfile_t *IMFS_iop_to_memfile( const rtems_libio_t *iop )
   return (IMFS_memfile_t *) iop->pathinfo.node_access;
 }
 
+static inline IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
 typedef struct {
   const IMFS_mknod_control *directory;
   const IMFS_mknod_control *device;
@@ -389,8 +443,29 @@ typedef struct {
   IMFS_fs_info_t *fs_info;
   const rtems_filesystem_operations_table *ops;
   const IMFS_mknod_controls *mknod_controls;
+
+  /*
+   * If true, then large directories of the file system get a hash index for
+   * the lookup of their entries.
+   */
+  bool directory_index;
 } IMFS_mount_data;
 
+/*
+ *  The options of a file system mounted through mount() with the file system
+ *  type RTEMS_FILESYSTEM_TYPE_IMFS.  A pointer to the options may be passed as
+ *  the data argument of mount().  A NULL data argument selects the default
+ *  options, which are all false.
+ */
+
+typedef struct {
+  /*
+   * If true, then large directories of the file system get a hash index for
+   * the lookup of their entries.
+   */
+  bool directory_index;
+} IMFS_mount_options;
+
 /*
  *  Shared Data
  */
@@ -399,6 +474,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -409,6 +485,15 @@ extern const rtems_filesystem_limits_and_options_t  IMFS_LIMITS_AND_OPTIONS;
  *  Routines
  */
 
+/**
+ * @brief Initializes an IMFS instance with the default node controls.
+ *
+ * This is the file system mount handler of RTEMS_FILESYSTEM_TYPE_IMFS.
+ *
+ * @param mt_entry is the mount table entry of the file system.
+ *
+ * @param data is NULL or points to the IMFS_mount_options of the file system.
+ */
 extern int IMFS_initialize(
    rtems_filesystem_mount_table_entry_t *mt_entry,
    const void                           *data
@@ -1042,6 +1127,58 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+/**
+ * @brief Adds the entry to the hash index of the directory.
+ *
+ * The entry must be already on the entries chain of the directory.  Entries
+ * which are directories inherit the index enable status.  The hash table is
+ * created once the directory exceeds IMFS_DIRECTORY_INDEX_THRESHOLD entries.
+ * If no memory is available for the table, then the lookup falls back to a
+ * linear search.
+ *
+ * @param[in] dir The indexed directory.
+ * @param[in] entry The new entry of the directory.
+ */
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+/**
+ * @brief Removes the entry from the hash index of the directory.
+ *
+ * The name of the entry must not change while it is in the directory.
+ *
+ * @param[in] dir The indexed directory.
+ * @param[in] entry The entry to remove.
+ */
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+/**
+ * @brief Searches the entry with the name in the hash table of the directory.
+ *
+ * @param[in] dir The directory.  It must have a hash table.
+ * @param[in] name The name of the entry.
+ * @param[in] namelen The length of the name.
+ *
+ * @return The entry or NULL if no entry with this name exists.
+ */
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+);
+
+/**
+ * @brief Frees the hash table of the directory.
+ *
+ * @param[in] dir The directory.
+ */
+void IMFS_directory_index_destroy( IMFS_directory_t *dir );
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -1051,11 +1188,23 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+
+  if ( dir->Index.enabled ) {
+    IMFS_directory_index_insert( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
+  IMFS_directory_t *dir;
+
   IMFS_assert( node->Parent != NULL );
+  dir = (IMFS_directory_t *) node->Parent;
+
+  if ( dir->Index.enabled ) {
+    IMFS_directory_index_remove( dir, node );
+  }
+
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
 }
@@ -992,6 +992,12 @@ typedef int (*rtems_filesystem_kqfilter_t)(
  * @retval 0 Successful operation.
  * @retval error An error occurred.  This is usually EINVAL.
  *
+ * For regular files, this handler is used for shared mappings and read-only
+ * private mappings.  The mapping holds a reference to the file node.  The
+ * file system must keep the mapped data at the returned address until the
+ * node is destroyed, even if the file is removed or truncated in the
+ * meantime.
+ *
  * @see rtems_filesystem_default_mmap().
  */
 typedef int (*rtems_filesystem_mmap_t)(
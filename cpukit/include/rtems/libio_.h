@@ -806,9 +806,22 @@ static inline bool rtems_filesystem_is_ready_for_unmount(
   rtems_filesystem_mount_table_entry_t *mt_entry
 )
 {
-  bool ready = !mt_entry->mounted
+  bool ready;
+
+  /*
+   * This fence pairs with the fence in the lock-free path of
+   * rtems_filesystem_global_location_obtain().  Either we observe the
+   * reference count increment or the reader observes the cleared mounted
+   * indicator.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  ready = !mt_entry->mounted
     && rtems_chain_has_only_one_node( &mt_entry->location_chain )
-    && mt_entry->mt_fs_root->reference_count == 1;
+    && _Atomic_Load_uint(
+      &mt_entry->mt_fs_root->reference_count,
+      ATOMIC_ORDER_RELAXED
+    ) == 1;
 
   if ( ready ) {
     rtems_chain_initialize_empty( &mt_entry->location_chain );
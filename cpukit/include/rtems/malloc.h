@@ -70,6 +70,32 @@ extern Heap_Control *RTEMS_Malloc_Heap;
 
 void _Malloc_Initialize( void );
 
+/**
+ * @brief The segregated fit index of the C program heap.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_MALLOC_SEGREGATED_FIT via <rtems/confdefs.h>.
+ */
+extern Heap_Segregated_index _Malloc_Segregated_index;
+
+/**
+ * @brief Enables the segregated fit index for the C program heap.
+ *
+ * This handler is registered as a system initialization step by the
+ * application configuration option #CONFIGURE_MALLOC_SEGREGATED_FIT via
+ * <rtems/confdefs.h>.
+ */
+void _Malloc_Enable_segregated_fit( void );
+
+/**
+ * @brief Enables the per-processor cache of the C program heap.
+ *
+ * This handler is registered as a system initialization step by the
+ * application configuration option #CONFIGURE_MALLOC_PER_CPU_CACHE via
+ * <rtems/confdefs.h>.
+ */
+void _Malloc_Enable_per_CPU_cache( void );
+
 typedef void *(*rtems_heap_extend_handler)(
   Heap_Control *heap,
   size_t alloc_size
@@ -39,6 +39,8 @@
 #include <errno.h>
 #include <pthread.h>
 
+#include <rtems/posix/muteximpl.h>
+#include <rtems/score/assert.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -54,7 +56,19 @@ typedef struct {
 
 #define POSIX_CONDITION_VARIABLES_CLOCK_MONOTONIC 0x1UL
 
-#define POSIX_CONDITION_VARIABLES_FLAGS_MASK 0x1UL
+/*
+ * The waiters of the condition variable are in the wait morphing mode.  They
+ * are woken up one by one by the releases of the associated mutex.
+ */
+#define POSIX_CONDITION_VARIABLES_MORPH 0x2UL
+
+/*
+ * The condition variable used the wait morphing mode at least once.  Its
+ * destruction has to wait for mutex releases which may still reference it.
+ */
+#define POSIX_CONDITION_VARIABLES_MORPHED 0x4UL
+
+#define POSIX_CONDITION_VARIABLES_FLAGS_MASK 0x7UL
 
 #define POSIX_CONDITION_VARIABLES_MAGIC 0x18dfb1feUL
 
@@ -151,6 +165,48 @@ static inline void _POSIX_Condition_variables_Release(
   );
 }
 
+static inline bool _POSIX_Condition_variables_Is_morphing(
+  const POSIX_Condition_variables_Control *the_cond
+)
+{
+  return ( the_cond->flags & POSIX_CONDITION_VARIABLES_MORPH ) != 0;
+}
+
+static inline void _POSIX_Condition_variables_Stop_morphing(
+  POSIX_Condition_variables_Control *the_cond
+)
+{
+  POSIX_Mutex_Control *the_mutex;
+
+  _Assert( _POSIX_Condition_variables_Is_morphing( the_cond ) );
+  the_mutex = _POSIX_Mutex_Get( the_cond->mutex );
+  the_mutex->Futex.morph_count = 0;
+  _Atomic_Store_uintptr(
+    &the_mutex->Futex.morph_cond,
+    0,
+    ATOMIC_ORDER_RELAXED
+  );
+  the_cond->flags &= ~POSIX_CONDITION_VARIABLES_MORPH;
+}
+
+/**
+ * @brief Wakes up the next waiter of the condition variable in the wait
+ *   morphing mode.
+ *
+ * This function is called by the mutex release if the mutex references the
+ * condition variable in the wait morphing mode.  The caller shall be in an
+ * RCU read-side critical section which started before the reference to the
+ * condition variable was loaded.
+ *
+ * @param[in, out] the_cond is the condition variable.
+ *
+ * @param[in, out] the_mutex is the mutex which was released.
+ */
+void _POSIX_Condition_variables_Wake_morphed(
+  POSIX_Condition_variables_Control *the_cond,
+  POSIX_Mutex_Control               *the_mutex
+);
+
 /**
  * @brief Implements wake up version of the "signal" operation.
  * 
@@ -54,6 +54,8 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+  bool               is_file; /**< The mapping refers to the file data */
+  rtems_filesystem_location_info_t location; /**< The mapped file node */
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
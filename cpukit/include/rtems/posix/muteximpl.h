@@ -51,7 +51,46 @@ extern "C" {
 typedef struct {
   unsigned long flags;
   Mutex_recursive_Control Recursive;
-  Priority_Node Priority_ceiling;
+  union {
+    /*
+     * Used by priority ceiling mutexes.
+     */
+    Priority_Node Priority_ceiling;
+
+    /*
+     * Used by mutexes which use the futex fast path, see
+     * _POSIX_Mutex_Is_futex().  The thread queue of the mutex is used as the
+     * futex thread queue.  The owner of the thread queue is only set while
+     * threads wait for the mutex to enable the deadlock detection.
+     */
+    struct {
+      /*
+       * The futex state is one of POSIX_MUTEX_FUTEX_UNLOCKED,
+       * POSIX_MUTEX_FUTEX_LOCKED, and POSIX_MUTEX_FUTEX_CONTENDED.
+       */
+      Atomic_Uint state;
+
+      /*
+       * The count of condition variable waiters which still have to be woken
+       * up in the wait morphing mode.  Protected by the thread queue lock of
+       * the condition variable, see _POSIX_Condition_variables_Wake_morphed().
+       */
+      unsigned int morph_count;
+
+      /*
+       * The condition variable with waiters in the wait morphing mode or
+       * zero.  Changed only while the thread queue lock of the condition
+       * variable is owned.
+       */
+      Atomic_Uintptr morph_cond;
+
+      /*
+       * The owner of the mutex.  It is only changed by the owner.  It is set
+       * to NULL before the futex state is released.
+       */
+      Thread_Control *owner;
+    } Futex;
+  };
   const Scheduler_Control *scheduler;
 } POSIX_Mutex_Control;
 
@@ -59,7 +98,19 @@ typedef struct {
 
 #define POSIX_MUTEX_RECURSIVE 0x4UL
 
-#define POSIX_MUTEX_FLAGS_MASK 0x7UL
+#define POSIX_MUTEX_ADAPTIVE_SPIN 0x8UL
+
+#define POSIX_MUTEX_FLAGS_MASK 0xfUL
+
+#define POSIX_MUTEX_ABSTIME_TRY_LOCK ((uintptr_t) 1)
+
+#define POSIX_MUTEX_ABSTIME_COND_RELOCK ((uintptr_t) 2)
+
+#define POSIX_MUTEX_FUTEX_UNLOCKED 0U
+
+#define POSIX_MUTEX_FUTEX_LOCKED 1U
+
+#define POSIX_MUTEX_FUTEX_CONTENDED 2U
 
 #define POSIX_MUTEX_MAGIC 0x961c13b8UL
 
@@ -133,6 +184,33 @@ static inline bool _POSIX_Mutex_Is_recursive(
   return ( flags & POSIX_MUTEX_RECURSIVE ) != 0;
 }
 
+static inline bool _POSIX_Mutex_Is_adaptive_spin(
+  unsigned long flags
+)
+{
+  return ( flags & POSIX_MUTEX_ADAPTIVE_SPIN ) != 0;
+}
+
+/**
+ * @brief Checks if the mutex uses the futex fast path.
+ *
+ * Mutexes without a locking protocol and without adaptive spinning are
+ * acquired and released through an atomic compare-and-swap operation in the
+ * uncontended case.  The thread queue is only used on contention.
+ *
+ * @param flags are the mutex flags.
+ *
+ * @return Returns true, if the mutex uses the futex fast path, otherwise
+ *   false.
+ */
+static inline bool _POSIX_Mutex_Is_futex(
+  unsigned long flags
+)
+{
+  return ( flags & ( POSIX_MUTEX_PROTOCOL_MASK | POSIX_MUTEX_ADAPTIVE_SPIN ) )
+    == 0;
+}
+
 static inline Thread_Control *_POSIX_Mutex_Get_owner(
   const POSIX_Mutex_Control *the_mutex
 )
@@ -213,6 +291,24 @@ static inline Status_Control _POSIX_Mutex_Seize(
     return status;
   }
 
+#if defined(RTEMS_SMP)
+  if (
+    _POSIX_Mutex_Is_adaptive_spin( flags )
+      && (uintptr_t) abstime != POSIX_MUTEX_ABSTIME_TRY_LOCK
+      && _Thread_queue_Spin_for_owner(
+        &the_mutex->Recursive.Mutex.Queue.Queue,
+        owner,
+        executing,
+        queue_context
+      )
+  ) {
+    _POSIX_Mutex_Set_owner( the_mutex, executing );
+    _Thread_Resource_count_increment( executing );
+    _POSIX_Mutex_Release( the_mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   return _POSIX_Mutex_Seize_slow(
     the_mutex,
     operations,
@@ -265,6 +361,118 @@ static inline Status_Control _POSIX_Mutex_Surrender(
   return STATUS_SUCCESSFUL;
 }
 
+static inline void _POSIX_Mutex_Futex_initialize(
+  POSIX_Mutex_Control *the_mutex
+)
+{
+  _Atomic_Init_uint( &the_mutex->Futex.state, POSIX_MUTEX_FUTEX_UNLOCKED );
+  the_mutex->Futex.morph_count = 0;
+  _Atomic_Init_uintptr( &the_mutex->Futex.morph_cond, 0 );
+  the_mutex->Futex.owner = NULL;
+}
+
+Status_Control _POSIX_Mutex_Futex_seize_slow(
+  POSIX_Mutex_Control          *the_mutex,
+  Thread_Control               *executing,
+  const struct timespec        *abstime,
+  Thread_queue_Enqueue_callout  enqueue_callout
+);
+
+static inline Status_Control _POSIX_Mutex_Futex_seize(
+  POSIX_Mutex_Control          *the_mutex,
+  unsigned long                 flags,
+  const struct timespec        *abstime,
+  Thread_queue_Enqueue_callout  enqueue_callout
+)
+{
+  Thread_Control *executing;
+  unsigned int    expected;
+
+  executing = _Thread_Get_executing();
+  expected = POSIX_MUTEX_FUTEX_UNLOCKED;
+
+  /*
+   * A thread which returns from a condition variable wait must not use the
+   * fast path.  It has to leave the contended state behind, so that its
+   * mutex release continues the wait morphing.
+   */
+  if (
+    RTEMS_PREDICT_TRUE(
+      (uintptr_t) abstime != POSIX_MUTEX_ABSTIME_COND_RELOCK
+        && _Atomic_Compare_exchange_uint(
+          &the_mutex->Futex.state,
+          &expected,
+          POSIX_MUTEX_FUTEX_LOCKED,
+          ATOMIC_ORDER_ACQUIRE,
+          ATOMIC_ORDER_RELAXED
+        )
+    )
+  ) {
+    the_mutex->Futex.owner = executing;
+    _Thread_Resource_count_increment( executing );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( the_mutex->Futex.owner == executing ) {
+    return _POSIX_Mutex_Lock_nested( the_mutex, flags );
+  }
+
+  if ( (uintptr_t) abstime == POSIX_MUTEX_ABSTIME_TRY_LOCK ) {
+    return STATUS_UNAVAILABLE;
+  }
+
+  return _POSIX_Mutex_Futex_seize_slow(
+    the_mutex,
+    executing,
+    abstime,
+    enqueue_callout
+  );
+}
+
+void _POSIX_Mutex_Futex_surrender_slow( POSIX_Mutex_Control *the_mutex );
+
+static inline Status_Control _POSIX_Mutex_Futex_surrender(
+  POSIX_Mutex_Control *the_mutex
+)
+{
+  Thread_Control *executing;
+  unsigned int    nest_level;
+  unsigned int    expected;
+
+  executing = _Thread_Get_executing();
+
+  if ( the_mutex->Futex.owner != executing ) {
+    return STATUS_NOT_OWNER;
+  }
+
+  nest_level = the_mutex->Recursive.nest_level;
+
+  if ( nest_level > 0 ) {
+    the_mutex->Recursive.nest_level = nest_level - 1;
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Thread_Resource_count_decrement( executing );
+  the_mutex->Futex.owner = NULL;
+  expected = POSIX_MUTEX_FUTEX_LOCKED;
+
+  if (
+    RTEMS_PREDICT_FALSE(
+      !_Atomic_Compare_exchange_uint(
+        &the_mutex->Futex.state,
+        &expected,
+        POSIX_MUTEX_FUTEX_UNLOCKED,
+        ATOMIC_ORDER_RELEASE,
+        ATOMIC_ORDER_RELAXED
+      )
+    )
+  ) {
+    _POSIX_Mutex_Futex_surrender_slow( the_mutex );
+  }
+
+  return STATUS_SUCCESSFUL;
+}
+
 static inline const Scheduler_Control *_POSIX_Mutex_Get_scheduler(
   const POSIX_Mutex_Control *the_mutex
 )
@@ -425,8 +633,6 @@ static inline Status_Control _POSIX_Mutex_Ceiling_surrender(
   );
 }
 
-#define POSIX_MUTEX_ABSTIME_TRY_LOCK ((uintptr_t) 1)
-
 int _POSIX_Mutex_Lock_support(
   pthread_mutex_t              *mutex,
   const struct timespec        *abstime,
@@ -41,10 +41,83 @@
 #include <rtems/posix/threadsup.h>
 #include <rtems/score/thread.h>
 
+#include <pthread.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if defined(_UNIX98_THREAD_MUTEX_ATTRIBUTES) && \
+  !defined(PTHREAD_MUTEX_ADAPTIVE_NP)
+/**
+ * @brief This non-portable mutex type selects a normal mutex with adaptive
+ *   spinning.
+ *
+ * In SMP configurations, a thread which tries to lock a mutex of this type
+ * spins while the owner executes on another processor before it blocks.  The
+ * time a thread spins is bounded by the application configuration option
+ * CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME.  In uniprocessor configurations, this
+ * type is equivalent to PTHREAD_MUTEX_NORMAL.
+ *
+ * The mutex type can be set by pthread_mutexattr_settype().  Mutexes with the
+ * PTHREAD_PRIO_PROTECT protocol do not support adaptive spinning.
+ */
+#define PTHREAD_MUTEX_ADAPTIVE_NP 4
+#endif
+
+/**
+ * @brief This non-portable reader-writer lock kind selects the default
+ *   reader-writer lock.
+ */
+#define PTHREAD_RWLOCK_DEFAULT_NP 0
+
+/**
+ * @brief This non-portable reader-writer lock kind selects a read-mostly
+ *   reader-writer lock.
+ *
+ * A read-mostly reader-writer lock is a big reader lock with a reader counter
+ * on each processor.  Read locks and unlocks do not write to a shared cache
+ * line as long as no writer is present.  Write locks are much more expensive
+ * than with the default reader-writer lock.  In addition to the other error
+ * conditions, pthread_rwlock_init() returns EAGAIN if too many read-mostly
+ * reader-writer locks are initialized, see RTEMS_BRLOCK_MAXIMUM_COUNT.  Read
+ * locks are recursive.  The read lock functions return EAGAIN if the read
+ * lock nest level of the calling thread would exceed 255.  The write lock
+ * functions return EDEADLK if the calling thread owns the lock for reading.
+ */
+#define PTHREAD_RWLOCK_READ_MOSTLY_NP 1
+
+/**
+ * @brief Sets the non-portable kind of the reader-writer lock attributes.
+ *
+ * @param[in, out] attr is the reader-writer lock attributes object.
+ *
+ * @param kind is the reader-writer lock kind.  It shall be
+ *   #PTHREAD_RWLOCK_DEFAULT_NP or #PTHREAD_RWLOCK_READ_MOSTLY_NP.
+ *
+ * @retval 0 The kind was set.
+ *
+ * @retval EINVAL The attributes object or the kind was invalid.
+ */
+int pthread_rwlockattr_setkind_np( pthread_rwlockattr_t *attr, int kind );
+
+/**
+ * @brief Gets the non-portable kind of the reader-writer lock attributes.
+ *
+ * @param attr is the reader-writer lock attributes object.
+ *
+ * @param[out] kind is the pointer to an integer variable.  The reader-writer
+ *   lock kind of the attributes object will be stored in this variable.
+ *
+ * @retval 0 The kind was stored.
+ *
+ * @retval EINVAL The attributes object or the kind pointer was invalid.
+ */
+int pthread_rwlockattr_getkind_np(
+  const pthread_rwlockattr_t *attr,
+  int                        *kind
+);
+
 /**
  * @defgroup POSIX_PTHREAD POSIX Threads Support
  *
@@ -38,6 +38,7 @@
 #ifndef _RTEMS_POSIX_RWLOCKIMPL_H
 #define _RTEMS_POSIX_RWLOCKIMPL_H
 
+#include <rtems/score/brlockimpl.h>
 #include <rtems/score/corerwlockimpl.h>
 
 #include <errno.h>
@@ -47,11 +48,24 @@
 extern "C" {
 #endif
 
+#define POSIX_RWLOCK_READ_MOSTLY 0x1UL
+
+#define POSIX_RWLOCK_FLAGS_MASK 0x1UL
+
 #define POSIX_RWLOCK_MAGIC 0x9621dabdUL
 
+/*
+ * The read-mostly kind is stored in the is_initialized member of the
+ * attributes.
+ */
+#define POSIX_RWLOCKATTR_READ_MOSTLY 0x2
+
 typedef struct {
   unsigned long flags;
-  CORE_RWLock_Control RWLock;
+  union {
+    CORE_RWLock_Control RWLock;
+    BRLock_Control BRLock;
+  };
 } POSIX_RWLock_Control;
 
 static inline POSIX_RWLock_Control *_POSIX_RWLock_Get(
@@ -61,6 +75,13 @@ static inline POSIX_RWLock_Control *_POSIX_RWLock_Get(
   return (POSIX_RWLock_Control *) rwlock;
 }
 
+static inline bool _POSIX_RWLock_Is_read_mostly(
+  const POSIX_RWLock_Control *the_rwlock
+)
+{
+  return ( the_rwlock->flags & POSIX_RWLOCK_READ_MOSTLY ) != 0;
+}
+
 bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
 
 #define POSIX_RWLOCK_VALIDATE_OBJECT( rw ) \
@@ -68,7 +89,11 @@ bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
     if ( ( rw ) == NULL ) { \
       return EINVAL; \
     } \
-    if ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) != ( rw )->flags ) { \
+    if ( \
+      ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) \
+          & ~POSIX_RWLOCK_FLAGS_MASK ) \
+        != ( ( rw )->flags & ~POSIX_RWLOCK_FLAGS_MASK ) \
+    ) { \
       if ( !_POSIX_RWLock_Auto_initialization( rw ) ) { \
         return EINVAL; \
       } \
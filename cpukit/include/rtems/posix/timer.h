@@ -64,10 +64,10 @@ typedef struct {
   char              state;      /* State of the timer                    */
   struct sigevent   inf;        /* Information associated to the timer   */
   struct itimerspec timer_data; /* Timing data of the timer              */
-  uint32_t          ticks;      /* Number of ticks of the initialization */
   uint32_t          overrun;    /* Number of expirations of the timer    */
   struct timespec   time;       /* Time at which the timer was started   */
   clockid_t         clock_type; /* The type of timer */
+  unsigned int      watchdog_header; /* Index of the watchdog header */
 } POSIX_Timer_Control;
 
 /**
@@ -40,6 +40,7 @@
 
 #include <rtems/posix/timer.h>
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/timecounter.h>
 #include <rtems/score/watchdogimpl.h>
 
 #ifdef __cplusplus
@@ -139,6 +140,49 @@ static inline void _POSIX_Timer_Release(
   _ISR_lock_ISR_enable( lock_context );
 }
 
+/**
+ * @brief Gets the watchdog header of the timer.
+ *
+ * Only a timer started with an absolute CLOCK_REALTIME expiration time uses
+ * the realtime watchdog header, so that it follows changes of the time of
+ * day.  All other timers including the periodic rearms use the monotonic
+ * watchdog header.
+ *
+ * @param ptimer is the timer.
+ *
+ * @param cpu is the processor of the timer watchdog.
+ *
+ * @return Returns the monotonic or realtime watchdog header of the processor
+ *   recorded for the timer.
+ */
+static inline Watchdog_Header *_POSIX_Timer_Get_watchdog_header(
+  const POSIX_Timer_Control *ptimer,
+  Per_CPU_Control           *cpu
+)
+{
+  return &cpu->Watchdog.Header[ ptimer->watchdog_header ];
+}
+
+/**
+ * @brief Gets the current time of the watchdog header of the timer.
+ *
+ * @param ptimer is the timer.
+ *
+ * @param[out] now is the current time of the clock of the watchdog header of
+ *   the timer.
+ */
+static inline void _POSIX_Timer_Get_now(
+  const POSIX_Timer_Control *ptimer,
+  struct timespec           *now
+)
+{
+  if ( ptimer->watchdog_header == PER_CPU_WATCHDOG_REALTIME ) {
+    _Timecounter_Nanotime( now );
+  } else {
+    _Timecounter_Nanouptime( now );
+  }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIRCU
+ *
+ * @brief This header file provides the read-copy update API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RCU_H
+#define _RTEMS_RCU_H
+
+#include <rtems/score/rcu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPIRCU Read-Copy Update
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief The read-copy update (RCU) directives support lock-free lookups in
+ *   read-mostly data structures.
+ *
+ * Readers access the data structure in a read-side critical section started
+ * by rtems_rcu_read_lock() and ended by rtems_rcu_read_unlock().  They load
+ * pointers to shared objects with RTEMS_RCU_DEREFERENCE().  A read-side
+ * critical section disables thread dispatching, so it must be short and shall
+ * not block.  In particular, a reader which wants to use an object beyond the
+ * read-side critical section has to obtain a reference to it inside the
+ * section.
+ *
+ * Updaters serialize themselves by other means, for example a mutex.  They
+ * publish new objects with RTEMS_RCU_PUBLISH().  Before an unpublished object
+ * may be reclaimed, the updater has to call rtems_rcu_synchronize().
+ *
+ * @{
+ */
+
+/**
+ * @brief Publishes the value to the pointer read by read-side critical
+ *   sections.
+ *
+ * @param _ptr is the address of the pointer to update.
+ *
+ * @param _value is the new pointer value.
+ */
+#define RTEMS_RCU_PUBLISH( _ptr, _value ) _RCU_Publish( _ptr, _value )
+
+/**
+ * @brief Loads a pointer published by RTEMS_RCU_PUBLISH() in a read-side
+ *   critical section.
+ *
+ * @param _ptr is the address of the pointer to load.
+ *
+ * @return Returns the pointer value.  The referenced object is valid until
+ *   the end of the read-side critical section.
+ */
+#define RTEMS_RCU_DEREFERENCE( _ptr ) _RCU_Dereference( _ptr )
+
+/**
+ * @brief Begins a read-side critical section.
+ *
+ * Read-side critical sections may be nested.
+ */
+void rtems_rcu_read_lock( void );
+
+/**
+ * @brief Ends a read-side critical section.
+ */
+void rtems_rcu_read_unlock( void );
+
+/**
+ * @brief Waits until all read-side critical sections which started before
+ *   the call ended.
+ *
+ * This directive shall not be called in a read-side critical section or from
+ * within interrupt context.  In uniprocessor configurations, this directive
+ * returns immediately.
+ */
+void rtems_rcu_synchronize( void );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_RCU_H */
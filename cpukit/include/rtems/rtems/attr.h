@@ -72,6 +72,24 @@ extern "C" {
  * @brief This group contains the Classic API directive attributes.
  */
 
+/* Generated from spec:/rtems/attr/if/adaptive-spin */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that a task which obtains the
+ *   Classic API mutex created by rtems_semaphore_create() shall spin while
+ *   the owner of the mutex executes on another processor before it blocks.
+ *
+ * @par Notes
+ * The attribute can be used for binary semaphores using no locking protocol
+ * or the priority inheritance locking protocol.  The time a task spins is
+ * bounded by the application configuration option
+ * #CONFIGURE_MUTEX_ADAPTIVE_SPIN_TIME.  The attribute has no effect in
+ * uniprocessor configurations.
+ */
+#define RTEMS_ADAPTIVE_SPIN 0x00001000
+
 /* Generated from spec:/rtems/attr/if/application-task */
 
 /**
@@ -211,6 +229,25 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_LOCAL 0x00000000
 
+/* Generated from spec:/rtems/attr/if/message-reference */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API message queue
+ *   created by rtems_message_queue_create() or rtems_message_queue_construct()
+ *   shall pass buffers by reference.
+ *
+ * @par Notes
+ * The maximum message size of the message queue shall be equal to the size of
+ * ::rtems_message_queue_reference.  Only
+ * rtems_message_queue_send_reference() and
+ * rtems_message_queue_receive_reference() may be used to exchange messages
+ * through the message queue.  The attribute cannot be combined with
+ * #RTEMS_GLOBAL.
+ */
+#define RTEMS_MESSAGE_REFERENCE 0x00004000
+
 /* Generated from spec:/rtems/attr/if/multiprocessor-resource-sharing */
 
 /**
@@ -283,6 +320,24 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_PRIORITY 0x00000004
 
+/* Generated from spec:/rtems/attr/if/priority-bit-map */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API semaphore
+ *   created by rtems_semaphore_create() shall manage blocking tasks using a
+ *   priority bit map with constant time enqueue and dequeue operations.
+ *
+ * @par Notes
+ * The attribute can be used for counting and simple binary semaphores which
+ * use the task priority discipline (#RTEMS_PRIORITY).  It cannot be used for
+ * global semaphores.  Tasks with equal priorities are dequeued in FIFO order.
+ * Tasks with a priority greater than 255 share the queue of priority 255.  The
+ * priority bit map is allocated from the RTEMS Workspace.
+ */
+#define RTEMS_PRIORITY_BIT_MAP 0x00002000
+
 /* Generated from spec:/rtems/attr/if/priority-ceiling */
 
 /**
@@ -318,6 +373,38 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_SIMPLE_BINARY_SEMAPHORE 0x00000020
 
+/* Generated from spec:/rtems/attr/if/single-consumer */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that only one task receives
+ *   messages from the Classic API message queue created by
+ *   rtems_message_queue_create() or rtems_message_queue_construct().
+ *
+ * @par Notes
+ * The message queue uses a lock-free ring of message buffers.  The maximum
+ * pending messages of the message queue shall be a power of two.  The
+ * attribute cannot be combined with #RTEMS_GLOBAL.
+ */
+#define RTEMS_SINGLE_CONSUMER 0x00000400
+
+/* Generated from spec:/rtems/attr/if/single-producer */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that only one task or interrupt
+ *   service routine sends messages to the Classic API message queue created
+ *   by rtems_message_queue_create() or rtems_message_queue_construct().
+ *
+ * @par Notes
+ * The attribute shall be combined with #RTEMS_SINGLE_CONSUMER.  The senders
+ * of a single producer message queue do not need an atomic read-modify-write
+ * operation to reserve a message buffer.
+ */
+#define RTEMS_SINGLE_PRODUCER 0x00000800
+
 /* Generated from spec:/rtems/attr/if/system-task */
 
 /**
@@ -146,6 +146,76 @@ static inline bool _Attributes_Is_priority(
    return ( attribute_set & RTEMS_PRIORITY ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the message reference attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the message reference attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_message_reference(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_MESSAGE_REFERENCE ) ? true : false;
+}
+
+/**
+ *  @brief Checks if the single consumer attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the single consumer attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_single_consumer(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SINGLE_CONSUMER ) ? true : false;
+}
+
+/**
+ *  @brief Checks if the single producer attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the single producer attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_single_producer(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SINGLE_PRODUCER ) ? true : false;
+}
+
+/**
+ *  @brief Checks if the adaptive spin attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the adaptive spin attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_adaptive_spin(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_ADAPTIVE_SPIN ) ? true : false;
+}
+
+/**
+ *  @brief Checks if the priority bit map attribute is enabled in the
+ *  attribute_set.
+ *
+ *  This function returns TRUE if the priority bit map attribute is
+ *  enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_priority_bit_map(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_PRIORITY_BIT_MAP ) ? true : false;
+}
+
 /**
  *  @brief Checks if the binary semaphore attribute is
  *  enabled in the attribute_set.
@@ -176,7 +176,11 @@ typedef struct {
  *   and
  *
  * * the task wait queue discipline used by the message queue: #RTEMS_FIFO
- *   (default) or #RTEMS_PRIORITY.
+ *   (default) or #RTEMS_PRIORITY and
+ *
+ * * the message queue implementation: the default implementation,
+ *   #RTEMS_SINGLE_CONSUMER, or #RTEMS_SINGLE_CONSUMER combined with
+ *   #RTEMS_SINGLE_PRODUCER.
  *
  * The message queue has a local or global **scope** in a multiprocessing
  * network (this attribute does not refer to SMP systems).  The scope is
@@ -200,6 +204,18 @@ typedef struct {
  *
  * * The **priority discipline** is selected by the #RTEMS_PRIORITY attribute.
  *
+ * The **single consumer** implementation is selected by the
+ * #RTEMS_SINGLE_CONSUMER attribute.  The messages are exchanged through a
+ * lock-free ring.  The message queue lock is only used if the receiving task
+ * has to block.  Only one task may receive messages from the message queue.
+ * The ``count`` shall be a power of two.  Messages cannot be sent urgently.
+ * If in addition the #RTEMS_SINGLE_PRODUCER attribute is set, then at most
+ * one task or interrupt service routine may send messages at a time.
+ *
+ * The #RTEMS_MESSAGE_REFERENCE attribute selects a message queue which passes
+ * buffers by reference.  The ``max_message_size`` shall be the size of
+ * ::rtems_message_queue_reference.
+ *
  * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
  *
  * @retval ::RTEMS_INVALID_NAME The ``name`` parameter was invalid.
@@ -208,8 +224,24 @@ typedef struct {
  *
  * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was invalid.
  *
+ * @retval ::RTEMS_INVALID_NUMBER The #RTEMS_SINGLE_CONSUMER attribute was set
+ *   and the ``count`` parameter was not a power of two.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The #RTEMS_SINGLE_PRODUCER attribute was set
+ *   without the #RTEMS_SINGLE_CONSUMER attribute.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The #RTEMS_SINGLE_CONSUMER attribute was set for
+ *   a message queue with a global scope.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The #RTEMS_MESSAGE_REFERENCE attribute was set
+ *   for a message queue with a global scope.
+ *
  * @retval ::RTEMS_INVALID_SIZE The ``max_message_size`` parameter was invalid.
  *
+ * @retval ::RTEMS_INVALID_SIZE The #RTEMS_MESSAGE_REFERENCE attribute was set
+ *   and the ``max_message_size`` parameter was not equal to the size of
+ *   ::rtems_message_queue_reference.
+ *
  * @retval ::RTEMS_TOO_MANY There was no inactive object available to create a
  *   message queue.  The number of message queue available to the application
  *   is configured through the @ref CONFIGURE_MAXIMUM_MESSAGE_QUEUES
@@ -310,6 +342,13 @@ rtems_status_code rtems_message_queue_create(
  * @retval ::RTEMS_INVALID_SIZE The maximum message size in the configuration
  *   was zero.
  *
+ * @retval ::RTEMS_INVALID_SIZE The #RTEMS_MESSAGE_REFERENCE attribute was set
+ *   in the configuration and the maximum message size in the configuration
+ *   was not equal to the size of ::rtems_message_queue_reference.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The #RTEMS_MESSAGE_REFERENCE attribute was set
+ *   in the configuration for a message queue with a global scope.
+ *
  * @retval ::RTEMS_TOO_MANY There was no inactive message queue object
  *   available to construct a message queue.
  *
@@ -558,6 +597,9 @@ rtems_status_code rtems_message_queue_delete( rtems_id id );
  *   the queue as defined by rtems_message_queue_create() or
  *   rtems_message_queue_construct() has been reached.
  *
+ * @retval ::RTEMS_NOT_DEFINED The queue was created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
  * @par Constraints
  * @parblock
  * The following constraints apply to this directive:
@@ -615,6 +657,12 @@ rtems_status_code rtems_message_queue_send(
  *   the queue as defined by rtems_message_queue_create() or
  *   rtems_message_queue_construct() has been reached.
  *
+ * @retval ::RTEMS_NOT_DEFINED The queue was created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The queue was created with the
+ *   #RTEMS_SINGLE_CONSUMER attribute.
+ *
  * @par Constraints
  * @parblock
  * The following constraints apply to this directive:
@@ -673,6 +721,9 @@ rtems_status_code rtems_message_queue_urgent(
  *   message size of the queue as defined by rtems_message_queue_create() or
  *   rtems_message_queue_construct().
  *
+ * @retval ::RTEMS_NOT_DEFINED The queue was created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
  * @par Notes
  * The execution time of this directive is directly related to the number of
  * tasks waiting on the message queue, although it is more efficient than the
@@ -782,6 +833,9 @@ rtems_status_code rtems_message_queue_broadcast(
  * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
  *   task was waiting to receive a message.
  *
+ * @retval ::RTEMS_NOT_DEFINED The queue was created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
  * @par Constraints
  * @parblock
  * The following constraints apply to this directive:
@@ -810,6 +864,176 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval timeout
 );
 
+/* Generated from spec:/rtems/message/if/reference */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief This structure defines the message of a message queue which passes
+ *   buffers by reference.
+ *
+ * @par Notes
+ * A message queue passes buffers by reference, if it was created with the
+ * #RTEMS_MESSAGE_REFERENCE attribute.  Its maximum message size is the size
+ * of this structure.  Use rtems_message_queue_send_reference() and
+ * rtems_message_queue_receive_reference() to exchange the buffers.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the begin address of the referenced buffer.
+   */
+  void *begin;
+
+  /**
+   * @brief This member contains the size in bytes of the referenced buffer.
+   */
+  size_t size;
+} rtems_message_queue_reference;
+
+/* Generated from spec:/rtems/message/if/send-reference */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Passes the ownership of the buffer to the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the buffer to pass.
+ *
+ * @param size is the size in bytes of the buffer to pass.
+ *
+ * This directive sends a reference to the buffer ``buffer`` of ``size`` bytes
+ * in length to the queue specified by ``id``.  The content of the buffer is
+ * not copied.  If a task is waiting at the queue, then the reference is
+ * handed over to the waiting task and the task is unblocked.  Otherwise, the
+ * reference is placed at the rear of the queue.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The queue was not created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages supported by
+ *   the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct() has been reached.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @par Notes
+ * @parblock
+ * When the directive call is successful, the ownership of the buffer passes
+ * from the caller to the receiver.  The caller shall not access the buffer
+ * afterwards.  The buffer may be obtained for example from a partition or a
+ * red-black tree heap.  The receiver is responsible to give the buffer back
+ * to its origin.
+ *
+ * The message queue provides the memory ordering required to access the
+ * buffer content by the receiver on another processor.
+ *
+ * References pending on the queue are dropped without notice if the queue is
+ * flushed or deleted.
+ * @endparblock
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_reference(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/* Generated from spec:/rtems/message/if/receive-reference */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Takes the ownership of a buffer from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a void pointer object.  When the
+ *   directive call is successful, the begin address of the received buffer
+ *   will be stored in this object.
+ *
+ * @param[out] size is the pointer to a size_t object.  When the directive call
+ *   is successful, the size in bytes of the received buffer will be stored in
+ *   this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives a buffer reference sent by
+ * rtems_message_queue_send_reference() from the queue specified by ``id``.
+ * The options and the blocking behaviour are the same as for
+ * rtems_message_queue_receive().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``size`` parameter was NULL.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The queue was not created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @par Notes
+ * When the directive call is successful, the caller owns the received buffer.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_reference(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
 /* Generated from spec:/rtems/message/if/get-number-pending */
 
 /**
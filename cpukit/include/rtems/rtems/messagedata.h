@@ -60,6 +60,11 @@ typedef struct {
   Objects_Control             Object;
   /** This field is the instance of the SuperCore Message Queue. */
   CORE_message_queue_Control  message_queue;
+  /**
+   * This field is true if the message queue passes buffers by reference, see
+   * #RTEMS_MESSAGE_REFERENCE.
+   */
+  bool                        is_reference;
 #if defined(RTEMS_MULTIPROCESSING)
   /** This field is true if the message queue is offered globally */
   bool                        is_global;
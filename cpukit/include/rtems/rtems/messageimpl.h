@@ -104,6 +104,21 @@ static inline void _Message_queue_Free (
   _Objects_Free( &_Message_queue_Information, &the_message_queue->Object );
 }
 
+/**
+ * @brief Checks if the message queue passes buffers by reference.
+ *
+ * @param the_message_queue is the message queue to check.
+ *
+ * @return Returns true, if the message queue was created with the
+ *   #RTEMS_MESSAGE_REFERENCE attribute, otherwise false.
+ */
+static inline bool _Message_queue_Is_reference_queue(
+  const Message_queue_Control *the_message_queue
+)
+{
+  return the_message_queue->is_reference;
+}
+
 static inline Message_queue_Control *_Message_queue_Get(
   Objects_Id            id,
   Thread_queue_Context *queue_context
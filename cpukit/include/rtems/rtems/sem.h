@@ -118,7 +118,8 @@ extern "C" {
  * * the scope of the semaphore: #RTEMS_LOCAL (default) or #RTEMS_GLOBAL,
  *
  * * the task wait queue discipline used by the semaphore: #RTEMS_FIFO
- *   (default) or #RTEMS_PRIORITY,
+ *   (default) or #RTEMS_PRIORITY optionally combined with
+ *   #RTEMS_PRIORITY_BIT_MAP,
  *
  * * the class of the semaphore: #RTEMS_COUNTING_SEMAPHORE (default),
  *   #RTEMS_BINARY_SEMAPHORE, or #RTEMS_SIMPLE_BINARY_SEMAPHORE, and
@@ -147,6 +148,11 @@ extern "C" {
  * * The **priority discipline** is selected by the #RTEMS_PRIORITY attribute.
  *   The locking protocols require the priority discipline.
  *
+ * * The **priority bit map discipline** is selected by the #RTEMS_PRIORITY and
+ *   #RTEMS_PRIORITY_BIT_MAP attributes.  It is a priority discipline with
+ *   constant time enqueue and dequeue operations.  Only local counting and
+ *   simple binary semaphores may use it.
+ *
  * The **semaphore class** is selected by the mutually exclusive
  * #RTEMS_COUNTING_SEMAPHORE, #RTEMS_BINARY_SEMAPHORE, and
  * #RTEMS_SIMPLE_BINARY_SEMAPHORE attributes.
@@ -214,6 +220,10 @@ extern "C" {
  * @retval ::RTEMS_INVALID_PRIORITY The ``priority_ceiling`` parameter was
  *   invalid.
  *
+ * @retval ::RTEMS_UNSATISFIED There was not enough memory in the RTEMS
+ *   Workspace to allocate the priority bit map of a semaphore created with the
+ *   #RTEMS_PRIORITY_BIT_MAP attribute.
+ *
  * @par Notes
  * @parblock
  * For control and maintenance of the semaphore, RTEMS allocates a SMCB from
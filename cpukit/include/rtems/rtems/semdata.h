@@ -96,6 +96,18 @@ typedef struct {
      */
     CORE_semaphore_Control Semaphore;
 
+    /**
+     * @brief This is the SuperCore Semaphore instance and the thread queue
+     *   priority bit map of a semaphore created with the
+     *   #RTEMS_PRIORITY_BIT_MAP attribute.
+     *
+     * The priority bit map is allocated from the RTEMS Workspace.
+     */
+    struct {
+      CORE_semaphore_Control         Semaphore;
+      Thread_queue_Priority_bit_map *bit_map;
+    } Priority_bit_map;
+
 #if defined(RTEMS_SMP)
     MRSP_Control MRSP;
 #endif
@@ -107,6 +119,28 @@ typedef struct {
  */
 extern Objects_Information _Semaphore_Information;
 
+/**
+ * @brief Maps the specified object identifier to the associated local Classic
+ *   Semaphore object.
+ *
+ * This function has the semantics of _Objects_Get() for
+ * ::_Semaphore_Information.  It is defined by <rtems/confdefs.h> through
+ * OBJECTS_GET_CONFIGURED_DEFINE() for the configured object maximum.
+ *
+ * @param id is the object identifier.
+ *
+ * @param lock_context is the interrupt lock context.
+ *
+ * @retval pointer The pointer to the associated object.  Interrupts are
+ *   disabled.
+ *
+ * @retval NULL No associated object exists.
+ */
+Objects_Control *_Semaphore_Get_configured(
+  Objects_Id        id,
+  ISR_lock_Context *lock_context
+);
+
 #if defined(RTEMS_MULTIPROCESSING)
 /**
  *  @brief Semaphore MP Send Extract Proxy
@@ -139,6 +139,30 @@ static inline uintptr_t _Semaphore_Make_global( uintptr_t flags )
 }
 #endif
 
+static inline bool _Semaphore_Is_adaptive_spin(
+  uintptr_t flags
+)
+{
+  return ( flags & 0x20 ) != 0;
+}
+
+static inline uintptr_t _Semaphore_Make_adaptive_spin( uintptr_t flags )
+{
+  return flags | 0x20;
+}
+
+static inline bool _Semaphore_Is_priority_bit_map(
+  uintptr_t flags
+)
+{
+  return ( flags & 0x40 ) != 0;
+}
+
+static inline uintptr_t _Semaphore_Make_priority_bit_map( uintptr_t flags )
+{
+  return flags | 0x40;
+}
+
 static inline const Thread_queue_Operations *_Semaphore_Get_operations(
   uintptr_t flags
 )
@@ -149,6 +173,10 @@ static inline const Thread_queue_Operations *_Semaphore_Get_operations(
     return &_Thread_queue_Operations_priority_inherit;
   }
 
+  if ( _Semaphore_Is_priority_bit_map( flags ) ) {
+    return &_Thread_queue_Operations_priority_bit_map;
+  }
+
   if ( _Semaphore_Get_discipline( flags ) == SEMAPHORE_DISCIPLINE_PRIORITY ) {
     return &_Thread_queue_Operations_priority;
   }
@@ -188,10 +216,9 @@ static inline Semaphore_Control *_Semaphore_Get(
 )
 {
   _Thread_queue_Context_initialize( queue_context );
-  return (Semaphore_Control *) _Objects_Get(
+  return (Semaphore_Control *) _Semaphore_Get_configured(
     id,
-    &queue_context->Lock_context.Lock_context,
-    &_Semaphore_Information
+    &queue_context->Lock_context.Lock_context
   );
 }
 
@@ -133,6 +133,28 @@ void _RTEMS_tasks_Construct_user_task( void );
  */
 extern Thread_Information _RTEMS_tasks_Information;
 
+/**
+ * @brief Maps the specified object identifier to the associated local Classic
+ *   API task.
+ *
+ * This function has the semantics of _Objects_Get() for
+ * ::_RTEMS_tasks_Information.  It is defined by <rtems/confdefs.h> through
+ * OBJECTS_GET_CONFIGURED_DEFINE() for the configured object maximum.
+ *
+ * @param id is the object identifier.
+ *
+ * @param lock_context is the interrupt lock context.
+ *
+ * @retval pointer The pointer to the associated thread object.  Interrupts
+ *   are disabled.
+ *
+ * @retval NULL No associated object exists.
+ */
+Objects_Control *_RTEMS_tasks_Get_configured(
+  Objects_Id        id,
+  ISR_lock_Context *lock_context
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -85,6 +85,34 @@ static inline Thread_Control *_RTEMS_tasks_Allocate(void)
     _Objects_Allocate_unprotected( &_RTEMS_tasks_Information.Objects );
 }
 
+/**
+ * @brief Gets the thread associated with the identifier.
+ *
+ * Classic API task identifiers are looked up through
+ * _RTEMS_tasks_Get_configured().  All other identifiers are looked up through
+ * _Thread_Get().
+ *
+ * @param id is the thread identifier.
+ *
+ * @param lock_context is the interrupt lock context.
+ *
+ * @retval pointer The pointer to the associated thread.  Interrupts are
+ *   disabled.
+ *
+ * @retval NULL No associated thread exists.
+ */
+static inline Thread_Control *_RTEMS_tasks_Get(
+  Objects_Id        id,
+  ISR_lock_Context *lock_context
+)
+{
+  if ( _Objects_Get_API( id ) == OBJECTS_CLASSIC_API ) {
+    return (Thread_Control *) _RTEMS_tasks_Get_configured( id, lock_context );
+  }
+
+  return _Thread_Get( id, lock_context );
+}
+
 /**
  * @brief Converts the RTEMS API priority to the corresponding SuperCore
  * priority and validates it.
@@ -0,0 +1,241 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIClassicThreadPool
+ *
+ * @brief This header file defines the Thread Pool Manager API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RTEMS_THREADPOOL_H
+#define _RTEMS_RTEMS_THREADPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/cpuset.h>
+#include <rtems/rtems/attr.h>
+#include <rtems/rtems/modes.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/rtems/types.h>
+#include <rtems/score/threadpool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSAPIClassicThreadPool Thread Pool Manager
+ *
+ * @ingroup RTEMSAPIClassic
+ *
+ * @brief The Thread Pool Manager provides worker tasks which carry out
+ *   submitted work items.
+ *
+ * The worker tasks of a thread pool are created and started once by
+ * rtems_thread_pool_create().  Idle workers wait for work items with their
+ * stack and thread-local storage already set up.  The submission of a work
+ * item by rtems_thread_pool_submit() needs a constant time and does not
+ * create a task.  This is considerably faster than a task creation, start,
+ * and deletion for each request.
+ *
+ * @{
+ */
+
+/**
+ * @brief This type represents a thread pool.
+ *
+ * The storage of a thread pool is provided by the application.  It shall be
+ * valid until rtems_thread_pool_delete() returned.
+ */
+typedef Thread_pool_Control rtems_thread_pool;
+
+/**
+ * @brief This type represents a thread pool work item.
+ *
+ * The work item may be embedded in a structure of the application.  Use
+ * RTEMS_CONTAINER_OF() in the handler to get the structure.
+ */
+typedef Thread_pool_Work rtems_thread_pool_work;
+
+/**
+ * @brief This type defines the handler of a thread pool work item.
+ *
+ * The handler is called by a worker task of the thread pool.
+ */
+typedef Thread_pool_Handler rtems_thread_pool_handler;
+
+/**
+ * @brief This structure defines the configuration of a thread pool created
+ *   by rtems_thread_pool_create().
+ */
+typedef struct {
+  /**
+   * @brief This member defines the name of the worker tasks.
+   */
+  rtems_name name;
+
+  /**
+   * @brief This member defines the count of worker tasks.
+   */
+  uint32_t worker_count;
+
+  /**
+   * @brief This member defines the initial priority of the worker tasks.
+   */
+  rtems_task_priority initial_priority;
+
+  /**
+   * @brief This member defines the stack size of the worker tasks.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief This member defines the initial modes of the worker tasks.
+   */
+  rtems_mode initial_modes;
+
+  /**
+   * @brief This member defines the attribute set of the worker tasks.
+   */
+  rtems_attribute attributes;
+
+  /**
+   * @brief This member defines the size of the processor affinity set.
+   */
+  size_t affinity_size;
+
+  /**
+   * @brief This member defines the processor affinity set of the worker
+   *   tasks.
+   *
+   * If this member is NULL, then the worker tasks use the default processor
+   * affinity.
+   */
+  const cpu_set_t *affinity;
+} rtems_thread_pool_config;
+
+/**
+ * @brief Creates a thread pool.
+ *
+ * @param[out] pool is the thread pool to create.
+ *
+ * @param config is the thread pool configuration.
+ *
+ * The worker tasks of the thread pool are created by rtems_task_create() and
+ * count against the @ref CONFIGURE_MAXIMUM_TASKS application configuration
+ * option.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``pool`` or ``config`` parameter was
+ *   NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The worker count was zero.
+ *
+ * @return Returns the status of rtems_task_create() or
+ *   rtems_task_set_affinity() if a worker task could not be created or
+ *   configured.  In this case, the already created worker tasks are deleted.
+ */
+rtems_status_code rtems_thread_pool_create(
+  rtems_thread_pool              *pool,
+  const rtems_thread_pool_config *config
+);
+
+/**
+ * @brief Initializes the thread pool work item.
+ *
+ * @param[out] work is the work item to initialize.
+ *
+ * @param handler is the handler of the work item.
+ *
+ * @param arg is the argument of the work item.  It is not used by the thread
+ *   pool and may be used by the handler.
+ */
+static inline void rtems_thread_pool_work_initialize(
+  rtems_thread_pool_work    *work,
+  rtems_thread_pool_handler  handler,
+  void                      *arg
+)
+{
+  _Thread_pool_Work_initialize( work, handler, arg );
+}
+
+/**
+ * @brief Submits the work item to the thread pool.
+ *
+ * @param[in, out] pool is the thread pool.
+ *
+ * @param[in, out] work is the work item to submit.  It shall not be
+ *   submitted again before its handler was called.
+ *
+ * The work item is handed over to an idle worker task.  If no worker task is
+ * idle, then the work item is carried out by the next worker task which
+ * finished its current work item.  The work items are carried out in
+ * submission order.
+ *
+ * This directive may be called from within interrupt context.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``pool`` or ``work`` parameter was
+ *   NULL.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The thread pool was deleted.
+ */
+rtems_status_code rtems_thread_pool_submit(
+  rtems_thread_pool      *pool,
+  rtems_thread_pool_work *work
+);
+
+/**
+ * @brief Deletes the thread pool.
+ *
+ * @param[in, out] pool is the thread pool to delete.
+ *
+ * The pending work items are carried out by the worker tasks before they
+ * exit.  This directive returns after all worker tasks stopped to use the
+ * thread pool.  It shall not be called by a worker task of the thread pool.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``pool`` parameter was NULL.
+ *
+ * @retval ::RTEMS_CALLED_FROM_ISR The directive was called from within
+ *   interrupt context.
+ */
+rtems_status_code rtems_thread_pool_delete( rtems_thread_pool *pool );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_RTEMS_THREADPOOL_H */
@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISchedulerStatistics
+ *
+ * @brief This header file provides the Scheduler Statistics API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCHEDULERSTATS_H
+#define _RTEMS_SCHEDULERSTATS_H
+
+#include <stdint.h>
+
+#include <rtems/print.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/tasks.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPISchedulerStatistics Scheduler Statistics
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief The scheduler statistics support offers functions to report why and
+ * how long threads waited for a processor.
+ *
+ * Scheduler statistics are by default disabled.  They must be enabled by the
+ * RTEMS_SCHEDULER_STATISTICS build configuration option.  In this case, the
+ * RTEMS_SCHEDULER_STATISTICS pre-processor symbol is defined and the
+ * statistics are gathered for each scheduler instance during system run-time.
+ * The overhead is one relaxed atomic increment per scheduler operation and a
+ * few more per thread switch, so that the statistics may be enabled in
+ * production systems.  If disabled, the instrumentation is compiled out.
+ *
+ * The wake-up latency of a thread is the time interval from the unblock
+ * operation of the thread to the thread switch to it.  For each scheduler
+ * instance and each user priority, a histogram of wake-up latencies with
+ * logarithmic buckets is maintained.  Latencies are attributed to the
+ * scheduler instance owning the processor which switched to the thread and to
+ * the priority of the thread at the thread switch.
+ *
+ * The functions of this group are always available, but return
+ * ::RTEMS_NOT_IMPLEMENTED if the statistics are disabled at build
+ * configuration time.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the count of user priorities with a separate
+ *   wake-up latency histogram.
+ *
+ * Latencies of threads with a priority greater than or equal to this constant
+ * are recorded in the histogram of the priority
+ * #RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT minus one.
+ */
+#define RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT 256
+
+/**
+ * @brief This constant defines the count of buckets of a wake-up latency
+ *   histogram.
+ */
+#define RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT 32
+
+/**
+ * @brief Scheduler operation and thread switch counters of a scheduler
+ *   instance.
+ *
+ * All counters may overflow.
+ */
+typedef struct {
+  /**
+   * @brief Count of block operations.
+   */
+  uint32_t blocks;
+
+  /**
+   * @brief Count of unblock operations.
+   */
+  uint32_t unblocks;
+
+  /**
+   * @brief Count of thread priority update operations.
+   */
+  uint32_t priority_updates;
+
+  /**
+   * @brief Count of ask for help operations of the scheduler helping
+   *   protocol.
+   */
+  uint32_t help_requests;
+
+  /**
+   * @brief Count of thread switches on processors owned by the scheduler.
+   */
+  uint32_t switches;
+
+  /**
+   * @brief Count of thread switches on processors owned by the scheduler for
+   *   which the previously executing thread was still ready.
+   *
+   * This includes thread switches caused by a yield of the executing thread.
+   */
+  uint32_t preemptions;
+} rtems_scheduler_statistics;
+
+/**
+ * @brief Wake-up latency histogram.
+ */
+typedef struct {
+  /**
+   * @brief Count of wake-up latencies for each bucket.
+   *
+   * The bucket with index zero counts latencies less than two CPU counter
+   * ticks.  The bucket with index i > 0 counts latencies in the interval
+   * [2^i, 2^(i + 1)) CPU counter ticks.  Use
+   * rtems_scheduler_latency_bucket_lower_bound() to get the bucket bounds in
+   * nanoseconds.
+   */
+  uint32_t counts[ RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT ];
+} rtems_scheduler_latency_histogram;
+
+/**
+ * @brief Gets the operation and thread switch counters of the scheduler.
+ *
+ * @param scheduler_id is the scheduler identifier.
+ *
+ * @param[out] statistics is the pointer to an object to store the counters.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The @a statistics parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no scheduler associated with the
+ *   identifier specified by @a scheduler_id.
+ *
+ * @retval ::RTEMS_NOT_IMPLEMENTED The scheduler statistics are disabled.
+ */
+rtems_status_code rtems_scheduler_get_statistics(
+  rtems_id                    scheduler_id,
+  rtems_scheduler_statistics *statistics
+);
+
+/**
+ * @brief Gets the wake-up latency histogram of the priority of the scheduler.
+ *
+ * @param scheduler_id is the scheduler identifier.
+ *
+ * @param priority is the user priority of the histogram.
+ *
+ * @param[out] histogram is the pointer to an object to store the histogram.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The @a histogram parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no scheduler associated with the
+ *   identifier specified by @a scheduler_id.
+ *
+ * @retval ::RTEMS_INVALID_PRIORITY The priority was greater than or equal to
+ *   #RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT.
+ *
+ * @retval ::RTEMS_NOT_IMPLEMENTED The scheduler statistics are disabled.
+ */
+rtems_status_code rtems_scheduler_get_latency_histogram(
+  rtems_id                           scheduler_id,
+  rtems_task_priority                priority,
+  rtems_scheduler_latency_histogram *histogram
+);
+
+/**
+ * @brief Resets the statistics of the scheduler.
+ *
+ * Concurrent updates of the statistics may get lost.
+ *
+ * @param scheduler_id is the scheduler identifier.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no scheduler associated with the
+ *   identifier specified by @a scheduler_id.
+ *
+ * @retval ::RTEMS_NOT_IMPLEMENTED The scheduler statistics are disabled.
+ */
+rtems_status_code rtems_scheduler_reset_statistics( rtems_id scheduler_id );
+
+/**
+ * @brief Gets the lower bound of the wake-up latency histogram bucket.
+ *
+ * @param bucket is the bucket index.  It shall be less than
+ *   #RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT.
+ *
+ * @return Returns the lower bound of the bucket in nanoseconds.  The upper
+ *   bound of a bucket is the lower bound of the next bucket.
+ */
+uint64_t rtems_scheduler_latency_bucket_lower_bound( uint32_t bucket );
+
+/**
+ * @brief Reports the statistics of all schedulers.
+ *
+ * Only the wake-up latency histograms with at least one sample are reported.
+ *
+ * @param[in] printer is the RTEMS printer to send the output to.
+ *
+ * @returns As specified by printf().
+ */
+int rtems_scheduler_statistics_report( const rtems_printer *printer );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCHEDULERSTATS_H */
@@ -0,0 +1,109 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRLock
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreBRLock which are used by the implementation and the API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_BRLOCK_H
+#define _RTEMS_SCORE_BRLOCK_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/threadq.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreBRLock Big Reader Lock
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the big reader lock implementation.
+ *
+ * A big reader lock is a reader-writer lock optimized for read-mostly data.
+ * Each lock has a reader counter on each processor.  Readers increment and
+ * decrement the counter of the processor on which they execute, so that
+ * readers on different processors do not write to a shared cache line as long
+ * as no writer is present.  A writer announces itself and then waits until
+ * the sum of all reader counters of the lock is zero.  Writers are
+ * considerably more expensive than readers.
+ *
+ * The per-processor reader counters are provided by a per-processor array
+ * with #BRLOCK_MAXIMUM_COUNT entries.  Each initialized big reader lock
+ * occupies one entry.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the maximum count of concurrently initialized
+ *   big reader locks.
+ */
+#define BRLOCK_MAXIMUM_COUNT 32
+
+/**
+ * @brief This structure represents a big reader lock.
+ */
+typedef struct {
+  /**
+   * @brief This member is the thread queue of the lock.
+   *
+   * Readers and writers block on this thread queue while a writer is present.
+   * A writer waits on this thread queue until the readers drained.  The owner
+   * of the thread queue is the writer which owns the lock.
+   */
+  Thread_queue_Queue Queue;
+
+  /**
+   * @brief This member is non-zero, if a writer is present.
+   *
+   * A writer is present while it waits for the readers to drain and while it
+   * owns the lock.
+   */
+  Atomic_Uint writer;
+
+  /**
+   * @brief This member is the index of the per-processor reader counters of
+   *   the lock.
+   */
+  unsigned int slot;
+} BRLock_Control;
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_BRLOCK_H */
@@ -0,0 +1,182 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRLock
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreBRLock which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_BRLOCKIMPL_H
+#define _RTEMS_SCORE_BRLOCKIMPL_H
+
+#include <rtems/score/brlock.h>
+#include <rtems/score/status.h>
+#include <rtems/score/threadqimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreBRLock
+ *
+ * @{
+ */
+
+#define BRLOCK_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+/**
+ * @brief Initializes the big reader lock.
+ *
+ * @param[out] brlock is the big reader lock to initialize.
+ *
+ * @param name is the name of the big reader lock.
+ *
+ * @retval true The big reader lock was initialized.
+ *
+ * @retval false There was no free per-processor reader counter available, see
+ *   #BRLOCK_MAXIMUM_COUNT.
+ */
+bool _BRLock_Initialize( BRLock_Control *brlock, const char *name );
+
+/**
+ * @brief Destroys the big reader lock.
+ *
+ * The big reader lock shall not be in use.
+ *
+ * @param[in, out] brlock is the big reader lock to destroy.
+ */
+void _BRLock_Destroy( BRLock_Control *brlock );
+
+/**
+ * @brief Checks if the big reader lock is in use by a writer or waiting
+ *   threads.
+ *
+ * @param brlock is the big reader lock to check.
+ *
+ * @retval true The big reader lock is in use by a writer or waiting threads.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _BRLock_Is_busy( const BRLock_Control *brlock )
+{
+  return _Atomic_Load_uint( &brlock->writer, ATOMIC_ORDER_RELAXED ) != 0
+    || brlock->Queue.heads != NULL;
+}
+
+/**
+ * @brief Seizes the big reader lock for reading.
+ *
+ * If no writer is present, then only the reader counter of the current
+ * processor is incremented.  Read locks are recursive.  If the calling thread
+ * already owns the big reader lock for reading, then only its read lock nest
+ * level is incremented.
+ *
+ * @param[in, out] brlock is the big reader lock to seize.
+ *
+ * @param wait indicates whether the calling thread is willing to wait.
+ *
+ * @param[in, out] queue_context is the thread queue context.  The enqueue
+ *   callout shall be set if the calling thread is willing to wait.
+ *
+ * @retval STATUS_SUCCESSFUL The big reader lock was seized for reading.
+ *
+ * @retval STATUS_UNAVAILABLE A writer is present and the calling thread is
+ *   not willing to wait.
+ *
+ * @retval STATUS_DEADLOCK The calling thread owns the big reader lock for
+ *   writing.
+ *
+ * @retval STATUS_TOO_MANY The read lock nest level of the calling thread
+ *   would overflow.
+ *
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _BRLock_Seize_for_reading(
+  BRLock_Control       *brlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Seizes the big reader lock for writing.
+ *
+ * The writer announces its presence and waits until the reader counters of
+ * all processors drained.
+ *
+ * @param[in, out] brlock is the big reader lock to seize.
+ *
+ * @param wait indicates whether the calling thread is willing to wait.
+ *
+ * @param[in, out] queue_context is the thread queue context.  The enqueue
+ *   callout shall be set if the calling thread is willing to wait.
+ *
+ * @retval STATUS_SUCCESSFUL The big reader lock was seized for writing.
+ *
+ * @retval STATUS_UNAVAILABLE The big reader lock is in use and the calling
+ *   thread is not willing to wait.
+ *
+ * @retval STATUS_DEADLOCK The calling thread owns the big reader lock for
+ *   writing.
+ *
+ * @retval STATUS_DEADLOCK The calling thread owns the big reader lock for
+ *   reading.
+ *
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _BRLock_Seize_for_writing(
+  BRLock_Control       *brlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Surrenders the big reader lock.
+ *
+ * If the calling thread owns the big reader lock for writing, then the write
+ * lock is released, otherwise the read lock nest level of the calling thread
+ * is decremented.  The read lock is released if the nest level reaches zero.
+ *
+ * @param[in, out] brlock is the big reader lock to surrender.
+ *
+ * @retval STATUS_SUCCESSFUL The big reader lock was surrendered.
+ *
+ * @retval STATUS_NOT_OWNER The calling thread did not own the big reader lock.
+ */
+Status_Control _BRLock_Surrender( BRLock_Control *brlock );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_BRLOCKIMPL_H */
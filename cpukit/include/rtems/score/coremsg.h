@@ -38,6 +38,7 @@
 #ifndef _RTEMS_SCORE_COREMSG_H
 #define _RTEMS_SCORE_COREMSG_H
 
+#include <rtems/score/atomic.h>
 #include <rtems/score/coremsgbuffer.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/threadq.h>
@@ -104,6 +105,60 @@ typedef enum {
   );
 #endif
 
+/**
+ * @brief The lock-free ring of a single consumer message queue.
+ *
+ * The message buffers of the queue are used as the ring slots.  The sequence
+ * number of each slot tells the producers and the consumer whether the slot
+ * is free or contains a message for the current lap of the ring.
+ */
+typedef struct {
+  /**
+   * @brief This member is the position of the next slot to dequeue.
+   *
+   * It is only modified by the consumer.
+   */
+  Atomic_Uint head;
+
+  /**
+   * @brief This member is the position of the next slot to enqueue.
+   */
+  Atomic_Uint tail;
+
+  /**
+   * @brief This member is non-zero, if the consumer may block on the thread
+   *   queue of the message queue.
+   *
+   * Producers acquire the thread queue lock only if this member is set.
+   */
+  Atomic_Uint receiver_waiting;
+
+  /**
+   * @brief This member is the ring size minus one.
+   *
+   * The ring size is the maximum pending messages count which is a power of
+   * two.
+   */
+  uint32_t mask;
+
+  /**
+   * @brief This member is the size in bytes of one ring slot.
+   */
+  size_t slot_size;
+
+  /**
+   * @brief This member is true, if at most one producer uses the ring at a
+   *   time.
+   */
+  bool single_producer;
+
+  /**
+   * @brief This member is true, if the message queue uses the ring instead of
+   *   the pending and inactive message chains.
+   */
+  bool enabled;
+} CORE_message_queue_Ring;
+
 /**
  *  @brief Control block used to manage each message queue.
  *
@@ -161,6 +216,12 @@ struct CORE_message_queue_Control {
    *  when it does not contain a pending message.
    */
   Chain_Control                      Inactive_messages;
+
+  /**
+   * @brief This member contains the lock-free ring of a single consumer
+   *   message queue.
+   */
+  CORE_message_queue_Ring            Ring;
 };
 
 /** @} */
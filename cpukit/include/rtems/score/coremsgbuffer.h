@@ -40,6 +40,7 @@
 #define _RTEMS_SCORE_COREMSGBUFFER_H
 
 #include <rtems/score/basedefs.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/chain.h>
 
 #ifdef __cplusplus
@@ -62,11 +63,21 @@ extern "C" {
  * @brief The structure is used to organize message buffers of a message queue.
  */
 typedef struct {
-  /**
-   * @brief This member is used to enqueue the buffer in the pending or free
-   *   buffer queue of a message queue.
-   */
-  Chain_Node Node;
+  union {
+    /**
+     * @brief This member is used to enqueue the buffer in the pending or free
+     *   buffer queue of a message queue.
+     */
+    Chain_Node Node;
+
+    /**
+     * @brief This member is the sequence number of the buffer in the ring of
+     *   a lock-free message queue.
+     *
+     * The ring does not use the pending and free buffer queues.
+     */
+    Atomic_Uint sequence;
+  } Link;
 
   /** @brief This member defines the size of this message. */
   size_t size;
@@ -334,6 +334,102 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Enables the lock-free ring of a single consumer message queue.
+ *
+ * The message queue shall be initialized by _CORE_message_queue_Initialize()
+ * with a maximum pending messages count which is a power of two.  The message
+ * buffers are used as the ring slots afterwards.  Only one thread may seize
+ * messages from the message queue.
+ *
+ * @param[in, out] the_message_queue The message queue to use the ring.
+ * @param single_producer Indicates whether at most one thread or interrupt
+ *   service routine submits messages at a time.
+ */
+void _CORE_message_queue_Ring_initialize(
+  CORE_message_queue_Control *the_message_queue,
+  bool                        single_producer
+);
+
+/**
+ * @brief Submits a message to the lock-free ring of the message queue.
+ *
+ * The thread queue lock is only acquired if the consumer may be blocked on
+ * the message queue.  The submitter never blocks.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param buffer The starting address of the message to send.
+ * @param size The size of the message being send.
+ * @param queue_context The thread queue context with interrupts disabled.
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully submitted to the
+ *   message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.
+ * @retval STATUS_TOO_MANY The ring was full.
+ */
+Status_Control _CORE_message_queue_Ring_submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Seizes a message from the lock-free ring of the message queue.
+ *
+ * The thread queue lock is only acquired if the ring is empty.
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message from.
+ * @param executing The executing thread.
+ * @param[out] buffer The starting address of the message buffer to
+ *        to be filled in with a message.
+ * @param[out] size_p The size of the received message.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context with interrupts disabled.
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully seized from the
+ *   message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Ring_seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Flushes the pending messages of the lock-free ring.
+ *
+ * This function shall be called by the consumer of the message queue.
+ *
+ * @param[in, out] the_message_queue The message queue to flush.
+ * @param queue_context The thread queue context with interrupts disabled.
+ *
+ * @return Returns the number of pending messages flushed.
+ */
+uint32_t _CORE_message_queue_Ring_flush(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Gets the number of pending messages of the lock-free ring.
+ *
+ * @param the_message_queue The message queue to examine.
+ *
+ * @return Returns a snapshot of the number of pending messages.  Messages
+ *   which are currently submitted are included.
+ */
+uint32_t _CORE_message_queue_Ring_get_number_pending(
+  const CORE_message_queue_Control *the_message_queue
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -522,7 +618,10 @@ static inline void _CORE_message_queue_Free_message_buffer (
   CORE_message_queue_Buffer  *the_message
 )
 {
-  _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
+  _Chain_Append_unprotected(
+    &the_message_queue->Inactive_messages,
+    &the_message->Link.Node
+  );
 }
 
 /**
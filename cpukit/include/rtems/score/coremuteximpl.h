@@ -228,6 +228,10 @@ static inline Status_Control _CORE_recursive_mutex_Seize_nested(
  * @param operations The thread queue operations.
  * @param[out] executing The executing thread.
  * @param wait Indicates whether the calling thread is willing to wait.
+ * @param spin Indicates whether the calling thread shall spin while the owner
+ *      executes on another processor before it blocks, see
+ *      _Thread_queue_Spin_for_owner().  This parameter has no effect in
+ *      uniprocessor configurations.
  * @param nested Returns the status of a recursive mutex.
  * @param queue_context The thread queue context.
  *
@@ -241,6 +245,7 @@ static inline Status_Control _CORE_recursive_mutex_Seize(
   const Thread_queue_Operations *operations,
   Thread_Control                *executing,
   bool                           wait,
+  bool                           spin,
   Status_Control              ( *nested )( CORE_recursive_mutex_Control * ),
   Thread_queue_Context          *queue_context
 )
@@ -266,6 +271,25 @@ static inline Status_Control _CORE_recursive_mutex_Seize(
     return status;
   }
 
+#if defined(RTEMS_SMP)
+  if (
+    spin && wait
+      && _Thread_queue_Spin_for_owner(
+        &the_mutex->Mutex.Wait_queue.Queue,
+        owner,
+        executing,
+        queue_context
+      )
+  ) {
+    _CORE_mutex_Set_owner( &the_mutex->Mutex, executing );
+    _Thread_Resource_count_increment( executing );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+#else
+  (void) spin;
+#endif
+
   return _CORE_mutex_Seize_slow(
     &the_mutex->Mutex,
     operations,
@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreFutex
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreFutex which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_FUTEXIMPL_H
+#define _RTEMS_SCORE_FUTEXIMPL_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/status.h>
+#include <rtems/score/threadqimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreFutex
+ *
+ * @{
+ */
+
+/**
+ * @brief Performs the ``FUTEX_WAIT`` operation on a thread queue embedded in
+ *   a synchronization object.
+ *
+ * In contrast to _Futex_Wait(), the caller provides the thread queue context.
+ * This allows the caller to define the thread state, the enqueue callout,
+ * the deadlock callout, and the timeout of the wait operation.
+ *
+ * The owner of the synchronization object is loaded while the thread queue
+ * lock is owned and becomes the owner of the thread queue.  This enables the
+ * deadlock detection of the thread queue enqueue.  The owner is only valid
+ * until the next _Futex_Queue_store_and_wake() which clears the owner of the
+ * thread queue.
+ *
+ * @param[in, out] queue is the thread queue of the synchronization object.
+ *
+ * @param state is the futex state.
+ *
+ * @param val is the expected futex state value.
+ *
+ * @param owner is the pointer to the owner of the synchronization object.
+ *   It may be NULL, if the synchronization object has no owner.
+ *
+ * @param[in, out] queue_context is the initialized thread queue context.
+ *   If an owner is provided, then the deadlock callout shall be set.
+ *
+ * @retval STATUS_SUCCESSFUL The futex state was not equal to the expected
+ *   value, or the calling thread was woken up by a ``FUTEX_WAKE`` operation.
+ *
+ * @return Returns the thread wait status of the calling thread, for example
+ *   STATUS_TIMEOUT or STATUS_DEADLOCK, if the wait operation was not
+ *   successful.
+ */
+Status_Control _Futex_Queue_wait(
+  Thread_queue_Syslock_queue *queue,
+  const Atomic_Uint          *state,
+  unsigned int                val,
+  Thread_Control     * const *owner,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Stores the futex state and performs the ``FUTEX_WAKE`` operation on
+ *   a thread queue embedded in a synchronization object.
+ *
+ * The futex state is stored while the thread queue lock is owned.  An object
+ * destruction which acquires the thread queue lock before it checks the futex
+ * state cannot complete before this function stops to use the thread queue.
+ * The owner of the thread queue set by _Futex_Queue_wait() is cleared.
+ *
+ * @param[in, out] queue is the thread queue of the synchronization object.
+ *
+ * @param[out] state is the futex state.
+ *
+ * @param val is the futex state value to store.
+ *
+ * @param count is the maximum count of threads to wake up.
+ *
+ * @return Returns the count of woken up threads.
+ */
+int _Futex_Queue_store_and_wake(
+  Thread_queue_Syslock_queue *queue,
+  Atomic_Uint                *state,
+  unsigned int                val,
+  int                         count
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_FUTEXIMPL_H */
@@ -63,6 +63,12 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally, a segregated fit index may be enabled for a heap.  In this case,
+ * the free blocks are kept in size classes and allocations are satisfied from
+ * the first non-empty size class which is large enough.  This bounds the
+ * allocation time independent of the heap fragmentation, see
+ * _Heap_Enable_segregated_fit().
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -333,6 +339,63 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief The count of second level size classes of the segregated fit index
+ * is two to the power of this value.
+ *
+ * Each power of two block size range (first level) is divided into this count
+ * of equally sized sub-ranges (second level).
+ */
+#define HEAP_SEGREGATED_SECOND_LEVEL_BITS 2
+
+/**
+ * @brief The count of second level size classes per first level size class.
+ */
+#define HEAP_SEGREGATED_SECOND_LEVEL_COUNT \
+  ( 1U << HEAP_SEGREGATED_SECOND_LEVEL_BITS )
+
+/**
+ * @brief The count of first level size classes.
+ */
+#define HEAP_SEGREGATED_FIRST_LEVEL_COUNT ( 8 * sizeof( uintptr_t ) )
+
+/**
+ * @brief The count of size classes of the segregated fit index.
+ */
+#define HEAP_SEGREGATED_CLASS_COUNT \
+  ( HEAP_SEGREGATED_FIRST_LEVEL_COUNT * HEAP_SEGREGATED_SECOND_LEVEL_COUNT )
+
+/**
+ * @brief The segregated fit index of a heap.
+ *
+ * The free blocks of a heap with a segregated fit index are still members of
+ * the free list of the heap.  However, the free list is ordered by size class
+ * and the index provides the first free block of each size class.  The bitmaps
+ * are used to find the first non-empty size class which is greater than or
+ * equal to a size class in constant time.
+ *
+ * @see _Heap_Enable_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief If a bit is set in this bitmap, then at least one second level size
+   * class of the corresponding first level size class is not empty.
+   */
+  uintptr_t first_level_map;
+
+  /**
+   * @brief If a bit is set in these bitmaps, then the corresponding second
+   * level size class is not empty.
+   */
+  uint8_t second_level_map[ HEAP_SEGREGATED_FIRST_LEVEL_COUNT ];
+
+  /**
+   * @brief This table contains the first free block of each size class or
+   * NULL, if the size class is empty.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_CLASS_COUNT ];
+} Heap_Segregated_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -344,6 +407,13 @@ struct Heap_Control {
   uintptr_t area_end;
   Heap_Block *first_block;
   Heap_Block *last_block;
+
+  /**
+   * @brief The segregated fit index of the free list or NULL, if the heap uses
+   * the first fit method.
+   */
+  Heap_Segregated_index *segregated;
+
   Heap_Statistics stats;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
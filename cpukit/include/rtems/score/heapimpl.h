@@ -396,6 +396,80 @@ Heap_Block *_Heap_Block_allocate(
   uintptr_t alloc_size
 );
 
+/**
+ * @brief Enables the segregated fit index for the heap.
+ *
+ * The free blocks of the heap are sorted into the size classes of the index.
+ * Afterwards, allocations which need no particular alignment and have no
+ * boundary constraint search only the free blocks of the floor size class
+ * and of the first non-empty size class found by the bitmaps.  The search no
+ * longer visits the smaller free blocks of the heap.  The introspection functions such as
+ * _Heap_Walk(), _Heap_Get_information(), and _Heap_Iterate() work as for heaps
+ * using the first fit method.
+ *
+ * This function shall be called after _Heap_Initialize() since the heap
+ * initialization disables the segregated fit index.  If the segregated fit
+ * index is already enabled for the heap, then this function does nothing.
+ *
+ * @param[in, out] heap The heap to enable the segregated fit index for.
+ * @param[out] index The segregated fit index.  The index shall exist as long
+ *   as the heap is in use.
+ */
+void _Heap_Enable_segregated_fit(
+  Heap_Control          *heap,
+  Heap_Segregated_index *index
+);
+
+/**
+ * @brief Inserts the free block into the segregated fit index of the heap.
+ *
+ * The size of the block shall be valid.
+ *
+ * @param[in, out] heap The heap with an enabled segregated fit index.
+ * @param block The free block to insert.
+ */
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Extracts the free block from the segregated fit index of the heap.
+ *
+ * The size of the block shall be equal to the size at insertion time.
+ *
+ * @param[in, out] heap The heap with an enabled segregated fit index.
+ * @param block The free block to extract.
+ */
+void _Heap_Segregated_extract( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Changes the size of the free block and moves it to the corresponding
+ * size class of the segregated fit index of the heap if necessary.
+ *
+ * @param[in, out] heap The heap with an enabled segregated fit index.
+ * @param block The free block.
+ * @param size The new size of the free block.
+ */
+void _Heap_Segregated_set_block_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+);
+
+/**
+ * @brief Finds the first non-empty size class which is greater than or equal
+ * to the size class.
+ *
+ * @param index The segregated fit index.
+ * @param size_class The size class to start the search.
+ *
+ * @return Returns the first non-empty size class which is greater than or
+ *   equal to @a size_class.  If no such size class exists, then
+ *   ::HEAP_SEGREGATED_CLASS_COUNT is returned.
+ */
+uintptr_t _Heap_Segregated_find(
+  const Heap_Segregated_index *index,
+  uintptr_t                    size_class
+);
+
 #ifndef HEAP_PROTECTION
   #define _Heap_Protection_block_initialize( heap, block ) ((void) 0)
   #define _Heap_Protection_block_check( heap, block ) ((void) 0)
@@ -761,6 +835,140 @@ static inline bool _Heap_Is_block_in_heap(
     && (uintptr_t) block <= (uintptr_t) heap->last_block;
 }
 
+/**
+ * @brief Returns the segregated fit size class of the block size.
+ *
+ * @param size The block size.  It shall be greater than or equal to
+ *   ::HEAP_SEGREGATED_SECOND_LEVEL_COUNT.
+ *
+ * @return Returns the size class which contains the block size.
+ */
+static inline uintptr_t _Heap_Segregated_class( uintptr_t size )
+{
+  uintptr_t first_level;
+  uintptr_t second_level;
+
+  first_level = 8 * sizeof( size ) - 1 - (uintptr_t) __builtin_clzl( size );
+  second_level = ( size >> ( first_level - HEAP_SEGREGATED_SECOND_LEVEL_BITS ) )
+    & ( HEAP_SEGREGATED_SECOND_LEVEL_COUNT - 1 );
+
+  return first_level * HEAP_SEGREGATED_SECOND_LEVEL_COUNT + second_level;
+}
+
+/**
+ * @brief Returns the segregated fit size class which contains only blocks
+ * greater than or equal to the block size.
+ *
+ * @param size The block size.  It shall be greater than or equal to
+ *   ::HEAP_SEGREGATED_SECOND_LEVEL_COUNT.
+ *
+ * @return Returns the smallest size class which contains only blocks greater
+ *   than or equal to @a size.  In case of an integer overflow,
+ *   ::HEAP_SEGREGATED_CLASS_COUNT is returned.
+ */
+static inline uintptr_t _Heap_Segregated_fit_class( uintptr_t size )
+{
+  uintptr_t first_level;
+  uintptr_t rounded_size;
+
+  first_level = 8 * sizeof( size ) - 1 - (uintptr_t) __builtin_clzl( size );
+  rounded_size = size + ( (uintptr_t) 1 <<
+    ( first_level - HEAP_SEGREGATED_SECOND_LEVEL_BITS ) ) - 1;
+
+  if ( rounded_size < size ) {
+    return HEAP_SEGREGATED_CLASS_COUNT;
+  }
+
+  return _Heap_Segregated_class( rounded_size );
+}
+
+/**
+ * @brief Inserts the free block into the free list of the heap.
+ *
+ * The size of the block shall be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block_before The block after which the block is inserted in case the
+ *   heap uses the first fit method.
+ * @param new_block The block to insert.
+ */
+static inline void _Heap_Free_list_insert_block(
+  Heap_Control *heap,
+  Heap_Block   *block_before,
+  Heap_Block   *new_block
+)
+{
+  if ( heap->segregated == NULL ) {
+    _Heap_Free_list_insert_after( block_before, new_block );
+  } else {
+    _Heap_Segregated_insert( heap, new_block );
+  }
+}
+
+/**
+ * @brief Extracts the free block from the free list of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The block to extract.
+ */
+static inline void _Heap_Free_list_extract_block(
+  Heap_Control *heap,
+  Heap_Block   *block
+)
+{
+  if ( heap->segregated == NULL ) {
+    _Heap_Free_list_remove( block );
+  } else {
+    _Heap_Segregated_extract( heap, block );
+  }
+}
+
+/**
+ * @brief Replaces one free block in the free list of the heap by another.
+ *
+ * The size of the new block shall be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param old_block The block in the free list to replace.
+ * @param new_block The block that should replace @a old_block.
+ */
+static inline void _Heap_Free_list_replace_block(
+  Heap_Control *heap,
+  Heap_Block   *old_block,
+  Heap_Block   *new_block
+)
+{
+  if ( heap->segregated == NULL ) {
+    _Heap_Free_list_replace( old_block, new_block );
+  } else {
+    _Heap_Segregated_extract( heap, old_block );
+    _Heap_Segregated_insert( heap, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of a block of the free list of the heap.
+ *
+ * The previous block of a free block is always used, so the
+ * @c HEAP_PREV_BLOCK_USED flag is set.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The free block.
+ * @param size The new size of the free block.
+ */
+static inline void _Heap_Free_list_set_block_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+)
+{
+  if ( heap->segregated == NULL ) {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  } else {
+    _Heap_Segregated_set_block_size( heap, block, size );
+  }
+}
+
 /**
  * @brief Sets the size of the last block for the heap.
  *
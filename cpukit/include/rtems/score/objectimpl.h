@@ -282,6 +282,59 @@ Status_Control _Objects_Id_to_name (
   Objects_Name   *name
 );
 
+/**
+ * @brief Maps the specified object identifier to the associated local object
+ * control block using the specified maximum identifier and local table.
+ *
+ * This is the lookup of _Objects_Get().  In case the maximum identifier and
+ * the local table are compile-time constants, then the lookup is a bounds
+ * check and a table load.
+ *
+ * @param id is the object identifier.
+ *
+ * @param lock_context is the interrupt lock context.
+ *
+ * @param maximum_id is the maximum valid identifier of the object class.
+ *
+ * @param local_table is the table of local object control blocks.
+ *
+ * @retval pointer The pointer to the associated object control block.
+ *      Interrupts are now disabled and must be restored using the specified lock
+ *      context via _ISR_lock_ISR_enable() or _ISR_lock_Release_and_ISR_enable().
+ * @retval NULL No associated object exists.
+ */
+static inline Objects_Control *_Objects_Get_from_table(
+  Objects_Id               id,
+  ISR_lock_Context        *lock_context,
+  Objects_Id               maximum_id,
+  Objects_Control * const *local_table
+)
+{
+  Objects_Id delta;
+  Objects_Id end;
+
+  delta = maximum_id - id;
+  end = _Objects_Get_index( maximum_id );
+
+  if ( RTEMS_PREDICT_TRUE( delta < end ) ) {
+    ISR_Level        level;
+    Objects_Control *the_object;
+
+    _ISR_Local_disable( level );
+    _ISR_lock_Context_set_level( lock_context, level );
+
+    the_object = local_table[ end - OBJECTS_INDEX_MINIMUM - delta ];
+    if ( RTEMS_PREDICT_TRUE( the_object != NULL ) ) {
+      /* ISR disabled on behalf of caller */
+      return the_object;
+    }
+
+    _ISR_Local_enable( level );
+  }
+
+  return NULL;
+}
+
 /**
  * @brief Maps the specified object identifier to the associated local object
  * control block.
@@ -308,6 +361,63 @@ Objects_Control *_Objects_Get(
   const Objects_Information *information
 );
 
+/**
+ * @brief Defines the object lookup of an object class for the configured
+ *   object maximum.
+ *
+ * This macro should only be used by <rtems/confdefs.h> right after the
+ * definition of the objects information of the class.  It defines
+ * name##_Get_configured() which has the same semantics as _Objects_Get() for
+ * the objects information of the class.  In case the object maximum is not
+ * unlimited, then the maximum identifier and the local table are constants
+ * and the lookup is a bounds check and a table load.  Unlimited object classes
+ * and multiprocessing configurations, which set the node of the maximum
+ * identifier at run time, use _Objects_Get().
+ *
+ * The RTEMS library provides a name##_Get_configured() which uses
+ * _Objects_Get() in the same module as the objects information for zero
+ * objects.
+ *
+ * @param name is the object class C designator namespace prefix, e.g.
+ *   _Semaphore.
+ *
+ * @param information is the objects information of the class.
+ *
+ * @param api is the object API number, e.g. OBJECTS_CLASSIC_API.
+ *
+ * @param cls is the object class number, e.g. OBJECTS_RTEMS_SEMAPHORES.
+ *
+ * @param max is the configured object maximum (the OBJECTS_UNLIMITED_OBJECTS
+ *   flag may be set).
+ */
+#if defined(RTEMS_MULTIPROCESSING)
+#define OBJECTS_GET_CONFIGURED_DEFINE( name, information, api, cls, max ) \
+Objects_Control *name##_Get_configured( \
+  Objects_Id        id, \
+  ISR_lock_Context *lock_context \
+) \
+{ \
+  return _Objects_Get( id, lock_context, information ); \
+}
+#else
+#define OBJECTS_GET_CONFIGURED_DEFINE( name, information, api, cls, max ) \
+Objects_Control *name##_Get_configured( \
+  Objects_Id        id, \
+  ISR_lock_Context *lock_context \
+) \
+{ \
+  if ( _Objects_Is_unlimited( max ) ) { \
+    return _Objects_Get( id, lock_context, information ); \
+  } \
+  return _Objects_Get_from_table( \
+    id, \
+    lock_context, \
+    _Objects_Build_id( api, cls, 1, _Objects_Maximum_per_allocation( max ) ), \
+    name##_Local_table \
+  ); \
+}
+#endif
+
 /**
  * @brief  Maps object ids to object control blocks.
  *
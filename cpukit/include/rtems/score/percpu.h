@@ -48,6 +48,7 @@
   #include <rtems/score/assert.h>
   #include <rtems/score/chain.h>
   #include <rtems/score/isrlock.h>
+  #include <rtems/score/processormask.h>
   #include <rtems/score/smp.h>
   #include <rtems/score/timestamp.h>
   #include <rtems/score/watchdog.h>
@@ -76,11 +77,19 @@ extern "C" {
     #define PER_CPU_CONTROL_SIZE_BIG_POINTER 0
   #endif
 
+  /*
+   * The batched thread dispatch requests consist of the nest level and the
+   * processor mask of the deferred requests.
+   */
+  #define PER_CPU_CONTROL_SIZE_DISPATCH_REQUESTS \
+    ( 4 + ( ( CPU_MAXIMUM_PROCESSORS + 31 ) / 32 ) * 4 )
+
   #define PER_CPU_CONTROL_SIZE_BASE 180
   #define PER_CPU_CONTROL_SIZE_APPROX \
     ( PER_CPU_CONTROL_SIZE_BASE + CPU_PER_CPU_CONTROL_SIZE + \
     CPU_INTERRUPT_FRAME_SIZE + PER_CPU_CONTROL_SIZE_PROFILING + \
-    PER_CPU_CONTROL_SIZE_DEBUG + PER_CPU_CONTROL_SIZE_BIG_POINTER )
+    PER_CPU_CONTROL_SIZE_DEBUG + PER_CPU_CONTROL_SIZE_BIG_POINTER + \
+    PER_CPU_CONTROL_SIZE_DISPATCH_REQUESTS )
 
   /*
    * This ensures that on SMP configurations the individual per-CPU controls
@@ -505,6 +514,30 @@ typedef struct Per_CPU_Control {
      */
     uint64_t ticks;
 
+    /**
+     * @brief If this member is not NULL, then the clock tick interrupt of
+     * this processor is suppressed while the idle thread executes.
+     *
+     * The handler accounts for the clock ticks elapsed so far and resumes
+     * the periodic clock tick interrupt.  It is called with the watchdog lock
+     * of this processor acquired, see _Watchdog_Per_CPU_acquire_critical().
+     * The member is set by the Clock Driver in tickless idle mode, see
+     * #CONFIGURE_TICKLESS_IDLE.
+     */
+    void ( *tickless_exit )( struct Per_CPU_Control *cpu );
+
+    /**
+     * @brief If this member is not NULL, then the handler is called when a
+     * watchdog becomes the first watchdog of the monotonic or realtime
+     * watchdog header of this processor.
+     *
+     * It is called with the watchdog lock of this processor acquired.  The
+     * member is set by the Clock Driver in high resolution mode to program
+     * the clock interrupt for the next expiration time, see
+     * #CONFIGURE_HIGH_RESOLUTION_TIMERS.
+     */
+    void ( *clock_update )( struct Per_CPU_Control *cpu );
+
     /**
      * @brief Header for watchdogs.
      *
@@ -543,6 +576,30 @@ typedef struct Per_CPU_Control {
      */
     Atomic_Ulong message;
 
+    /**
+     * @brief Batched thread dispatch requests.
+     *
+     * @see _Thread_Dispatch_request_batch_begin() and
+     *   _Thread_Dispatch_request_batch_end().
+     */
+    struct {
+      /**
+       * @brief The batch nest level.
+       *
+       * While this member is positive, the thread dispatch requests for other
+       * processors issued by this processor at thread level are deferred.
+       * Only this processor accesses this member.
+       */
+      uint32_t nest_level;
+
+      /**
+       * @brief The set of processors with a deferred thread dispatch request.
+       *
+       * Only this processor accesses this member with interrupts disabled.
+       */
+      Processor_mask targets;
+    } Dispatch_requests;
+
     struct {
       /**
        * @brief The scheduler control of the scheduler owning this processor.
@@ -592,35 +649,38 @@ typedef struct Per_CPU_Control {
     Atomic_Uint state;
 
     /**
-     * @brief FIFO list of jobs to be performed by this processor.
+     * @brief List of jobs to be performed by this processor.
      *
      * @see _SMP_Multicast_action().
      */
     struct {
       /**
-       * @brief Lock to protect the FIFO list of jobs to be performed by this
-       * processor.
-       */
-      ISR_lock_Control Lock;
-
-      /**
-       * @brief Head of the FIFO list of jobs to be performed by this
-       * processor.
+       * @brief Head of the lock-free LIFO list of jobs to be performed by
+       * this processor.
        *
-       * This member is protected by the Per_CPU_Control::Jobs::Lock lock.
+       * Jobs are added by _Per_CPU_Add_job() with a compare and exchange
+       * operation.  This processor takes the complete list with an exchange
+       * operation in _Per_CPU_Perform_jobs() and performs the jobs in FIFO
+       * order.
        */
-      struct Per_CPU_Job *head;
+      Atomic_Uintptr head;
+    } Jobs;
 
+    /**
+     * @brief Read-copy update support.
+     *
+     * @see _RCU_Synchronize().
+     */
+    struct {
       /**
-       * @brief Tail of the FIFO list of jobs to be performed by this
-       * processor.
+       * @brief The grace period generation observed by this processor in its
+       * last quiescent state.
        *
-       * This member is only valid if the head is not @c NULL.
-       *
-       * This member is protected by the Per_CPU_Control::Jobs::Lock lock.
+       * Only this processor stores to this member in
+       * _RCU_Report_quiescent_state().
        */
-      struct Per_CPU_Job **tail;
-    } Jobs;
+      Atomic_Ulong generation;
+    } RCU;
 
     /**
      * @brief Indicates if the processor has been successfully started via
@@ -855,7 +915,8 @@ void _Per_CPU_Perform_jobs( Per_CPU_Control *cpu );
 /**
  * @brief Adds the job to the tail of the processing list of the processor.
  *
- * This function does not send the ::SMP_MESSAGE_PERFORM_JOBS message to the
+ * This function is lock-free and may be called concurrently by all
+ * processors.  It does not send the ::SMP_MESSAGE_PERFORM_JOBS message to the
  * processor, see also _Per_CPU_Submit_job().
  *
  * @param[in, out] cpu The processor to add the job.
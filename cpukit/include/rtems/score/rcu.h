@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreRCU which are used by the implementation and the API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_RCU_H
+#define _RTEMS_SCORE_RCU_H
+
+#include <rtems/score/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreRCU Read-Copy Update
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the read-copy update (RCU) implementation.
+ *
+ * The read-copy update uses quiescent-state-based reclamation.  A read-side
+ * critical section disables thread dispatching on the current processor, so
+ * each thread dispatch is a quiescent state of the processor.  Readers do not
+ * write to shared memory.  An updater publishes a new version of a data
+ * structure and waits with _RCU_Synchronize() until each processor passed
+ * through a quiescent state.  Afterwards, no reader can reference the old
+ * version any longer and it may be reclaimed.
+ *
+ * Read-side critical sections must be short and shall not block.
+ *
+ * @{
+ */
+
+/**
+ * @brief Publishes the value to the pointer read by read-side critical
+ *   sections.
+ *
+ * All store operations issued before the publication, for example the
+ * initialization of the new object, are visible to readers which observe the
+ * published value.
+ *
+ * @param _ptr is the address of the pointer to update.
+ *
+ * @param _value is the new pointer value.
+ */
+#define _RCU_Publish( _ptr, _value ) \
+  do { \
+    _Atomic_Fence( ATOMIC_ORDER_RELEASE ); \
+    *( __typeof__( *( _ptr ) ) volatile * ) ( _ptr ) = ( _value ); \
+  } while ( 0 )
+
+/**
+ * @brief Loads a pointer published by _RCU_Publish().
+ *
+ * @param ptr is the address of the pointer to load.
+ *
+ * @return Returns the pointer value.
+ */
+static inline void *_RCU_Dereference_pointer( void * const volatile *ptr )
+{
+  void *value;
+
+  value = *ptr;
+  _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+
+  return value;
+}
+
+/**
+ * @brief Loads a pointer published by _RCU_Publish() in a read-side critical
+ *   section.
+ *
+ * @param _ptr is the address of the pointer to load.
+ *
+ * @return Returns the pointer value.  The object referenced by the value is
+ *   valid until the end of the read-side critical section.
+ */
+#define _RCU_Dereference( _ptr ) \
+  ( (__typeof__( *( _ptr ) )) \
+    _RCU_Dereference_pointer( (void * const volatile *) ( _ptr ) ) )
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_RCU_H */
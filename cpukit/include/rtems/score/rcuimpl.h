@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreRCU which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_RCUIMPL_H
+#define _RTEMS_SCORE_RCUIMPL_H
+
+#include <rtems/score/rcu.h>
+#include <rtems/score/threaddispatch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreRCU
+ *
+ * @{
+ */
+
+/**
+ * @brief Begins a read-side critical section.
+ *
+ * Read-side critical sections may be nested.
+ *
+ * @return Returns the current processor.
+ */
+static inline Per_CPU_Control *_RCU_Read_lock( void )
+{
+  return _Thread_Dispatch_disable();
+}
+
+/**
+ * @brief Ends a read-side critical section.
+ *
+ * @param cpu_self is the current processor returned by _RCU_Read_lock().
+ */
+static inline void _RCU_Read_unlock( Per_CPU_Control *cpu_self )
+{
+  _Thread_Dispatch_enable( cpu_self );
+}
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief The generation of the grace period most recently started by
+ *   _RCU_Synchronize().
+ */
+extern Atomic_Ulong _RCU_Generation;
+
+/**
+ * @brief Reports a quiescent state of the current processor.
+ *
+ * This function is called by _Thread_Do_dispatch() which is only executed
+ * outside of read-side critical sections.
+ *
+ * @param[in, out] cpu_self is the current processor.
+ */
+static inline void _RCU_Report_quiescent_state( Per_CPU_Control *cpu_self )
+{
+  _Atomic_Store_ulong(
+    &cpu_self->RCU.generation,
+    _Atomic_Load_ulong( &_RCU_Generation, ATOMIC_ORDER_ACQUIRE ),
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/**
+ * @brief Waits until all read-side critical sections which started before
+ *   the call ended.
+ *
+ * The caller shall not be in a read-side critical section and thread
+ * dispatching shall be enabled.  The processors are requested to carry out a
+ * thread dispatch through an SMP multicast action, so the grace period is
+ * bounded by the longest read-side critical section.
+ */
+void _RCU_Synchronize( void );
+#else
+static inline void _RCU_Synchronize( void )
+{
+  /*
+   * Read-side critical sections disable thread dispatching, so no reader
+   * can be preempted on a uniprocessor configuration.
+   */
+}
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_RCUIMPL_H */
@@ -42,6 +42,7 @@
 #include <rtems/score/scheduler.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/priorityimpl.h>
+#include <rtems/score/schedulerstats.h>
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/status.h>
 #include <rtems/score/threadimpl.h>
@@ -278,6 +279,7 @@ static inline void _Scheduler_Block( Thread_Control *the_thread )
   scheduler = _Scheduler_Node_get_scheduler( scheduler_node );
 
   _Scheduler_Acquire_critical( scheduler, &lock_context );
+  _Scheduler_Statistics_Block( scheduler );
   ( *scheduler->Operations.block )(
     scheduler,
     the_thread,
@@ -306,6 +308,7 @@ static inline void _Scheduler_Block( Thread_Control *the_thread )
   const Scheduler_Control *scheduler;
 
   scheduler = _Thread_Scheduler_get_home( the_thread );
+  _Scheduler_Statistics_Block( scheduler );
   ( *scheduler->Operations.block )(
     scheduler,
     the_thread,
@@ -341,6 +344,7 @@ static inline void _Scheduler_Unblock( Thread_Control *the_thread )
 #endif
 
   _Scheduler_Acquire_critical( scheduler, &lock_context );
+  _Scheduler_Statistics_Unblock( scheduler, the_thread );
   ( *scheduler->Operations.unblock )( scheduler, the_thread, scheduler_node );
   _Scheduler_Release_critical( scheduler, &lock_context );
 }
@@ -379,6 +383,7 @@ static inline void _Scheduler_Update_priority( Thread_Control *the_thread )
     scheduler = _Scheduler_Node_get_scheduler( scheduler_node );
 
     _Scheduler_Acquire_critical( scheduler, &lock_context );
+    _Scheduler_Statistics_Update_priority( scheduler );
     ( *scheduler->Operations.update_priority )(
       scheduler,
       the_thread,
@@ -392,6 +397,7 @@ static inline void _Scheduler_Update_priority( Thread_Control *the_thread )
   const Scheduler_Control *scheduler;
 
   scheduler = _Thread_Scheduler_get_home( the_thread );
+  _Scheduler_Statistics_Update_priority( scheduler );
   ( *scheduler->Operations.update_priority )(
     scheduler,
     the_thread,
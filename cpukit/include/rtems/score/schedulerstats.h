@@ -0,0 +1,299 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerStatistics
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreSchedulerStatistics.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERSTATS_H
+#define _RTEMS_SCORE_SCHEDULERSTATS_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/scheduler.h>
+#include <rtems/score/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerStatistics Scheduler Statistics
+ *
+ * @ingroup RTEMSScoreScheduler
+ *
+ * @brief This group contains the implementation to gather scheduler
+ *   statistics.
+ *
+ * The scheduler statistics are only gathered if the RTEMS_SCHEDULER_STATISTICS
+ * build option is enabled, otherwise all hooks of this group are empty.  For
+ * each scheduler instance, the count of block, unblock, priority update, and
+ * ask for help operations is recorded.  In addition, the count of thread
+ * switches, the count of preemptions, and a histogram of the wake-up latency
+ * for each user priority is recorded.  The wake-up latency of a thread is the
+ * time from its unblock operation to the context switch to it.
+ *
+ * All counters are updated with relaxed atomic operations, so that no lock is
+ * needed in the thread dispatch path.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the count of user priorities with a separate
+ *   wake-up latency histogram.
+ *
+ * Wake-up latencies of threads with a user priority greater than or equal to
+ * this constant are recorded in the histogram of the last priority.
+ */
+#define SCHEDULER_STATISTICS_PRIORITY_COUNT 256
+
+/**
+ * @brief This constant defines the count of buckets of a wake-up latency
+ *   histogram.
+ *
+ * The bucket with index zero counts latencies less than two CPU counter ticks.
+ * The bucket with index i > 0 counts latencies in the interval
+ * [2^i, 2^(i + 1)) CPU counter ticks.
+ */
+#define SCHEDULER_STATISTICS_BUCKET_COUNT 32
+
+/**
+ * @brief The scheduler statistics of a scheduler instance.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of block operations.
+   */
+  Atomic_Uint blocks;
+
+  /**
+   * @brief This member contains the count of unblock operations.
+   */
+  Atomic_Uint unblocks;
+
+  /**
+   * @brief This member contains the count of priority update operations.
+   */
+  Atomic_Uint priority_updates;
+
+  /**
+   * @brief This member contains the count of ask for help operations.
+   */
+  Atomic_Uint help_requests;
+
+  /**
+   * @brief This member contains the count of thread switches on processors
+   *   owned by the scheduler.
+   */
+  Atomic_Uint switches;
+
+  /**
+   * @brief This member contains the count of thread switches on processors
+   *   owned by the scheduler for which the previously executing thread was
+   *   still ready.
+   */
+  Atomic_Uint preemptions;
+
+  /**
+   * @brief This member contains the wake-up latency histograms for each user
+   *   priority.
+   */
+  Atomic_Uint latencies
+    [ SCHEDULER_STATISTICS_PRIORITY_COUNT ]
+    [ SCHEDULER_STATISTICS_BUCKET_COUNT ];
+} Scheduler_Statistics;
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+/**
+ * @brief This table contains the scheduler statistics of the configured
+ *   schedulers.
+ *
+ * The table is defined by <rtems/confdefs.h> and has ::_Scheduler_Count
+ * entries.  The entry index is the scheduler index.
+ */
+extern Scheduler_Statistics _Scheduler_Statistics[];
+
+/**
+ * @brief Gets the scheduler statistics of the scheduler.
+ *
+ * @param scheduler is the scheduler.
+ *
+ * @return Returns the statistics of the scheduler.
+ */
+static inline Scheduler_Statistics *_Scheduler_Statistics_Get(
+  const Scheduler_Control *scheduler
+)
+{
+  return &_Scheduler_Statistics[ scheduler - &_Scheduler_Table[ 0 ] ];
+}
+
+/**
+ * @brief Increments the statistics counter.
+ *
+ * @param[in, out] counter is the counter to increment.
+ */
+static inline void _Scheduler_Statistics_Increment( Atomic_Uint *counter )
+{
+  _Atomic_Fetch_add_uint( counter, 1, ATOMIC_ORDER_RELAXED );
+}
+
+/**
+ * @brief Records a thread switch in the scheduler statistics.
+ *
+ * @param cpu_self is the processor performing the thread switch.
+ *
+ * @param executing is the thread executing before the thread switch.
+ *
+ * @param heir is the thread executing after the thread switch.
+ */
+void _Scheduler_Statistics_Do_thread_switch(
+  const struct Per_CPU_Control *cpu_self,
+  Thread_Control               *executing,
+  Thread_Control               *heir
+);
+#endif
+
+/**
+ * @brief Records a block operation in the scheduler statistics.
+ *
+ * @param scheduler is the scheduler of the operation.
+ */
+static inline void _Scheduler_Statistics_Block(
+  const Scheduler_Control *scheduler
+)
+{
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Increment(
+    &_Scheduler_Statistics_Get( scheduler )->blocks
+  );
+#else
+  (void) scheduler;
+#endif
+}
+
+/**
+ * @brief Records an unblock operation in the scheduler statistics.
+ *
+ * The unblock instant is recorded in the thread to get the wake-up latency at
+ * the next thread switch to the thread.
+ *
+ * @param scheduler is the scheduler of the operation.
+ *
+ * @param[in, out] the_thread is the thread unblocked by the operation.
+ */
+static inline void _Scheduler_Statistics_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  the_thread->Scheduler.wake_up_instant = _CPU_Counter_read();
+  the_thread->Scheduler.wake_up_pending = true;
+  _Scheduler_Statistics_Increment(
+    &_Scheduler_Statistics_Get( scheduler )->unblocks
+  );
+#else
+  (void) scheduler;
+  (void) the_thread;
+#endif
+}
+
+/**
+ * @brief Records a priority update operation in the scheduler statistics.
+ *
+ * @param scheduler is the scheduler of the operation.
+ */
+static inline void _Scheduler_Statistics_Update_priority(
+  const Scheduler_Control *scheduler
+)
+{
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Increment(
+    &_Scheduler_Statistics_Get( scheduler )->priority_updates
+  );
+#else
+  (void) scheduler;
+#endif
+}
+
+/**
+ * @brief Records an ask for help operation in the scheduler statistics.
+ *
+ * @param scheduler is the scheduler of the operation.
+ */
+static inline void _Scheduler_Statistics_Ask_for_help(
+  const Scheduler_Control *scheduler
+)
+{
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Increment(
+    &_Scheduler_Statistics_Get( scheduler )->help_requests
+  );
+#else
+  (void) scheduler;
+#endif
+}
+
+/**
+ * @brief Records a thread switch in the scheduler statistics.
+ *
+ * Must be called with interrupts disabled before the context switch from the
+ * executing thread to the heir thread.
+ *
+ * @param cpu_self is the processor performing the thread switch.
+ *
+ * @param[in, out] executing is the thread executing before the thread switch.
+ *
+ * @param[in, out] heir is the thread executing after the thread switch.
+ */
+static inline void _Scheduler_Statistics_Thread_switch(
+  const struct Per_CPU_Control *cpu_self,
+  Thread_Control               *executing,
+  Thread_Control               *heir
+)
+{
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Do_thread_switch( cpu_self, executing, heir );
+#else
+  (void) cpu_self;
+  (void) executing;
+  (void) heir;
+#endif
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERSTATS_H */
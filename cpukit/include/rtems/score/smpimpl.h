@@ -234,7 +234,8 @@ bool _SMP_Should_start_processor( uint32_t cpu_index );
 /**
  * @brief Sends the SMP message to the processor.
  *
- * The target processor may be the sending processor.
+ * The target processor may be the sending processor.  No inter-processor
+ * interrupt is sent if the message is already pending on the target processor.
  *
  * @param[in, out] cpu is the processor control of the target processor.
  *
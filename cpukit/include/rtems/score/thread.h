@@ -42,6 +42,7 @@
 #define _RTEMS_SCORE_THREAD_H
 
 #include <rtems/score/atomic.h>
+#include <rtems/score/brlock.h>
 #include <rtems/score/context.h>
 #if defined(RTEMS_MULTIPROCESSING)
 #include <rtems/score/mppkt.h>
@@ -417,6 +418,23 @@ typedef struct {
    * Each thread has a scheduler node for each scheduler instance.
    */
   Scheduler_Node *nodes;
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  /**
+   * @brief This member contains the CPU counter value of the last unblock
+   *   operation.
+   *
+   * The value is only valid if Thread_Scheduler_control::wake_up_pending is
+   * true.
+   */
+  CPU_Counter_ticks wake_up_instant;
+
+  /**
+   * @brief This member is true, if the thread was unblocked and no thread
+   *   switch to the thread happened since then, otherwise it is false.
+   */
+  bool wake_up_pending;
+#endif
 } Thread_Scheduler_control;
 
 /**
@@ -921,6 +939,17 @@ struct _Thread_Control {
    */
   bool was_created_with_inherited_scheduler;
 
+  /**
+   * @brief This member contains the read lock nest level of this thread for
+   *   each big reader lock.
+   *
+   * The entry of a big reader lock is selected by its per-processor reader
+   * counter slot, see BRLock_Control::slot.  A nest level of zero indicates
+   * that the thread does not own the big reader lock for reading.  Only the
+   * thread itself modifies this member.
+   */
+  uint8_t brlock_read_nest_levels[ BRLOCK_MAXIMUM_COUNT ];
+
 #if defined(RTEMS_SCORE_THREAD_HAS_SCHEDULER_CHANGE_INHIBITORS)
   /**
    * @brief This field is true, if scheduler changes are inhibited.
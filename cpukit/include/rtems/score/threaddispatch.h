@@ -42,6 +42,10 @@
 #include <rtems/score/isrlock.h>
 #include <rtems/score/profiling.h>
 
+#if defined( RTEMS_SMP )
+#include <rtems/score/processormaskimpl.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -272,6 +276,14 @@ static inline void _Thread_Dispatch_request(
 #if defined( RTEMS_SMP )
   if ( cpu_self == cpu_target ) {
     cpu_self->dispatch_necessary = true;
+  } else if (
+    cpu_self->Dispatch_requests.nest_level != 0
+      && cpu_self->isr_nest_level == 0
+  ) {
+    _Processor_mask_Set(
+      &cpu_self->Dispatch_requests.targets,
+      _Per_CPU_Get_index( cpu_target )
+    );
   } else {
     _Atomic_Fetch_or_ulong( &cpu_target->message, 0, ATOMIC_ORDER_RELEASE );
     _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu_target ) );
@@ -282,6 +294,48 @@ static inline void _Thread_Dispatch_request(
 #endif
 }
 
+/**
+ * @brief Begins a batch of thread dispatch requests.
+ *
+ * The caller shall disable thread dispatching.  Until the corresponding
+ * _Thread_Dispatch_request_batch_end(), the thread dispatch requests for other
+ * processors issued by the current processor at thread level are collected.
+ * This avoids one inter-processor interrupt for each thread made ready, for
+ * example by _Thread_queue_Flush_critical().
+ *
+ * @param[in, out] cpu_self The current processor.
+ */
+static inline void _Thread_Dispatch_request_batch_begin(
+  Per_CPU_Control *cpu_self
+)
+{
+#if defined( RTEMS_SMP )
+  _Assert( cpu_self->thread_dispatch_disable_level > 0 );
+  ++cpu_self->Dispatch_requests.nest_level;
+#else
+  (void) cpu_self;
+#endif
+}
+
+#if defined( RTEMS_SMP )
+/**
+ * @brief Ends a batch of thread dispatch requests.
+ *
+ * If this ends the outermost batch, then an inter-processor interrupt is sent
+ * to each processor with a deferred thread dispatch request.
+ *
+ * @param[in, out] cpu_self The current processor.
+ */
+void _Thread_Dispatch_request_batch_end( Per_CPU_Control *cpu_self );
+#else
+static inline void _Thread_Dispatch_request_batch_end(
+  Per_CPU_Control *cpu_self
+)
+{
+  (void) cpu_self;
+}
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
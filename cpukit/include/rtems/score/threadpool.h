@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadPool
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreThreadPool which are used by the implementation and the
+ *   API.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_THREADPOOL_H
+#define _RTEMS_SCORE_THREADPOOL_H
+
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/threadq.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreThreadPool Thread Pool Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the thread pool implementation.
+ *
+ * A thread pool consists of worker threads which are constructed and started
+ * once.  Idle workers block on the thread queue of the pool.  The submission
+ * of a work item hands it over to the first idle worker, or appends it to the
+ * pending work items if no worker is idle.  Both cases need a constant time.
+ * A thread creation with its object, stack, and thread-local storage
+ * allocation, its scheduler node initialization, and its user extension calls
+ * is not necessary to carry out a work item.
+ *
+ * @{
+ */
+
+typedef struct Thread_pool_Work Thread_pool_Work;
+
+/**
+ * @brief This type defines the handler of a thread pool work item.
+ *
+ * @param[in, out] work is the work item.
+ */
+typedef void ( *Thread_pool_Handler )( Thread_pool_Work *work );
+
+/**
+ * @brief This structure represents a thread pool work item.
+ */
+struct Thread_pool_Work {
+  /**
+   * @brief This member is the node for the pending work items of the pool.
+   */
+  Chain_Node Node;
+
+  /**
+   * @brief This member is the handler of the work item.
+   */
+  Thread_pool_Handler handler;
+
+  /**
+   * @brief This member is the argument of the work item.
+   *
+   * It is not used by the thread pool.
+   */
+  void *arg;
+};
+
+/**
+ * @brief This structure represents a thread pool.
+ */
+typedef struct {
+  /**
+   * @brief This member is the thread queue of the pool.
+   *
+   * Idle workers wait on this thread queue for work items.  After the pool
+   * termination, the terminating thread waits on this thread queue for the
+   * exit of the workers.
+   */
+  Thread_queue_Control Queue;
+
+  /**
+   * @brief This member contains the work items which were submitted while no
+   *   worker was idle.
+   */
+  Chain_Control Pending;
+
+  /**
+   * @brief This member is the count of workers of the pool.
+   */
+  uint32_t worker_count;
+
+  /**
+   * @brief This member is true, if the pool is terminating.
+   */
+  bool terminate;
+} Thread_pool_Control;
+
+/**
+ * @brief Initializes the work item.
+ *
+ * @param[out] work is the work item to initialize.
+ *
+ * @param handler is the handler of the work item.
+ *
+ * @param arg is the argument of the work item.
+ */
+static inline void _Thread_pool_Work_initialize(
+  Thread_pool_Work    *work,
+  Thread_pool_Handler  handler,
+  void                *arg
+)
+{
+  _Chain_Initialize_node( &work->Node );
+  work->handler = handler;
+  work->arg = arg;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_THREADPOOL_H */
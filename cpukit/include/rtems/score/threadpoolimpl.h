@@ -0,0 +1,136 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadPool
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreThreadPool which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_THREADPOOLIMPL_H
+#define _RTEMS_SCORE_THREADPOOLIMPL_H
+
+#include <rtems/score/threadpool.h>
+#include <rtems/score/threadqimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreThreadPool
+ *
+ * @{
+ */
+
+/**
+ * @brief This define specifies the thread queue operations of a thread pool.
+ */
+#define THREAD_POOL_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+/**
+ * @brief Initializes the thread pool.
+ *
+ * @param[out] pool is the thread pool to initialize.
+ *
+ * @param name is the name of the thread pool.
+ */
+void _Thread_pool_Initialize( Thread_pool_Control *pool, const char *name );
+
+/**
+ * @brief Adds a worker to the thread pool.
+ *
+ * This function shall be called before the worker is started.
+ *
+ * @param[in, out] pool is the thread pool.
+ */
+void _Thread_pool_Add_worker( Thread_pool_Control *pool );
+
+/**
+ * @brief Submits the work item to the thread pool.
+ *
+ * The work item is handed over to the first idle worker of the pool.  If no
+ * worker is idle, then the work item is appended to the pending work items of
+ * the pool.  This function may be called from interrupt context.
+ *
+ * @param[in, out] pool is the thread pool.
+ *
+ * @param[in, out] work is the work item to submit.  The work item shall not
+ *   be submitted again before its handler was called.
+ *
+ * @retval true The work item was submitted.
+ *
+ * @retval false The thread pool is terminating.
+ */
+bool _Thread_pool_Submit( Thread_pool_Control *pool, Thread_pool_Work *work );
+
+/**
+ * @brief Gets the next work item of the thread pool.
+ *
+ * This function shall be called by a worker of the pool.  If no work item is
+ * pending, then the worker blocks until a work item is submitted.
+ *
+ * @param[in, out] pool is the thread pool.
+ *
+ * @param[in, out] executing is the executing worker.
+ *
+ * @retval NULL The thread pool terminated.  The worker shall exit and no
+ *   longer access the pool.
+ *
+ * @return Returns the next work item.
+ */
+Thread_pool_Work *_Thread_pool_Get_work(
+  Thread_pool_Control *pool,
+  Thread_Control      *executing
+);
+
+/**
+ * @brief Terminates the thread pool.
+ *
+ * The pending work items are still carried out by the workers.  This
+ * function returns after all workers stopped to access the pool.  It shall
+ * not be called by a worker of the pool.
+ *
+ * @param[in, out] pool is the thread pool.
+ *
+ * @param[in, out] executing is the executing thread.
+ */
+void _Thread_pool_Terminate(
+  Thread_pool_Control *pool,
+  Thread_Control      *executing
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_THREADPOOLIMPL_H */
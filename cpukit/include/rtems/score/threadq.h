@@ -43,6 +43,7 @@
 #include <rtems/score/isrlock.h>
 #include <rtems/score/object.h>
 #include <rtems/score/priority.h>
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/watchdogticks.h>
@@ -77,6 +78,8 @@ typedef struct Thread_queue_Queue Thread_queue_Queue;
 
 typedef struct Thread_queue_Operations Thread_queue_Operations;
 
+typedef struct Thread_queue_Priority_bit_map Thread_queue_Priority_bit_map;
+
 /**
  * @brief Thread queue enqueue callout.
  *
@@ -328,6 +331,16 @@ struct Thread_queue_Context {
    */
   Thread_queue_Deadlock_callout deadlock_callout;
 
+  /**
+   * @brief The priority bit map of the thread queue.
+   *
+   * Must be initialized for _Thread_queue_Enqueue() in case the thread queue
+   * uses the ::_Thread_queue_Operations_priority_bit_map operations.
+   *
+   * @see _Thread_queue_Context_set_priority_bit_map().
+   */
+  Thread_queue_Priority_bit_map *priority_bit_map;
+
 #if defined(RTEMS_MULTIPROCESSING)
   /**
    * @brief Callout to unblock the thread in case it is actually a thread
@@ -369,6 +382,37 @@ typedef struct {
   struct Scheduler_Node *scheduler_node;
 } Thread_queue_Priority_queue;
 
+/**
+ * @brief This constant defines the count of priority buckets of a thread
+ *   queue priority bit map.
+ *
+ * It is the count of priority values supported by ::Priority_bit_map_Control.
+ */
+#define THREAD_QUEUE_PRIORITY_BIT_MAP_BUCKET_COUNT 256
+
+/**
+ * @brief The thread queue priority bit map is used by the
+ *   ::_Thread_queue_Operations_priority_bit_map operations.
+ *
+ * Each bucket contains the threads of one priority in FIFO order.  The bit map
+ * indicates the non-empty buckets.  This yields constant time enqueue,
+ * extract, and surrender operations independent of the count of enqueued
+ * threads.  The thread queue heads provided by the enqueued threads are too
+ * small to contain the buckets, so the priority bit map is provided by the
+ * object embedding the thread queue.
+ */
+struct Thread_queue_Priority_bit_map {
+  /**
+   * @brief The bit map of non-empty buckets.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The buckets with the threads of one priority in FIFO order.
+   */
+  Chain_Control Buckets[ THREAD_QUEUE_PRIORITY_BIT_MAP_BUCKET_COUNT ];
+};
+
 /**
  * @brief Thread queue heads.
  *
@@ -402,6 +446,15 @@ typedef struct _Thread_queue_Heads {
      */
     Thread_queue_Priority_queue Priority;
 #endif
+
+    /**
+     * @brief This is the priority bit map of the thread queue for the
+     *   ::_Thread_queue_Operations_priority_bit_map operations.
+     *
+     * The priority bit map is provided by the object embedding the thread
+     * queue through _Thread_queue_Context_set_priority_bit_map().
+     */
+    Thread_queue_Priority_bit_map *Priority_bit_map;
   } Heads;
 
   /**
@@ -549,6 +602,8 @@ typedef Thread_Control *( *Thread_queue_First_operation )(
  *
  * * ::_Thread_queue_Operations_priority_inherit
  *
+ * * ::_Thread_queue_Operations_priority_bit_map
+ *
  * @see _Thread_wait_Set_operations().
  */
 struct Thread_queue_Operations {
@@ -640,6 +695,17 @@ typedef struct {
   Thread_queue_Queue Queue;
 } Thread_queue_Control;
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief The maximum time in nanoseconds a thread spins in
+ *   _Thread_queue_Spin_for_owner() before it blocks on the thread queue.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>.
+ */
+extern const uint32_t _Thread_queue_Adaptive_spin_time;
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
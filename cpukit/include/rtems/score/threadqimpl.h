@@ -146,6 +146,39 @@ void _Thread_queue_Add_timeout_realtime_timespec(
   Thread_queue_Context *queue_context
 );
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Spins while the owner of the thread queue executes on a processor.
+ *
+ * The thread queue lock is released and interrupts are enabled while the
+ * calling thread spins.  The spinning stops if the owner of the thread queue
+ * changed, if the owner no longer executes on a processor, or if the time
+ * budget defined by ::_Thread_queue_Adaptive_spin_time is exhausted.  The
+ * thread queue lock is acquired again with interrupts disabled before the
+ * function returns.
+ *
+ * This is the adaptive spinning policy of mutexes.  It avoids the thread
+ * queue enqueue and the context switches in case the owner releases the
+ * mutex within a short time.
+ *
+ * @param[in, out] queue The thread queue queue.  The thread queue lock shall
+ *   be acquired by the caller.
+ * @param owner The owner of the thread queue observed by the caller.
+ * @param executing The executing thread.
+ * @param[in, out] queue_context The thread queue context used to acquire the
+ *   thread queue lock.
+ *
+ * @retval true The thread queue has no owner.
+ * @retval false Otherwise.
+ */
+bool _Thread_queue_Spin_for_owner(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *owner,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+);
+#endif
+
 /**
  * @brief Sets the thread wait return code to STATUS_DEADLOCK.
  *
@@ -177,6 +210,7 @@ static inline void _Thread_queue_Context_initialize(
 #endif
   queue_context->enqueue_callout = NULL;
   queue_context->deadlock_callout = NULL;
+  queue_context->priority_bit_map = NULL;
 #else
   (void) queue_context;
 #endif
@@ -364,6 +398,26 @@ static inline void _Thread_queue_Context_set_deadlock_callout(
   queue_context->deadlock_callout = deadlock_callout;
 }
 
+/**
+ * @brief Sets the priority bit map in the thread queue context.
+ *
+ * The priority bit map must be provided for _Thread_queue_Enqueue()
+ * operations that operate on thread queues which use the
+ * ::_Thread_queue_Operations_priority_bit_map operations.
+ *
+ * @param[out] queue_context The thread queue context.
+ * @param priority_bit_map The priority bit map of the thread queue.
+ *
+ * @see _Thread_queue_Enqueue().
+ */
+static inline void _Thread_queue_Context_set_priority_bit_map(
+  Thread_queue_Context          *queue_context,
+  Thread_queue_Priority_bit_map *priority_bit_map
+)
+{
+  queue_context->priority_bit_map = priority_bit_map;
+}
+
 /**
  * @brief Clears the priority update count of the thread queue context.
  *
@@ -1459,6 +1513,29 @@ extern const Thread_queue_Operations _Thread_queue_Operations_priority;
  */
 extern const Thread_queue_Operations _Thread_queue_Operations_priority_inherit;
 
+/**
+ * @brief The priority bit map thread queue operations are used when a thread
+ *   is enqueued on a thread queue and provide priority ordering of enqueued
+ *   threads in constant time.
+ *
+ * Threads of equal priority are ordered in FIFO order.  The priority bit map
+ * shall be initialized by _Thread_queue_Priority_bit_map_initialize() and
+ * provided by _Thread_queue_Context_set_priority_bit_map() for each enqueue.
+ * Priority values which exceed the range of the priority bit map share the
+ * last bucket.  In SMP configurations, only the priority of the home
+ * scheduler of a thread is used for the ordering.
+ */
+extern const Thread_queue_Operations _Thread_queue_Operations_priority_bit_map;
+
+/**
+ * @brief Initializes the priority bit map of a thread queue.
+ *
+ * @param[out] priority_bit_map The priority bit map to initialize.
+ */
+void _Thread_queue_Priority_bit_map_initialize(
+  Thread_queue_Priority_bit_map *priority_bit_map
+);
+
 /**
  * @brief The special thread queue name to indicated that the thread queue is
  * embedded in an object with identifier.
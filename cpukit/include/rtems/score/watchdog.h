@@ -84,6 +84,77 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of bits used to index the slots of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_LEVEL_BITS 6
+
+/**
+ * @brief The count of slots of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_LEVEL_SIZE ( 1U << WATCHDOG_WHEEL_LEVEL_BITS )
+
+/**
+ * @brief The count of timing wheel levels.
+ *
+ * Watchdogs which expire later than the range covered by the levels are
+ * placed in the last slot of the highest level and cascade again.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief The hierarchical timing wheel of a watchdog header.
+ *
+ * The timing wheel provides constant time insert and remove operations for
+ * watchdogs with an expiration time in clock ticks.  The slots of level zero
+ * have a resolution of one tick.  Each higher level slot covers all slots of
+ * the next lower level.  Watchdogs move to the lower levels when the current
+ * time reaches their slot.
+ */
+typedef struct {
+  /**
+   * @brief The slots of the levels.
+   */
+  Chain_Control
+    Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_LEVEL_SIZE ];
+
+  /**
+   * @brief Expired watchdogs which wait for the invocation of their service
+   *   routine.
+   */
+  Chain_Control Expired;
+
+  /**
+   * @brief The time of the last processed tick.
+   *
+   * All watchdogs with an expiration time less than or equal to this time are
+   * on the chain of expired watchdogs.
+   */
+  uint64_t now;
+
+  /**
+   * @brief The count of scheduled watchdogs.
+   */
+  uint32_t count;
+} Watchdog_Wheel;
+
+/**
+ * @brief Uses the configured timing wheels for the tick clock per-CPU
+ *   watchdog headers.
+ *
+ * This function is used by the application configuration option
+ * @ref CONFIGURE_WATCHDOG_TIMING_WHEEL.
+ */
+void _Watchdog_Wheel_initialize_processors( void );
+
+/**
+ * @brief The timing wheels for the tick clock per-CPU watchdog headers.
+ *
+ * This array is provided by the application configuration.  It has an entry
+ * for each configured processor.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -96,8 +167,18 @@ typedef struct {
   /**
    * @brief The scheduled watchdog with the earliest expiration time or NULL in
    * case no watchdog is scheduled.
+   *
+   * This member is always NULL if the header uses a timing wheel.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel used to manage the scheduled watchdogs or NULL.
+   *
+   * If this member is NULL, then the scheduled watchdogs are managed by the
+   * red-black tree.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -119,7 +200,8 @@ struct Watchdog_Control {
 
     /**
      * @brief this field is a chain node structure and allows this to be placed
-     * on a chain used to manage pending watchdogs by the timer server.
+     * on a chain used to manage pending watchdogs by the timer server or on a
+     * slot chain of a timing wheel.
      */
     Chain_Node Chain;
   } Node;
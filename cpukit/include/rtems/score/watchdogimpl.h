@@ -120,6 +120,7 @@ static inline void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
 /**
@@ -136,6 +137,26 @@ static inline Watchdog_Control *_Watchdog_Header_first(
   return (Watchdog_Control *) header->first;
 }
 
+/**
+ * @brief Checks if no watchdog is scheduled in the watchdog header.
+ *
+ * @param header is the watchdog header.
+ *
+ * @retval true No watchdog is scheduled in the watchdog header.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Watchdog_Header_is_empty(
+  const Watchdog_Header *header
+)
+{
+  if ( header->wheel != NULL ) {
+    return header->wheel->count == 0;
+  }
+
+  return header->first == NULL;
+}
+
 /**
  * @brief Destroys the watchdog header.
  *
@@ -318,6 +339,154 @@ void _Watchdog_Remove(
   Watchdog_Control *the_watchdog
 );
 
+/**
+ * @brief Initializes the timing wheel.
+ *
+ * @param[out] wheel is the timing wheel to initialize.
+ *
+ * @param now is the time of the last processed tick.
+ */
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now );
+
+/**
+ * @brief Inserts the watchdog into the timing wheel.
+ *
+ * The watchdog must be inactive.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to insert.
+ *
+ * @param expire is the expiration time for the watchdog in ticks.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Removes the watchdog from the timing wheel in case it is scheduled.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to remove.
+ */
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+);
+
+/**
+ * @brief Advances the timing wheel and calls the routine of each expired
+ *   watchdog.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param now is the current time in ticks.
+ *
+ * @param lock is the lock that is released before calling the routine and then
+ *   acquired after the call.
+ *
+ * @param lock_context is the lock context for the release before calling the
+ *   routine and for the acquire after.
+ */
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock_context )
+#endif
+
+/**
+ * @brief Gets the lower bound of the expiration time of the watchdogs
+ *   scheduled in the timing wheel.
+ *
+ * @param wheel is the timing wheel.
+ *
+ * @return Returns the tick at which the timing wheel has to be advanced next
+ *   to expire or cascade watchdogs.  In case the timing wheel contains no
+ *   watchdog, UINT64_MAX is returned.
+ */
+uint64_t _Watchdog_Wheel_next_expiry( const Watchdog_Wheel *wheel );
+
+/**
+ * @brief Gets the count of clock ticks until the next watchdog of the
+ *   processor expires.
+ *
+ * The watchdog lock of the processor shall be acquired.
+ *
+ * @param cpu is the processor.
+ *
+ * @param maximum is the maximum count of clock ticks to return.
+ *
+ * @return Returns the count of clock ticks relative to the last clock tick
+ *   after which the clock tick interrupt has to be serviced next, at least
+ *   one and at most @a maximum.
+ */
+uint64_t _Watchdog_Ticks_until_next_expiry(
+  Per_CPU_Control *cpu,
+  uint64_t         maximum
+);
+
+/**
+ * @brief Accounts for clock ticks of the processor which were skipped in
+ *   tickless idle mode.
+ *
+ * The watchdog lock of the processor shall be acquired.  No watchdog of the
+ * processor may expire in the skipped clock ticks, see
+ * _Watchdog_Ticks_until_next_expiry().
+ *
+ * @param[in, out] cpu is the processor.
+ *
+ * @param ticks is the count of skipped clock ticks.
+ */
+void _Watchdog_Skip_ticks( Per_CPU_Control *cpu, uint64_t ticks );
+
+/**
+ * @brief Services the expired watchdogs of the monotonic and realtime
+ *   watchdog headers of the processor.
+ *
+ * The watchdog lock of the processor shall be acquired.  The lock is released
+ * while the watchdog service routines are called.  In contrast to
+ * _Watchdog_Tick(), the current time is read from the timecounter hardware.
+ * This function is used by the Clock Driver in high resolution mode, see
+ * #CONFIGURE_HIGH_RESOLUTION_TIMERS.
+ *
+ * @param[in, out] cpu is the processor.
+ *
+ * @param[in, out] lock_context is the lock context used to acquire the
+ *   watchdog lock of the processor.
+ */
+void _Watchdog_Tickle_clocks(
+  Per_CPU_Control  *cpu,
+  ISR_lock_Context *lock_context
+);
+
+/**
+ * @brief Gets the expiration time of the next watchdog of the monotonic and
+ *   realtime watchdog headers of the processor.
+ *
+ * The watchdog lock of the processor shall be acquired.
+ *
+ * @param cpu is the processor.
+ *
+ * @return Returns the expiration time as an uptime in nanoseconds.  The
+ *   expiration time of a realtime watchdog is converted using the current
+ *   boot time.  In case no watchdog is scheduled, UINT64_MAX is returned.
+ */
+uint64_t _Watchdog_Next_clock_expiry( const Per_CPU_Control *cpu );
+
 /**
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
@@ -605,6 +774,9 @@ static inline uint64_t _Watchdog_Ticks_from_sbintime( int64_t sbt )
 /**
  * @brief Acquires the per cpu watchdog lock in a critical section.
  *
+ * In case the processor is in tickless idle mode, then the tickless idle mode
+ * is left.
+ *
  * @param cpu The cpu to acquire the watchdog lock of.
  * @param lock_context The lock context.
  */
@@ -613,7 +785,19 @@ static inline void _Watchdog_Per_CPU_acquire_critical(
   ISR_lock_Context *lock_context
 )
 {
+  void ( *tickless_exit )( Per_CPU_Control * );
+
   _ISR_lock_Acquire( &cpu->Watchdog.Lock, lock_context );
+
+  /*
+   * Bring the watchdog ticks up to date and resume the clock tick interrupt
+   * before the watchdogs of a processor in tickless idle mode are changed.
+   */
+  tickless_exit = cpu->Watchdog.tickless_exit;
+
+  if ( RTEMS_PREDICT_FALSE( tickless_exit != NULL ) ) {
+    ( *tickless_exit )( cpu );
+  }
 }
 
 /**
@@ -107,6 +107,24 @@ extern const uint32_t _Watchdog_Ticks_per_second;
  */
 extern const uint32_t _Watchdog_Ticks_per_timeslice;
 
+/**
+ * @brief Indicates if the Clock Driver shall suppress clock tick interrupts
+ *   while the idle thread executes.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>.
+ */
+extern const bool _Watchdog_Tickless_idle;
+
+/**
+ * @brief Indicates if the Clock Driver shall program its interrupt for the
+ *   expiration time of the next monotonic or realtime watchdog.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>.
+ */
+extern const bool _Watchdog_High_resolution_timers;
+
 /** @} */
 
 #ifdef __cplusplus
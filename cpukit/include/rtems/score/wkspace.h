@@ -58,6 +58,23 @@ extern "C" {
  */
 extern Heap_Control _Workspace_Area;
 
+/**
+ * @brief The segregated fit index of the workspace.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_WORKSPACE_SEGREGATED_FIT via <rtems/confdefs.h>.
+ */
+extern Heap_Segregated_index _Workspace_Segregated_index;
+
+/**
+ * @brief Enables the segregated fit index for the workspace.
+ *
+ * This handler is registered as a system initialization step by the
+ * application configuration option #CONFIGURE_WORKSPACE_SEGREGATED_FIT via
+ * <rtems/confdefs.h>.
+ */
+void _Workspace_Enable_segregated_fit( void );
+
 /**
  * @brief Initializes the workspace handler.
  *
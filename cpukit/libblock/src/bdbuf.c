@@ -20,6 +20,9 @@
  *    issues.
  *
  * Copyright (C) 2009, 2017 embedded brains GmbH & Co. KG
+ *
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *    Split the cache into shards.
  */
 
 /**
@@ -86,6 +89,48 @@ typedef struct rtems_bdbuf_waiters {
   rtems_condition_variable cond_var;
 } rtems_bdbuf_waiters;
 
+/**
+ * The default shift of the media block number used to select the shard of a
+ * block.  Consecutive media blocks within the range defined by this shift are
+ * in the same shard so that multi-block transfers are possible.
+ */
+#ifndef RTEMS_BDBUF_SHARD_BLOCK_SHIFT
+#define RTEMS_BDBUF_SHARD_BLOCK_SHIFT (7)
+#endif
+
+/**
+ * The count of locks protecting the statistics and read-ahead state of the
+ * disk devices.  A device uses the lock selected by its address.
+ */
+#define RTEMS_BDBUF_DEVICE_LOCK_COUNT (8)
+
+/**
+ * A shard of the BD buffer cache. The groups of the cache are distributed
+ * evenly to the shards. A block of a device is cached in the shard selected by
+ * a hash of the device and the block number. Each shard has its own lock,
+ * lookup tree, lists and waiters, so that accesses to blocks in different
+ * shards do not contend.
+ */
+typedef struct rtems_bdbuf_shard
+{
+  rtems_mutex         lock;              /**< The shard lock. It locks all
+                                          * shard data, BD and lists. */
+  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
+                                          * root of the shard. */
+  rtems_chain_control lru;               /**< Least recently used list */
+  rtems_chain_control modified;          /**< Modified buffers list */
+  rtems_chain_control sync;              /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_shard;
+
 /**
  * The BD buffer cache.
  */
@@ -107,8 +152,11 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_mutex         lock;              /**< The cache lock. It locks the
+                                          * swapout workers and the sync
+                                          * state. It may be obtained while
+                                          * a shard lock is owned, but not
+                                          * vice versa. */
   rtems_mutex         sync_lock;         /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -116,20 +164,11 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
+  rtems_bdbuf_shard*  shards;            /**< The shards. */
+  size_t              shard_count;       /**< The number of shards. */
+  size_t              groups_per_shard;  /**< The number of groups per shard.
+                                          * The last shard gets the
+                                          * remainder. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
@@ -139,6 +178,22 @@ typedef struct rtems_bdbuf_cache
   rtems_id            read_ahead_task;   /**< Read-ahead task */
   rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
   bool                read_ahead_enabled; /**< Read-ahead enabled */
+  uint32_t            read_ahead_streams; /**< The number of read-ahead
+                                           * streams tracked per device. */
+  uint32_t            read_ahead_initial_window; /**< The initial read-ahead
+                                                  * window in blocks. */
+
+  /**
+   * @brief The device locks protect the statistics and the read-ahead
+   *   streams of the disk devices.
+   */
+  RTEMS_INTERRUPT_LOCK_MEMBER (device_locks[RTEMS_BDBUF_DEVICE_LOCK_COUNT])
+
+  /**
+   * @brief The read-ahead lock protects the read-ahead request chain.  It may
+   *   be acquired while a device lock is owned, but not vice versa.
+   */
+  RTEMS_INTERRUPT_LOCK_MEMBER (read_ahead_lock)
   rtems_status_code   init_status;       /**< The initialization status */
   pthread_once_t      once;
 } rtems_bdbuf_cache;
@@ -186,11 +241,6 @@ static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
 static rtems_bdbuf_cache bdbuf_cache = {
   .lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .sync_lock = RTEMS_MUTEX_INITIALIZER(NULL),
-  .access_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
-  .transfer_waiters = {
-    .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL)
-  },
-  .buffer_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
   .once = PTHREAD_ONCE_INIT
 };
 
@@ -227,21 +277,24 @@ rtems_bdbuf_show_usage (void)
 {
   uint32_t group;
   uint32_t total = 0;
-  uint32_t val;
+  uint32_t lru = 0;
+  uint32_t modified = 0;
+  uint32_t sync = 0;
+  size_t   s;
 
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
-  printf (", total=%lu\n", total);
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    lru += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].lru);
+    modified += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].modified);
+    sync += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].sync);
+  }
+  printf (", lru=%lu", lru);
+  printf (", mod=%lu", modified);
+  printf (", sync=%lu", sync);
+  printf (", total=%lu\n", lru + modified + sync);
 }
 
 /**
@@ -841,6 +894,131 @@ rtems_bdbuf_unlock_cache (void)
   rtems_bdbuf_unlock (&bdbuf_cache.lock);
 }
 
+/**
+ * Lock the shard.
+ *
+ * @param shard The shard to lock.
+ */
+static void
+rtems_bdbuf_lock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_lock (&shard->lock);
+}
+
+/**
+ * Unlock the shard.
+ *
+ * @param shard The shard to unlock.
+ */
+static void
+rtems_bdbuf_unlock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_unlock (&shard->lock);
+}
+
+/**
+ * Lock all shards in index order.
+ */
+static void
+rtems_bdbuf_lock_all_shards (void)
+{
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+    rtems_bdbuf_lock_shard (&bdbuf_cache.shards[s]);
+}
+
+/**
+ * Unlock all shards.
+ */
+static void
+rtems_bdbuf_unlock_all_shards (void)
+{
+  size_t s;
+
+  for (s = bdbuf_cache.shard_count; s > 0; --s)
+    rtems_bdbuf_unlock_shard (&bdbuf_cache.shards[s - 1]);
+}
+
+/**
+ * Get the shard owning the buffer descriptor. The groups of a shard are
+ * contiguous, so the shard is determined by the group of the buffer.
+ *
+ * @param bd The buffer descriptor.
+ * @return The shard of the buffer descriptor.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_shard_of_bd (const rtems_bdbuf_buffer *bd)
+{
+  size_t s = (size_t) (bd->group - bdbuf_cache.groups)
+    / bdbuf_cache.groups_per_shard;
+
+  if (s >= bdbuf_cache.shard_count)
+    s = bdbuf_cache.shard_count - 1;
+
+  return &bdbuf_cache.shards[s];
+}
+
+/**
+ * Get the shard caching the media block of the device. The block number is
+ * given in media blocks, so the shard of a block does not depend on the block
+ * size of the device.
+ *
+ * @param dd The disk device.
+ * @param media_block The media block number.
+ * @return The shard caching the block.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_shard_of_block (const rtems_disk_device *dd,
+                            rtems_blkdev_bnum        media_block)
+{
+  uint32_t h;
+
+  h = ((uint32_t) ((uintptr_t) dd >> 3))
+    ^ (media_block >> RTEMS_BDBUF_SHARD_BLOCK_SHIFT);
+  h *= 0x9e3779b1U;
+
+  return &bdbuf_cache.shards[((uint64_t) h * bdbuf_cache.shard_count) >> 32];
+}
+
+/**
+ * The lock protecting the statistics and read-ahead state of the device.  This
+ * is a macro since the lock objects exist only in SMP or debug configurations.
+ *
+ * @param dd The disk device.
+ */
+#define RTEMS_BDBUF_DEVICE_LOCK(dd) \
+  (&bdbuf_cache.device_locks[((uintptr_t) (dd) >> 6) \
+                             % RTEMS_BDBUF_DEVICE_LOCK_COUNT])
+
+/**
+ * Acquire the lock protecting the statistics and read-ahead state of the
+ * device.
+ *
+ * @param dd The disk device.
+ * @param lock_context The lock context.
+ */
+static void
+rtems_bdbuf_lock_device (const rtems_disk_device     *dd,
+                         rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_acquire (RTEMS_BDBUF_DEVICE_LOCK (dd), lock_context);
+}
+
+/**
+ * Release the lock protecting the statistics and read-ahead state of the
+ * device.
+ *
+ * @param dd The disk device.
+ * @param lock_context The lock context.
+ */
+static void
+rtems_bdbuf_unlock_device (const rtems_disk_device     *dd,
+                           rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_release (RTEMS_BDBUF_DEVICE_LOCK (dd), lock_context);
+}
+
 /**
  * Lock the cache's sync. A single task can nest calls.
  */
@@ -883,18 +1061,19 @@ rtems_bdbuf_group_release (rtems_bdbuf_buffer *bd)
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
+ * The function assumes the shard is locked on entry and it will be locked on
  * exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard   *shard,
+                            rtems_bdbuf_waiters *waiters)
 {
   /*
    * Indicate we are waiting.
    */
   ++waiters->count;
 
-  rtems_condition_variable_wait (&waiters->cond_var, &bdbuf_cache.lock);
+  rtems_condition_variable_wait (&waiters->cond_var, &shard->lock);
 
   --waiters->count;
 }
@@ -904,7 +1083,7 @@ rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard_of_bd (bd), waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -932,18 +1111,23 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_shard *shard)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return shard->buffer_waiters.count;
 }
 
 static void
 rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
+  if (rtems_bdbuf_avl_remove (&shard->tree, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+static void
+rtems_bdbuf_read_ahead_waste (rtems_bdbuf_buffer *bd);
+
 static void
 rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
 {
@@ -952,6 +1136,8 @@ rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
+      if (bd->read_ahead_stream != 0)
+        rtems_bdbuf_read_ahead_waste (bd);
       rtems_bdbuf_remove_from_tree (bd);
       break;
     default:
@@ -965,7 +1151,8 @@ static void
 rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&rtems_bdbuf_shard_of_bd (bd)->lru,
+                                   &bd->link);
 }
 
 static void
@@ -978,7 +1165,8 @@ static void
 rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_append_unprotected (&rtems_bdbuf_shard_of_bd (bd)->lru,
+                                  &bd->link);
 }
 
 static void
@@ -996,9 +1184,16 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+  bool               wait_for_sync;
+
+  rtems_bdbuf_lock_cache ();
+  wait_for_sync = bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd;
+  rtems_bdbuf_unlock_cache ();
+
+  if (wait_for_sync)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     /*
      * Wait for the sync lock.
@@ -1006,7 +1201,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
   }
 
   /*
@@ -1022,27 +1217,32 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
    */
   if (bd->state == RTEMS_BDBUF_STATE_ACCESS_CACHED
         || bd->state == RTEMS_BDBUF_STATE_ACCESS_EMPTY)
+  {
     bd->hold_timer = bdbuf_config.swap_block_hold;
+    bd->modified_ticks = rtems_clock_get_ticks_since_boot ();
+  }
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&shard->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&shard->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (shard))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
 rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
@@ -1072,19 +1272,21 @@ rtems_bdbuf_bds_per_group (size_t size)
 static void
 rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_discard_buffer (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
  * from the ALV tree and any lists then the new BD's are prepended to the ready
- * list of the cache.
+ * list of the shard owning the group.
  *
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
@@ -1118,7 +1320,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&rtems_bdbuf_shard_of_bd (group->bdbuf)->buffer_waiters);
 
   return group->bdbuf;
 }
@@ -1133,20 +1335,22 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
   bd->avl.left  = NULL;
   bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->read_ahead_stream = 0;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_avl_insert (&rtems_bdbuf_shard_of_bd (bd)->tree, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (&shard->lru);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (&shard->lru, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1302,6 +1506,7 @@ rtems_bdbuf_do_init (void)
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  size_t              s;
   rtems_status_code   sc;
 
   if (rtems_bdbuf_tracer)
@@ -1324,19 +1529,17 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
   rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
-  rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
-                                     "bdbuf access");
-  rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
-                                     "bdbuf transfer");
-  rtems_condition_variable_set_name (&bdbuf_cache.buffer_waiters.cond_var,
-                                     "bdbuf buffer");
+
+  for (s = 0; s < RTEMS_BDBUF_DEVICE_LOCK_COUNT; ++s)
+    rtems_interrupt_lock_initialize (&bdbuf_cache.device_locks[s],
+                                     "bdbuf device");
+
+  rtems_interrupt_lock_initialize (&bdbuf_cache.read_ahead_lock,
+                                   "bdbuf read-ahead");
 
   rtems_bdbuf_lock_cache ();
 
@@ -1350,6 +1553,59 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
 
+  /*
+   * Each shard needs at least one group.
+   */
+  bdbuf_cache.shard_count = bdbuf_config.shard_count;
+  if (bdbuf_cache.shard_count > bdbuf_cache.group_count)
+    bdbuf_cache.shard_count = bdbuf_cache.group_count;
+  if (bdbuf_cache.shard_count == 0)
+    bdbuf_cache.shard_count = 1;
+  bdbuf_cache.groups_per_shard =
+    bdbuf_cache.group_count / bdbuf_cache.shard_count;
+
+  bdbuf_cache.read_ahead_streams = bdbuf_config.read_ahead_streams;
+  if (bdbuf_cache.read_ahead_streams > RTEMS_DISK_READ_AHEAD_STREAM_COUNT)
+    bdbuf_cache.read_ahead_streams = RTEMS_DISK_READ_AHEAD_STREAM_COUNT;
+  if (bdbuf_cache.read_ahead_streams == 0)
+    bdbuf_cache.read_ahead_streams = 1;
+
+  /*
+   * Without a minimum the read-ahead window is fixed to the maximum.
+   */
+  bdbuf_cache.read_ahead_initial_window = bdbuf_config.min_read_ahead_blocks;
+  if (bdbuf_cache.read_ahead_initial_window == 0
+      || bdbuf_cache.read_ahead_initial_window
+        > bdbuf_config.max_read_ahead_blocks)
+    bdbuf_cache.read_ahead_initial_window =
+      bdbuf_config.max_read_ahead_blocks;
+  if (bdbuf_cache.groups_per_shard == 0)
+    bdbuf_cache.groups_per_shard = 1;
+
+  /*
+   * Allocate and initialise the shards.
+   */
+  bdbuf_cache.shards = calloc (sizeof (rtems_bdbuf_shard),
+                               bdbuf_cache.shard_count);
+  if (!bdbuf_cache.shards)
+    goto error;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_mutex_init (&shard->lock, "bdbuf shard");
+    rtems_chain_initialize_empty (&shard->lru);
+    rtems_chain_initialize_empty (&shard->modified);
+    rtems_chain_initialize_empty (&shard->sync);
+    rtems_condition_variable_init (&shard->access_waiters.cond_var,
+                                   "bdbuf access");
+    rtems_condition_variable_init (&shard->transfer_waiters.cond_var,
+                                   "bdbuf transfer");
+    rtems_condition_variable_init (&shard->buffer_waiters.cond_var,
+                                   "bdbuf buffer");
+  }
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1378,7 +1634,7 @@ rtems_bdbuf_do_init (void)
 
   /*
    * The cache is empty after opening so we need to add all the buffers to it
-   * and initialise the groups.
+   * and initialise the groups.  Each buffer goes to the shard of its group.
    */
   for (b = 0, group = bdbuf_cache.groups,
          bd = bdbuf_cache.bds, buffer = bdbuf_cache.buffers;
@@ -1389,7 +1645,8 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    rtems_chain_append_unprotected (&rtems_bdbuf_shard_of_bd (bd)->lru,
+                                    &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
@@ -1487,9 +1744,23 @@ error:
     }
   }
 
+  if (bdbuf_cache.shards)
+  {
+    for (s = 0; s < bdbuf_cache.shard_count; ++s)
+    {
+      rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+      rtems_condition_variable_destroy (&shard->buffer_waiters.cond_var);
+      rtems_condition_variable_destroy (&shard->transfer_waiters.cond_var);
+      rtems_condition_variable_destroy (&shard->access_waiters.cond_var);
+      rtems_mutex_destroy (&shard->lock);
+    }
+  }
+
   free (bdbuf_cache.buffers);
   free (bdbuf_cache.groups);
   free (bdbuf_cache.bds);
+  free (bdbuf_cache.shards);
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
 
@@ -1544,6 +1815,8 @@ rtems_bdbuf_wait_for_transient_event (void)
 static void
 rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1560,12 +1833,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1578,7 +1851,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&rtems_bdbuf_shard_of_bd (bd)->sync,
+                                  &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1591,6 +1865,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
 static bool
 rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1612,19 +1888,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1635,6 +1911,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   while (true)
   {
     switch (bd->state)
@@ -1650,7 +1928,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1659,23 +1937,25 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_shard *shard)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&shard->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
 }
 
 static void
 rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_bd (bd);
+
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
   rtems_bdbuf_wait_for_sync_done (bd);
@@ -1692,21 +1972,22 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
       rtems_bdbuf_remove_from_tree (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_shard *shard,
+                                       rtems_disk_device *dd,
                                        rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_avl_search (&shard->tree, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
     if (bd != NULL)
       rtems_bdbuf_group_obtain (bd);
@@ -1722,14 +2003,15 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_shard *shard,
+                                   rtems_disk_device *dd,
                                    rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_avl_search (&shard->tree, dd, block);
 
     if (bd != NULL)
     {
@@ -1739,17 +2021,17 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
         {
           rtems_bdbuf_remove_from_tree_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_wake (&shard->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (shard);
     }
   }
   while (bd == NULL);
@@ -1784,6 +2066,59 @@ rtems_bdbuf_get_media_block (const rtems_disk_device *dd,
   return sc;
 }
 
+/**
+ * Lock the shard caching the block of the device and get the media block
+ * number.
+ *
+ * The media block number depends on the block size of the device which may
+ * only change while all shards are locked.  So the shard is selected with an
+ * unprotected guess and the guess is checked with the shard locked.
+ *
+ * @param dd The disk device.
+ * @param block The block number.
+ * @param media_block_ptr Pointer to the media block number.
+ * @param shard_ptr Pointer to the locked shard.  The shard is locked in any
+ *   case and must be unlocked by the caller.
+ * @return The status of the media block computation.
+ */
+static rtems_status_code
+rtems_bdbuf_lock_shard_of_block (const rtems_disk_device *dd,
+                                 rtems_blkdev_bnum        block,
+                                 rtems_blkdev_bnum       *media_block_ptr,
+                                 rtems_bdbuf_shard      **shard_ptr)
+{
+  rtems_status_code  sc;
+  rtems_bdbuf_shard *shard;
+
+  sc = rtems_bdbuf_get_media_block (dd, block, media_block_ptr);
+  if (sc == RTEMS_SUCCESSFUL)
+    shard = rtems_bdbuf_shard_of_block (dd, *media_block_ptr);
+  else
+    shard = &bdbuf_cache.shards[0];
+
+  while (true)
+  {
+    rtems_bdbuf_shard *other;
+
+    rtems_bdbuf_lock_shard (shard);
+
+    sc = rtems_bdbuf_get_media_block (dd, block, media_block_ptr);
+    if (sc != RTEMS_SUCCESSFUL)
+      break;
+
+    other = rtems_bdbuf_shard_of_block (dd, *media_block_ptr);
+    if (other == shard)
+      break;
+
+    rtems_bdbuf_unlock_shard (shard);
+    shard = other;
+  }
+
+  *shard_ptr = shard;
+
+  return sc;
+}
+
 rtems_status_code
 rtems_bdbuf_get (rtems_disk_device   *dd,
                  rtems_blkdev_bnum    block,
@@ -1791,11 +2126,10 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
 {
   rtems_status_code   sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer *bd = NULL;
+  rtems_bdbuf_shard  *shard;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
-
-  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  sc = rtems_bdbuf_lock_shard_of_block (dd, block, &media_block, &shard);
   if (sc == RTEMS_SUCCESSFUL)
   {
     /*
@@ -1805,7 +2139,13 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
+
+    /*
+     * The content of the buffer is about to be replaced, so a read-ahead of
+     * this block neither counts as hit nor as waste.
+     */
+    bd->read_ahead_stream = 0;
 
     switch (bd->state)
     {
@@ -1837,7 +2177,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
     }
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   *bd_ptr = bd;
 
@@ -1861,18 +2201,42 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
+static void
+rtems_bdbuf_wake_after_transfer (rtems_bdbuf_shard *shard,
+                                 bool               wake_transfer_waiters,
+                                 bool               wake_buffer_waiters)
+{
+  if (wake_transfer_waiters)
+    rtems_bdbuf_wake (&shard->transfer_waiters);
+
+  if (wake_buffer_waiters)
+    rtems_bdbuf_wake (&shard->buffer_waiters);
+}
+
+/**
+ * Execute the transfer request. The buffers of the request may belong to
+ * different shards. The shard of each buffer is locked while its state is
+ * updated after the transfer.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param locked_shard The shard locked by the caller or NULL. It is unlocked
+ *   during the transfer and locked again on return.
+ */
 static rtems_status_code
 rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
                                       rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+                                      rtems_bdbuf_shard    *locked_shard)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
   uint32_t transfer_index = 0;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
+  rtems_bdbuf_shard *shard = NULL;
+  rtems_interrupt_lock_context lock_context;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  if (locked_shard != NULL)
+    rtems_bdbuf_unlock_shard (locked_shard);
 
   /* The return value will be ignored for transfer requests */
   dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
@@ -1881,9 +2245,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   rtems_bdbuf_wait_for_transient_event ();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache ();
-
   /* Statistics */
+  rtems_bdbuf_lock_device (dd, &lock_context);
   if (req->req == RTEMS_BLKDEV_REQ_READ)
   {
     dd->stats.read_blocks += req->bufnum;
@@ -1897,13 +2260,30 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     if (sc != RTEMS_SUCCESSFUL)
       ++dd->stats.write_errors;
   }
+  rtems_bdbuf_unlock_device (dd, &lock_context);
 
   for (transfer_index = 0; transfer_index < req->bufnum; ++transfer_index)
   {
     rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
-    bool waiters = bd->waiters;
+    rtems_bdbuf_shard *bd_shard = rtems_bdbuf_shard_of_bd (bd);
+
+    if (bd_shard != shard)
+    {
+      if (shard != NULL)
+      {
+        rtems_bdbuf_wake_after_transfer (shard,
+                                         wake_transfer_waiters,
+                                         wake_buffer_waiters);
+        rtems_bdbuf_unlock_shard (shard);
+        wake_transfer_waiters = false;
+        wake_buffer_waiters = false;
+      }
 
-    if (waiters)
+      shard = bd_shard;
+      rtems_bdbuf_lock_shard (shard);
+    }
+
+    if (bd->waiters)
       wake_transfer_waiters = true;
     else
       wake_buffer_waiters = true;
@@ -1919,14 +2299,19 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
       rtems_bdbuf_show_users ("transfer", bd);
   }
 
-  if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+  if (shard != NULL)
+    rtems_bdbuf_wake_after_transfer (shard,
+                                     wake_transfer_waiters,
+                                     wake_buffer_waiters);
 
-  if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+  if (shard != locked_shard)
+  {
+    if (shard != NULL)
+      rtems_bdbuf_unlock_shard (shard);
 
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+    if (locked_shard != NULL)
+      rtems_bdbuf_lock_shard (locked_shard);
+  }
 
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
@@ -1934,24 +2319,29 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     return RTEMS_IO_ERROR;
 }
 
-static rtems_status_code
-rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
-                                  rtems_bdbuf_buffer *bd,
-                                  uint32_t            transfer_count)
+/**
+ * Prepare a read request for the buffer and up to transfer count minus one
+ * consecutive blocks following it.  Only blocks of the same shard are added
+ * to the request.
+ *
+ * @param shard The locked shard of the buffer.
+ * @param dd The disk device.
+ * @param bd The buffer to read.
+ * @param req The request with space for at least transfer count buffers.
+ * @param transfer_count The maximum count of blocks to read.
+ */
+static void
+rtems_bdbuf_prepare_read_request (rtems_bdbuf_shard    *shard,
+                                  rtems_disk_device    *dd,
+                                  rtems_bdbuf_buffer   *bd,
+                                  rtems_blkdev_request *req,
+                                  uint32_t              transfer_count)
 {
-  rtems_blkdev_request *req = NULL;
   rtems_blkdev_bnum media_block = bd->block;
   uint32_t media_blocks_per_block = dd->media_blocks_per_block;
   uint32_t block_size = dd->block_size;
   uint32_t transfer_index = 1;
 
-  /*
-   * TODO: This type of request structure is wrong and should be removed.
-   */
-#define bdbuf_alloc(size) __builtin_alloca (size)
-
-  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
-
   req->req = RTEMS_BLKDEV_REQ_READ;
   req->done = rtems_bdbuf_transfer_done;
   req->io_task = rtems_task_self ();
@@ -1971,7 +2361,10 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    if (rtems_bdbuf_shard_of_block (dd, media_block) != shard)
+      break;
+
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
     if (bd == NULL)
       break;
@@ -1990,73 +2383,270 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   }
 
   req->bufnum = transfer_index;
+}
+
+static rtems_status_code
+rtems_bdbuf_execute_read_request (rtems_bdbuf_shard  *shard,
+                                  rtems_disk_device  *dd,
+                                  rtems_bdbuf_buffer *bd,
+                                  uint32_t            transfer_count)
+{
+  rtems_blkdev_request *req = NULL;
+
+  /*
+   * TODO: This type of request structure is wrong and should be removed.
+   */
+#define bdbuf_alloc(size) __builtin_alloca (size)
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
+
+  rtems_bdbuf_prepare_read_request (shard, dd, bd, req, transfer_count);
+
+  return rtems_bdbuf_execute_transfer_request (dd, req, shard);
 }
 
-static bool
-rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
+/*
+ * The read-ahead functions below must be called with the device lock of the
+ * device owned.
+ */
+
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_read_ahead_stream (rtems_disk_device *dd, uint32_t index)
 {
-  return !rtems_chain_is_node_off_chain (&dd->read_ahead.node);
+  if (index == 0)
+    return &dd->read_ahead;
+
+  return &dd->read_ahead_streams [index - 1];
 }
 
-static void
-rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
+static uint32_t
+rtems_bdbuf_read_ahead_stream_index (const rtems_blkdev_read_ahead *stream)
 {
-  if (rtems_bdbuf_is_read_ahead_active (dd))
-  {
-    rtems_chain_extract_unprotected (&dd->read_ahead.node);
-    rtems_chain_set_off_chain (&dd->read_ahead.node);
-  }
+  const rtems_disk_device *dd = stream->dd;
+
+  if (stream == &dd->read_ahead)
+    return 0;
+
+  return (uint32_t) (stream - &dd->read_ahead_streams [0]) + 1;
 }
 
-static void
-rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
+static bool
+rtems_bdbuf_is_read_ahead_active (const rtems_blkdev_read_ahead *stream)
 {
-  rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  return !rtems_chain_is_node_off_chain (&stream->node);
 }
 
 static void
-rtems_bdbuf_read_ahead_add_to_chain (rtems_disk_device *dd)
+rtems_bdbuf_read_ahead_cancel (rtems_blkdev_read_ahead *stream)
 {
-  rtems_status_code sc;
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_interrupt_lock_context lock_context;
 
-  if (rtems_chain_is_empty (chain))
+  rtems_interrupt_lock_acquire_isr (&bdbuf_cache.read_ahead_lock,
+                                    &lock_context);
+
+  if (rtems_bdbuf_is_read_ahead_active (stream))
   {
-    sc = rtems_event_send (bdbuf_cache.read_ahead_task,
-                           RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    if (sc != RTEMS_SUCCESSFUL)
-      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+    rtems_chain_extract_unprotected (&stream->node);
+    rtems_chain_set_off_chain (&stream->node);
   }
 
-  rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+  rtems_interrupt_lock_release_isr (&bdbuf_cache.read_ahead_lock,
+                                    &lock_context);
 }
 
 static void
-rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_read_ahead_reset (rtems_blkdev_read_ahead *stream)
 {
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
-  {
-    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
-    rtems_bdbuf_read_ahead_add_to_chain(dd);
-  }
+  rtems_bdbuf_read_ahead_cancel (stream);
+  stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  stream->window = 0;
 }
 
 static void
-rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
-                                    rtems_blkdev_bnum  block)
+rtems_bdbuf_read_ahead_reset_all (rtems_disk_device *dd)
 {
-  if (dd->read_ahead.trigger != block)
-  {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
-  }
+  uint32_t i;
+
+  for (i = 0; i < bdbuf_cache.read_ahead_streams; ++i)
+    rtems_bdbuf_read_ahead_reset (rtems_bdbuf_read_ahead_stream (dd, i));
+}
+
+/**
+ * Add the stream to the read-ahead chain.
+ *
+ * @retval true The read-ahead task must be woken up after the device lock
+ *   was released.
+ * @retval false Otherwise.
+ */
+static bool
+rtems_bdbuf_read_ahead_add_to_chain (rtems_blkdev_read_ahead *stream)
+{
+  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_interrupt_lock_context lock_context;
+  bool wake_up;
+
+  rtems_interrupt_lock_acquire_isr (&bdbuf_cache.read_ahead_lock,
+                                    &lock_context);
+  wake_up = rtems_chain_is_empty (chain);
+  rtems_chain_append_unprotected (chain, &stream->node);
+  rtems_interrupt_lock_release_isr (&bdbuf_cache.read_ahead_lock,
+                                    &lock_context);
+
+  return wake_up;
+}
+
+static void
+rtems_bdbuf_wake_read_ahead_task (void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send (bdbuf_cache.read_ahead_task,
+                         RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+  if (sc != RTEMS_SUCCESSFUL)
+    rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+}
+
+/**
+ * Returns the stream expecting a read of the block next, otherwise NULL.
+ */
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_find_read_ahead_stream (rtems_disk_device *dd,
+                                    rtems_blkdev_bnum  block)
+{
+  uint32_t i;
+
+  for (i = 0; i < bdbuf_cache.read_ahead_streams; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = rtems_bdbuf_read_ahead_stream (dd, i);
+
+    if (stream->trigger == block)
+      return stream;
+  }
+
+  return NULL;
+}
+
+/**
+ * Returns the least recently used stream of the device.
+ */
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_read_ahead_victim (rtems_disk_device *dd)
+{
+  rtems_blkdev_read_ahead *victim = &dd->read_ahead;
+  uint32_t                 victim_age = dd->read_ahead_stamp - victim->stamp;
+  uint32_t                 i;
+
+  for (i = 1; i < bdbuf_cache.read_ahead_streams; ++i)
+  {
+    rtems_blkdev_read_ahead *stream = rtems_bdbuf_read_ahead_stream (dd, i);
+    uint32_t                 age = dd->read_ahead_stamp - stream->stamp;
+
+    if (age > victim_age)
+    {
+      victim = stream;
+      victim_age = age;
+    }
+  }
+
+  return victim;
+}
+
+static bool
+rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
+                                      rtems_blkdev_bnum  block)
+{
+  rtems_blkdev_read_ahead *stream;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return false;
+
+  stream = rtems_bdbuf_find_read_ahead_stream (dd, block);
+  if (stream == NULL || rtems_bdbuf_is_read_ahead_active (stream))
+    return false;
+
+  /*
+   * Each trigger confirms the sequential access of the stream, so open the
+   * window up to the maximum read-ahead size.
+   */
+  if (stream->window == 0)
+    stream->window = bdbuf_cache.read_ahead_initial_window;
+  else if (stream->window < bdbuf_config.max_read_ahead_blocks / 2)
+    stream->window *= 2;
+  else
+    stream->window = bdbuf_config.max_read_ahead_blocks;
+
+  stream->stamp = ++dd->read_ahead_stamp;
+  stream->nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
+  return rtems_bdbuf_read_ahead_add_to_chain (stream);
+}
+
+static void
+rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
+                                    rtems_blkdev_bnum  block)
+{
+  rtems_blkdev_read_ahead *stream;
+
+  stream = rtems_bdbuf_find_read_ahead_stream (dd, block);
+  if (stream != NULL)
+  {
+    /*
+     * The stream expected this block, but the read-ahead was not fast enough.
+     * A new stream with a window of zero did not issue a read-ahead request
+     * yet, so its first trigger is not a miss.
+     */
+    if (bdbuf_cache.read_ahead_enabled && stream->window != 0)
+      ++dd->stats.read_ahead_misses;
+  }
+  else
+  {
+    stream = rtems_bdbuf_read_ahead_victim (dd);
+    rtems_bdbuf_read_ahead_cancel (stream);
+    stream->trigger = block + 1;
+    stream->next = block + 2;
+    stream->window = 0;
+  }
+
+  stream->stamp = ++dd->read_ahead_stamp;
+}
+
+static void
+rtems_bdbuf_read_ahead_hit (rtems_disk_device *dd, rtems_bdbuf_buffer *bd)
+{
+  if (bd->read_ahead_stream != 0)
+  {
+    ++dd->stats.read_ahead_hits;
+    bd->read_ahead_stream = 0;
+  }
+}
+
+/**
+ * Accounts a buffer which was read ahead and is recycled without being
+ * accessed.  The window of the stream shrinks in this case.  The shard of the
+ * buffer must be locked.
+ */
+static void
+rtems_bdbuf_read_ahead_waste (rtems_bdbuf_buffer *bd)
+{
+  rtems_disk_device           *dd = bd->dd;
+  rtems_blkdev_read_ahead     *stream;
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
+
+  ++dd->stats.read_ahead_waste;
+
+  stream = rtems_bdbuf_read_ahead_stream (dd, bd->read_ahead_stream - 1);
+  if (stream->window > bdbuf_cache.read_ahead_initial_window)
+  {
+    stream->window /= 2;
+
+    if (stream->window < bdbuf_cache.read_ahead_initial_window)
+      stream->window = bdbuf_cache.read_ahead_initial_window;
+  }
+
+  rtems_bdbuf_unlock_device (dd, &lock_context);
+
+  bd->read_ahead_stream = 0;
 }
 
 rtems_status_code
@@ -2066,32 +2656,42 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 {
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer   *bd = NULL;
+  rtems_bdbuf_shard    *shard;
   rtems_blkdev_bnum     media_block;
+  rtems_interrupt_lock_context lock_context;
+  bool                  wake_read_ahead_task;
 
-  rtems_bdbuf_lock_cache ();
-
-  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  sc = rtems_bdbuf_lock_shard_of_block (dd, block, &media_block, &shard);
   if (sc == RTEMS_SUCCESSFUL)
   {
     if (rtems_bdbuf_tracer)
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        rtems_bdbuf_lock_device (dd, &lock_context);
         ++dd->stats.read_hits;
+        rtems_bdbuf_read_ahead_hit (dd, bd);
+        rtems_bdbuf_unlock_device (dd, &lock_context);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
+        rtems_bdbuf_lock_device (dd, &lock_context);
         ++dd->stats.read_hits;
+        rtems_bdbuf_read_ahead_hit (dd, bd);
+        rtems_bdbuf_unlock_device (dd, &lock_context);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        rtems_bdbuf_lock_device (dd, &lock_context);
         ++dd->stats.read_misses;
         rtems_bdbuf_set_read_ahead_trigger (dd, block);
-        sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
+        rtems_bdbuf_unlock_device (dd, &lock_context);
+        bd->read_ahead_stream = 0;
+        sc = rtems_bdbuf_execute_read_request (shard, dd, bd, 1);
         if (sc == RTEMS_SUCCESSFUL)
         {
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
@@ -2108,10 +2708,15 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
+    rtems_bdbuf_lock_device (dd, &lock_context);
+    wake_read_ahead_task = rtems_bdbuf_check_read_ahead_trigger (dd, block);
+    rtems_bdbuf_unlock_device (dd, &lock_context);
+
+    if (wake_read_ahead_task)
+      rtems_bdbuf_wake_read_ahead_task ();
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   *bd_ptr = bd;
 
@@ -2123,21 +2728,25 @@ rtems_bdbuf_peek (rtems_disk_device *dd,
                   rtems_blkdev_bnum block,
                   uint32_t nr_blocks)
 {
-  rtems_bdbuf_lock_cache ();
-
   if (bdbuf_cache.read_ahead_enabled && nr_blocks > 0)
   {
-    rtems_bdbuf_read_ahead_reset(dd);
+    rtems_interrupt_lock_context lock_context;
+    bool                         wake_read_ahead_task;
+
+    rtems_bdbuf_lock_device (dd, &lock_context);
+    rtems_bdbuf_read_ahead_reset(&dd->read_ahead);
     dd->read_ahead.next = block;
     dd->read_ahead.nr_blocks = nr_blocks;
-    rtems_bdbuf_read_ahead_add_to_chain(dd);
-  }
+    wake_read_ahead_task = rtems_bdbuf_read_ahead_add_to_chain(&dd->read_ahead);
+    rtems_bdbuf_unlock_device (dd, &lock_context);
 
-  rtems_bdbuf_unlock_cache ();
+    if (wake_read_ahead_task)
+      rtems_bdbuf_wake_read_ahead_task ();
+  }
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_shard (rtems_bdbuf_buffer *bd, const char *kind)
 {
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
@@ -2146,7 +2755,7 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2156,7 +2765,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2180,7 +2789,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2190,7 +2799,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release modified");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2212,7 +2821,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2222,7 +2831,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "sync");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2244,7 +2853,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (rtems_bdbuf_shard_of_bd (bd));
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2372,7 +2981,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, NULL);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2392,24 +3001,73 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
   }
 }
 
+/**
+ * Update the hold timer of a modified buffer.
+ *
+ * @param bd The modified buffer.  The shard of the buffer must be locked.
+ * @param force If true expire the timer.
+ * @param update_timers If true update the timer.
+ * @param timer_delta It update_timers is true update the timer by this
+ *                    amount.
+ *
+ * @retval true The hold time of the buffer expired.
+ * @retval false Otherwise.
+ */
+static bool
+rtems_bdbuf_swapout_hold_expired (rtems_bdbuf_buffer *bd,
+                                  bool                force,
+                                  bool                update_timers,
+                                  uint32_t            timer_delta)
+{
+  /*
+   * @note Lots of sync requests will skew this timer. It should be based
+   *       on TOD to be accurate. Does it matter ?
+   */
+  if (force)
+    bd->hold_timer = 0;
+
+  if (bd->hold_timer && update_timers)
+  {
+    if (bd->hold_timer > timer_delta)
+      bd->hold_timer -= timer_delta;
+    else
+      bd->hold_timer = 0;
+  }
+
+  return bd->hold_timer == 0;
+}
+
+static bool
+rtems_bdbuf_swapout_batch_full (uint32_t bd_count)
+{
+  return bdbuf_config.swapout_batch_blocks != 0
+    && bd_count >= bdbuf_config.swapout_batch_blocks;
+}
+
 /**
  * Process the modified list of buffers. There is a sync or modified list that
- * needs to be handled so we have a common function to do the work.
+ * needs to be handled so we have a common function to do the work.  The shard
+ * of the list must be locked.
  *
+ * @param shard The shard of the chain.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
  * @param chain The modified chain to process.
  * @param transfer The chain to append buffers to be written too.
+ * @param bd_count The count of buffers on the transfer chain.  No buffers are
+ * added if it reached the configured swap-out batch size.
  * @param sync_active If true this is a sync operation so expire all timers.
  * @param update_timers If true update the timers.
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_shard   *shard,
+                                         rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
+                                         uint32_t*            bd_count,
                                          bool                 sync_active,
                                          bool                 update_timers,
                                          uint32_t             timer_delta)
@@ -2432,33 +3090,20 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
     while (!rtems_chain_is_tail (chain, node))
     {
       rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+      bool                force;
 
       /*
        * Check if the buffer's hold timer has reached 0. If a sync is active
        * or someone waits for a buffer written force all the timers to 0.
-       *
-       * @note Lots of sync requests will skew this timer. It should be based
-       *       on TOD to be accurate. Does it matter ?
        */
-      if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
-        bd->hold_timer = 0;
+      force = sync_all || (sync_active && (*dd_ptr == bd->dd))
+        || rtems_bdbuf_has_buffer_waiters (shard);
 
-      if (bd->hold_timer)
+      if (!rtems_bdbuf_swapout_hold_expired (bd, force, update_timers,
+                                             timer_delta))
       {
-        if (update_timers)
-        {
-          if (bd->hold_timer > timer_delta)
-            bd->hold_timer -= timer_delta;
-          else
-            bd->hold_timer = 0;
-        }
-
-        if (bd->hold_timer)
-        {
-          node = node->next;
-          continue;
-        }
+        node = node->next;
+        continue;
       }
 
       /*
@@ -2469,7 +3114,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
       if (*dd_ptr == BDBUF_INVALID_DEV)
         *dd_ptr = bd->dd;
 
-      if (bd->dd == *dd_ptr)
+      if (bd->dd == *dd_ptr && !rtems_bdbuf_swapout_batch_full (*bd_count))
       {
         rtems_chain_node* next_node = node->next;
         rtems_chain_node* tnode = rtems_chain_tail (transfer);
@@ -2484,6 +3129,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
         rtems_chain_extract_unprotected (node);
+        ++*bd_count;
 
         tnode = tnode->previous;
 
@@ -2513,13 +3159,214 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
   }
 }
 
+/**
+ * Select the device of the buffer which waits the longest time to be written
+ * among the buffers with an expired hold timer.  This is the device selection
+ * of the deadline I/O scheduler.  The hold timers are updated.
+ *
+ * @param update_timers If true update the timers.
+ * @param timer_delta It update_timers is true update the timers by this
+ *                    amount.
+ *
+ * @return The selected device or BDBUF_INVALID_DEV if no buffer is due.
+ */
+static rtems_disk_device *
+rtems_bdbuf_swapout_select_device (bool update_timers, uint32_t timer_delta)
+{
+  rtems_disk_device *dd = BDBUF_INVALID_DEV;
+  rtems_interval     oldest = 0;
+  size_t             s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+    rtems_chain_node  *node;
+    bool               force;
+
+    rtems_bdbuf_lock_shard (shard);
+
+    force = rtems_bdbuf_has_buffer_waiters (shard);
+    node = rtems_chain_first (&shard->modified);
+
+    while (!rtems_chain_is_tail (&shard->modified, node))
+    {
+      rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
+
+      if (rtems_bdbuf_swapout_hold_expired (bd, force, update_timers,
+                                            timer_delta)
+          && (dd == BDBUF_INVALID_DEV
+              || (int32_t) (bd->modified_ticks - oldest) < 0))
+      {
+        dd = bd->dd;
+        oldest = bd->modified_ticks;
+      }
+
+      node = rtems_chain_next (node);
+    }
+
+    rtems_bdbuf_unlock_shard (shard);
+  }
+
+  return dd;
+}
+
+/**
+ * Take the modified buffer of the block for a write.
+ *
+ * @return The buffer in the transfer state or NULL if the block is not
+ *   modified.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_swapout_take_modified (rtems_disk_device *dd,
+                                   rtems_blkdev_bnum  media_block)
+{
+  rtems_bdbuf_shard  *shard = rtems_bdbuf_shard_of_block (dd, media_block);
+  rtems_bdbuf_buffer *bd;
+
+  rtems_bdbuf_lock_shard (shard);
+
+  bd = rtems_bdbuf_avl_search (&shard->tree, dd, media_block);
+  if (bd != NULL && bd->state == RTEMS_BDBUF_STATE_MODIFIED)
+  {
+    rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+    rtems_chain_extract_unprotected (&bd->link);
+  }
+  else
+  {
+    bd = NULL;
+  }
+
+  rtems_bdbuf_unlock_shard (shard);
+
+  return bd;
+}
+
+/**
+ * Merge the modified buffers adjacent to the runs of consecutive blocks on the
+ * sorted transfer list into the runs.  A run is not extended beyond the
+ * maximum write blocks.  This turns several small writes of a device spread
+ * over time into one larger write.
+ *
+ * @param dd The device of the transfer.
+ * @param transfer The sorted transfer list.
+ * @param bd_count The count of buffers on the transfer list.
+ */
+static void
+rtems_bdbuf_swapout_merge_adjacent (rtems_disk_device   *dd,
+                                    rtems_chain_control *transfer,
+                                    uint32_t            *bd_count)
+{
+  uint32_t          media_blocks_per_block = dd->media_blocks_per_block;
+  rtems_chain_node *node = rtems_chain_first (transfer);
+
+  while (!rtems_chain_is_tail (transfer, node))
+  {
+    rtems_bdbuf_buffer *first = (rtems_bdbuf_buffer *) node;
+    rtems_bdbuf_buffer *last = first;
+    uint32_t            run = 1;
+
+    node = rtems_chain_next (node);
+
+    while (!rtems_chain_is_tail (transfer, node)
+           && ((rtems_bdbuf_buffer *) node)->block
+             == last->block + media_blocks_per_block)
+    {
+      last = (rtems_bdbuf_buffer *) node;
+      ++run;
+      node = rtems_chain_next (node);
+    }
+
+    while (run < bdbuf_config.max_write_blocks
+           && !rtems_bdbuf_swapout_batch_full (*bd_count)
+           && first->block >= dd->start + media_blocks_per_block)
+    {
+      rtems_bdbuf_buffer *bd = rtems_bdbuf_swapout_take_modified (
+        dd,
+        first->block - media_blocks_per_block
+      );
+
+      if (bd == NULL)
+        break;
+
+      rtems_chain_insert_unprotected (rtems_chain_previous (&first->link),
+                                      &bd->link);
+      first = bd;
+      ++run;
+      ++*bd_count;
+    }
+
+    while (run < bdbuf_config.max_write_blocks
+           && !rtems_bdbuf_swapout_batch_full (*bd_count))
+    {
+      rtems_bdbuf_buffer *bd = rtems_bdbuf_swapout_take_modified (
+        dd,
+        last->block + media_blocks_per_block
+      );
+
+      if (bd == NULL)
+        break;
+
+      rtems_chain_insert_unprotected (&last->link, &bd->link);
+      last = bd;
+      ++run;
+      ++*bd_count;
+    }
+  }
+}
+
+/**
+ * Rotate the sorted transfer list so that the write continues at the block
+ * following the previous write of the device.  The device is swept in a
+ * circular manner (C-SCAN).
+ *
+ * @param dd The device of the transfer.
+ * @param transfer The sorted transfer list.  It must not be empty.
+ */
+static void
+rtems_bdbuf_swapout_continue_sweep (rtems_disk_device   *dd,
+                                    rtems_chain_control *transfer)
+{
+  rtems_interrupt_lock_context lock_context;
+  rtems_blkdev_bnum            position;
+  rtems_bdbuf_buffer          *last;
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
+  position = dd->swapout_position;
+  rtems_bdbuf_unlock_device (dd, &lock_context);
+
+  last = (rtems_bdbuf_buffer *) rtems_chain_last (transfer);
+
+  /*
+   * If all blocks are below the position, then the sweep starts again at the
+   * begin of the device.
+   */
+  if (last->block >= position)
+  {
+    rtems_chain_node *node = rtems_chain_first (transfer);
+
+    while (((rtems_bdbuf_buffer *) node)->block < position)
+    {
+      rtems_chain_extract_unprotected (node);
+      rtems_chain_append_unprotected (transfer, node);
+      node = rtems_chain_first (transfer);
+    }
+  }
+
+  last = (rtems_bdbuf_buffer *) rtems_chain_last (transfer);
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
+  dd->swapout_position = last->block + dd->media_blocks_per_block;
+  rtems_bdbuf_unlock_device (dd, &lock_context);
+}
+
 /**
  * Process the cache's modified buffers. Check the sync list first then the
  * modified list extracting the buffers suitable to be written to disk. We have
  * a device at a time. The task level loop will repeat this operation while
  * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * back on the modified list and try again later. The shards are processed one
+ * after the other and each shard is only locked while its lists are processed.
+ * No lock is owned while the buffers are being written to disk.
  *
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
@@ -2537,6 +3384,8 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
+  uint32_t                    bd_count = 0;
+  size_t                      s;
 
   rtems_bdbuf_lock_cache ();
 
@@ -2576,38 +3425,74 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   if (sync_active)
     transfer->dd = bdbuf_cache.sync_device;
 
+  rtems_bdbuf_unlock_cache ();
+
   /*
-   * If we have any buffers in the sync queue move them to the modified
+   * If we have any buffers in the sync queues move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
-                                           &transfer->bds,
-                                           true, false,
-                                           timer_delta);
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_bdbuf_lock_shard (shard);
+    rtems_bdbuf_swapout_modified_processing (shard,
+                                             &transfer->dd,
+                                             &shard->sync,
+                                             &transfer->bds,
+                                             &bd_count,
+                                             true, false,
+                                             timer_delta);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
-   * Process the cache's modified list.
+   * The deadline I/O scheduler serves the device which waits the longest time
+   * instead of the device of the first buffer found.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
-                                           &transfer->bds,
-                                           sync_active,
-                                           update_timers,
-                                           timer_delta);
+  if (bdbuf_config.io_scheduler == RTEMS_BDBUF_IO_SCHEDULER_DEADLINE
+      && !sync_active
+      && transfer->dd == BDBUF_INVALID_DEV)
+  {
+    transfer->dd = rtems_bdbuf_swapout_select_device (update_timers,
+                                                      timer_delta);
+    update_timers = false;
+  }
 
   /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
+   * Process the modified lists of the shards.  We have all the buffers that
+   * have been modified for this device afterwards.  The state of each buffer
+   * has been set to TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_bdbuf_lock_shard (shard);
+    rtems_bdbuf_swapout_modified_processing (shard,
+                                             &transfer->dd,
+                                             &shard->modified,
+                                             &transfer->bds,
+                                             &bd_count,
+                                             sync_active,
+                                             update_timers,
+                                             timer_delta);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
    * If there are buffers to transfer to the media transfer them.
    */
   if (!rtems_chain_is_empty (&transfer->bds))
   {
+    if (bdbuf_config.io_scheduler != RTEMS_BDBUF_IO_SCHEDULER_SORT)
+    {
+      rtems_bdbuf_swapout_merge_adjacent (transfer->dd,
+                                          &transfer->bds,
+                                          &bd_count);
+      rtems_bdbuf_swapout_continue_sweep (transfer->dd, &transfer->bds);
+    }
+
     if (worker)
     {
       rtems_status_code sc = rtems_event_send (worker->id,
@@ -2774,7 +3659,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_shard   *shard,
+                        rtems_chain_control *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -2790,16 +3676,17 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_shard       *shard,
+                              rtems_chain_control     *purge_list,
                               const rtems_disk_device *dd)
 {
   rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
   rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  rtems_bdbuf_buffer *cur = shard->tree;
 
   *prev = NULL;
 
@@ -2815,7 +3702,7 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
         case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
           break;
         case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+          rtems_bdbuf_wake (&shard->transfer_waiters);
           /* Fall through */
         case RTEMS_BDBUF_STATE_MODIFIED:
           rtems_bdbuf_group_release (cur);
@@ -2870,23 +3757,38 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
   }
 }
 
+/**
+ * Purge the buffers of the device. All shards must be locked.
+ *
+ * @param dd The disk device.
+ */
 static void
 rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
 {
-  rtems_chain_control purge_list;
+  rtems_interrupt_lock_context lock_context;
+  size_t s;
 
-  rtems_chain_initialize_empty (&purge_list);
-  rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+  rtems_bdbuf_lock_device (dd, &lock_context);
+  rtems_bdbuf_read_ahead_reset_all (dd);
+  rtems_bdbuf_unlock_device (dd, &lock_context);
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+    rtems_chain_control purge_list;
+
+    rtems_chain_initialize_empty (&purge_list);
+    rtems_bdbuf_gather_for_purge (shard, &purge_list, dd);
+    rtems_bdbuf_purge_list (shard, &purge_list);
+  }
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
   rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 }
 
 rtems_status_code
@@ -2903,7 +3805,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     (void) rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
 
   if (block_size > 0)
   {
@@ -2941,57 +3843,159 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 
   return sc;
 }
 
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_read_ahead_get_next (rtems_blkdev_bnum *block_ptr,
+                                 uint32_t          *nr_blocks_ptr)
+{
+  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_chain_node *node;
+  rtems_blkdev_read_ahead *stream;
+  rtems_disk_device *dd;
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_interrupt_lock_acquire (&bdbuf_cache.read_ahead_lock, &lock_context);
+  node = rtems_chain_get_unprotected (chain);
+  if (node != NULL)
+    rtems_chain_set_off_chain (node);
+  rtems_interrupt_lock_release (&bdbuf_cache.read_ahead_lock, &lock_context);
+
+  if (node == NULL)
+    return NULL;
+
+  stream = RTEMS_CONTAINER_OF (node, rtems_blkdev_read_ahead, node);
+  dd = stream->dd;
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
+  *block_ptr = stream->next;
+  *nr_blocks_ptr = stream->nr_blocks;
+  rtems_bdbuf_unlock_device (dd, &lock_context);
+
+  return stream;
+}
+
+/**
+ * Read ahead the blocks starting with the buffer. The read is split into one
+ * transfer request for each shard covered by the blocks.
+ *
+ * @param shard The locked shard of the buffer. It is unlocked on return.
+ * @param stream The read-ahead stream.  The buffers read are marked with it to
+ *   account for read-ahead hits and waste.
+ * @param bd The first buffer to read.
+ * @param req The request with space for at least transfer count buffers.
+ * @param transfer_count The count of blocks to read.
+ */
+static void
+rtems_bdbuf_execute_read_ahead (rtems_bdbuf_shard       *shard,
+                                rtems_blkdev_read_ahead *stream,
+                                rtems_bdbuf_buffer      *bd,
+                                rtems_blkdev_request    *req,
+                                uint32_t                 transfer_count)
+{
+  rtems_disk_device *dd = stream->dd;
+  uint8_t mark = (uint8_t) (rtems_bdbuf_read_ahead_stream_index (stream) + 1);
+
+  while (true)
+  {
+    rtems_blkdev_bnum media_block;
+    uint32_t          bufnum;
+    uint32_t          i;
+
+    rtems_bdbuf_prepare_read_request (shard, dd, bd, req, transfer_count);
+    bufnum = req->bufnum;
+
+    for (i = 0; i < bufnum; ++i)
+    {
+      rtems_bdbuf_buffer *rd = req->bufs [i].user;
+
+      rd->read_ahead_stream = mark;
+    }
+
+    media_block = bd->block + bufnum * dd->media_blocks_per_block;
+    transfer_count -= bufnum;
+    rtems_bdbuf_execute_transfer_request (dd, req, shard);
+
+    /*
+     * Continue in the next shard if the request stopped at a shard boundary.
+     * A block cached in the current shard ends the read-ahead.
+     */
+    if (transfer_count == 0
+        || rtems_bdbuf_shard_of_block (dd, media_block) == shard)
+      break;
+
+    rtems_bdbuf_unlock_shard (shard);
+    shard = rtems_bdbuf_shard_of_block (dd, media_block);
+    rtems_bdbuf_lock_shard (shard);
+
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
+    if (bd == NULL)
+      break;
+  }
+
+  rtems_bdbuf_unlock_shard (shard);
+}
+
 static rtems_task
 rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 {
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_blkdev_request *req;
+
+  req = bdbuf_alloc (
+    rtems_bdbuf_read_request_size (bdbuf_config.max_read_ahead_blocks)
+  );
 
   while (bdbuf_cache.read_ahead_enabled)
   {
-    rtems_chain_node *node;
+    rtems_blkdev_read_ahead *stream;
+    rtems_blkdev_bnum        block;
+    uint32_t                 nr_blocks;
 
     rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
 
-    while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+    while ((stream = rtems_bdbuf_read_ahead_get_next (&block, &nr_blocks))
+           != NULL)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
+      rtems_disk_device *dd = stream->dd;
+      rtems_bdbuf_shard *shard;
       rtems_blkdev_bnum media_block = 0;
+      rtems_interrupt_lock_context lock_context;
       rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
-
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+        rtems_bdbuf_lock_shard_of_block (dd, block, &media_block, &shard);
 
       if (sc == RTEMS_SUCCESSFUL)
       {
         rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+          rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
         if (bd != NULL)
         {
-          uint32_t transfer_count = dd->read_ahead.nr_blocks;
+          uint32_t transfer_count = nr_blocks;
           uint32_t blocks_until_end_of_disk = dd->block_count - block;
           uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
 
+          rtems_bdbuf_lock_device (dd, &lock_context);
+
           if (transfer_count == RTEMS_DISK_READ_AHEAD_SIZE_AUTO) {
+            uint32_t window = stream->window;
+
+            if (window == 0)
+              window = bdbuf_cache.read_ahead_initial_window;
+
             transfer_count = blocks_until_end_of_disk;
 
-            if (transfer_count >= max_transfer_count)
+            if (transfer_count >= window)
             {
-              transfer_count = max_transfer_count;
-              dd->read_ahead.trigger = block + transfer_count / 2;
-              dd->read_ahead.next = block + transfer_count;
+              transfer_count = window;
+              stream->trigger = block + transfer_count / 2;
+              stream->next = block + transfer_count;
             }
             else
             {
-              dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+              stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
             }
           } else {
             if (transfer_count > blocks_until_end_of_disk) {
@@ -3006,16 +4010,25 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
           }
 
           ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
+          rtems_bdbuf_unlock_device (dd, &lock_context);
+
+          rtems_bdbuf_execute_read_ahead (shard, stream, bd, req,
+                                          transfer_count);
+        }
+        else
+        {
+          rtems_bdbuf_unlock_shard (shard);
         }
       }
       else
       {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_unlock_shard (shard);
+
+        rtems_bdbuf_lock_device (dd, &lock_context);
+        stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_unlock_device (dd, &lock_context);
       }
     }
-
-    rtems_bdbuf_unlock_cache ();
   }
 
   rtems_task_exit();
@@ -3024,14 +4037,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_device (dd, &lock_context);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_lock_device (dd, &lock_context);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_device (dd, &lock_context);
 }
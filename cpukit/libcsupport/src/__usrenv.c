@@ -260,7 +260,7 @@ rtems_filesystem_global_location_t rtems_filesystem_global_location_null = {
    *  o the root node of the null file system instance, and
    *  o the mount point node of the null file system instance.
    */
-  .reference_count = 4
+  .reference_count = ATOMIC_INITIALIZER_UINT( 4 )
 };
 
 rtems_user_env_t rtems_global_user_env = {
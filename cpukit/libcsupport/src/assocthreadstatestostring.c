@@ -51,6 +51,7 @@ static const rtems_assoc_32_pair state_pairs[] = {
   { STATES_SUSPENDED,                      "SUSP" },
   { STATES_WAITING_FOR_SEGMENT,            "SEG" },
   { STATES_LIFE_IS_CHANGING,               "LIFE" },
+  { STATES_WAITING_FOR_WORK,               "WORK" },
   { STATES_DEBUGGER,                       "DBG" },
   { STATES_INTERRUPTIBLE_BY_SIGNAL,        "IS" },
   { STATES_WAITING_FOR_RPC_REPLY,          "RPC" },
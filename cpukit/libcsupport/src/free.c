@@ -89,9 +89,20 @@ void free(
   void *ptr
 )
 {
+  const Malloc_Cache_operations *cache;
+
   if ( !ptr )
     return;
 
+  /*
+   *  The cache may be used in a critical section or ISR.
+   */
+  cache = _Malloc_Cache;
+
+  if ( cache != NULL && ( *cache->free )( ptr ) ) {
+    return;
+  }
+
   /*
    *  Do not attempt to free memory if in a critical section or ISR.
    */
@@ -81,10 +81,19 @@ void *rtems_heap_allocate_aligned_with_boundary(
 )
 {
   Heap_Control *heap = RTEMS_Malloc_Heap;
+  const Malloc_Cache_operations *cache = _Malloc_Cache;
   void *p;
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if ( cache != NULL && alignment == 0 && boundary == 0 ) {
+        p = ( *cache->allocate )( size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
@@ -93,6 +102,20 @@ void *rtems_heap_allocate_aligned_with_boundary(
         alignment,
         boundary
       );
+
+      if ( p == NULL && cache != NULL ) {
+        /*
+         *  The memory may be held by the caches of other processors.
+         */
+        ( *cache->flush )();
+        p = _Heap_Allocate_aligned_with_boundary(
+          heap,
+          size,
+          alignment,
+          boundary
+        );
+      }
+
       _RTEMS_Unlock_allocator();
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
@@ -53,6 +53,50 @@ Malloc_System_state _Malloc_System_state( void );
 
 void _Malloc_Process_deferred_frees( void );
 
+/**
+ * @brief The C program heap cache operations.
+ */
+typedef struct {
+  /**
+   * @brief Tries to allocate a block of the specified size from the cache.
+   *
+   * This operation shall be called in the MALLOC_SYSTEM_STATE_NORMAL state
+   * without the allocator lock.  It may refill the cache from the heap.
+   *
+   * @return Returns the begin of the allocated memory area, otherwise NULL.
+   */
+  void *( *allocate )( size_t size );
+
+  /**
+   * @brief Tries to put the memory area into the cache.
+   *
+   * This operation may be called in every system state and from interrupt
+   * context.  It may drain the cache to the heap in the
+   * MALLOC_SYSTEM_STATE_NORMAL state.
+   *
+   * @retval true The memory area was released by the cache.
+   *
+   * @retval false The memory area is not cacheable or the cache is full.  The
+   *   caller is responsible to free the memory area.
+   */
+  bool ( *free )( void *ptr );
+
+  /**
+   * @brief Returns all cached memory areas to the heap.
+   *
+   * This operation shall be called in the MALLOC_SYSTEM_STATE_NORMAL state.
+   */
+  void ( *flush )( void );
+} Malloc_Cache_operations;
+
+/**
+ * @brief The cache operations of the C program heap.
+ *
+ * If this pointer is NULL, then no cache is used.  It is set by
+ * _Malloc_Enable_per_CPU_cache().
+ */
+extern const Malloc_Cache_operations *_Malloc_Cache;
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
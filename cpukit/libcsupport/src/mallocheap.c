@@ -42,8 +42,12 @@
 #include <rtems/sysinit.h>
 #include <rtems/score/wkspacedata.h>
 
+#include "malloc_p.h"
+
 Heap_Control *RTEMS_Malloc_Heap;
 
+const Malloc_Cache_operations *_Malloc_Cache;
+
 void _Malloc_Initialize( void )
 {
   RTEMS_Malloc_Heap = ( *_Workspace_Malloc_initializer )();
@@ -40,13 +40,29 @@
 #include <rtems/malloc.h>
 #include <rtems/score/protectedheap.h>
 
+#include "malloc_p.h"
+
 int malloc_info(
   Heap_Information_block *the_info
 )
 {
+  const Malloc_Cache_operations *cache;
+
   if ( !the_info )
     return -1;
 
+  /*
+   *  Return the cached memory areas to the heap, so that they are reported as
+   *  free.
+   */
+  cache = _Malloc_Cache;
+
+  if (
+    cache != NULL && _Malloc_System_state() == MALLOC_SYSTEM_STATE_NORMAL
+  ) {
+    ( *cache->flush )();
+  }
+
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
   return 0;
 }
@@ -0,0 +1,396 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief This source file contains the implementation of
+ *   _Malloc_Enable_per_CPU_cache() and the per-processor cache of the C
+ *   program heap.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "malloc_p.h"
+
+#include <string.h>
+
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpudata.h>
+
+/*
+ * The cache provides for each processor a magazine of cached memory areas for
+ * each size class.  The size classes are powers of two from 16 bytes up to 256
+ * bytes.  A memory area is put into the magazine of the greatest size class
+ * which is less than or equal to its usable size.  The cached memory areas are
+ * allocated blocks from the point of view of the heap.  Magazines are refilled
+ * and drained in batches, so that the allocator lock is only obtained once
+ * for a batch of operations.
+ */
+
+#define MALLOC_CACHE_MIN_SIZE_SHIFT 4
+
+#define MALLOC_CACHE_CLASS_COUNT 5
+
+#define MALLOC_CACHE_MIN_SIZE ( (size_t) 1 << MALLOC_CACHE_MIN_SIZE_SHIFT )
+
+#define MALLOC_CACHE_MAX_SIZE \
+  ( MALLOC_CACHE_MIN_SIZE << ( MALLOC_CACHE_CLASS_COUNT - 1 ) )
+
+#define MALLOC_CACHE_CAPACITY 16
+
+#define MALLOC_CACHE_BATCH ( MALLOC_CACHE_CAPACITY / 2 )
+
+typedef struct {
+  size_t count;
+  void *areas[ MALLOC_CACHE_CAPACITY ];
+} Malloc_Magazine;
+
+typedef struct {
+#if ISR_LOCK_NEEDS_OBJECT
+  ISR_lock_Control Lock;
+#endif
+  Malloc_Magazine magazines[ MALLOC_CACHE_CLASS_COUNT ];
+} Malloc_Per_CPU_cache;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Malloc_Per_CPU_cache, _Malloc_Per_CPU_cache );
+
+static Malloc_Per_CPU_cache *_Malloc_Per_CPU_cache_get(
+  const Per_CPU_Control *cpu
+)
+{
+  Malloc_Per_CPU_cache *cache;
+
+  cache = PER_CPU_DATA_GET( cpu, Malloc_Per_CPU_cache, _Malloc_Per_CPU_cache );
+  return cache;
+}
+
+static Malloc_Per_CPU_cache *_Malloc_Per_CPU_cache_acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  Malloc_Per_CPU_cache *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = _Malloc_Per_CPU_cache_get( _Per_CPU_Get() );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Malloc_Per_CPU_cache_release(
+  Malloc_Per_CPU_cache *cache,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static size_t _Malloc_Per_CPU_cache_bit_count( size_t value )
+{
+  return sizeof( unsigned long ) * 8 - (size_t) __builtin_clzl( value );
+}
+
+static size_t _Malloc_Per_CPU_cache_allocation_class( size_t size )
+{
+  if ( size <= MALLOC_CACHE_MIN_SIZE ) {
+    return 0;
+  }
+
+  return _Malloc_Per_CPU_cache_bit_count( size - 1 )
+    - MALLOC_CACHE_MIN_SIZE_SHIFT;
+}
+
+static size_t _Malloc_Per_CPU_cache_area_class( size_t usable_size )
+{
+  return _Malloc_Per_CPU_cache_bit_count( usable_size ) - 1
+    - MALLOC_CACHE_MIN_SIZE_SHIFT;
+}
+
+static void _Malloc_Per_CPU_cache_free_to_heap(
+  void   *areas[ MALLOC_CACHE_BATCH ],
+  size_t  count
+)
+{
+  Heap_Control *heap;
+  size_t        i;
+
+  heap = RTEMS_Malloc_Heap;
+  _RTEMS_Lock_allocator();
+
+  for ( i = 0; i < count; ++i ) {
+    if ( !_Heap_Free( heap, areas[ i ] ) ) {
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) areas[ i ]
+      );
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+static void *_Malloc_Per_CPU_cache_allocate( size_t size )
+{
+  Malloc_Per_CPU_cache *cache;
+  Malloc_Magazine      *magazine;
+  ISR_lock_Context      lock_context;
+  Heap_Control         *heap;
+  void                 *areas[ MALLOC_CACHE_BATCH ];
+  void                 *p;
+  size_t                class_index;
+  size_t                count;
+
+  if ( size > MALLOC_CACHE_MAX_SIZE ) {
+    return NULL;
+  }
+
+  class_index = _Malloc_Per_CPU_cache_allocation_class( size );
+
+  cache = _Malloc_Per_CPU_cache_acquire( &lock_context );
+  magazine = &cache->magazines[ class_index ];
+
+  if ( magazine->count > 0 ) {
+    --magazine->count;
+    p = magazine->areas[ magazine->count ];
+    _Malloc_Per_CPU_cache_release( cache, &lock_context );
+    return p;
+  }
+
+  _Malloc_Per_CPU_cache_release( cache, &lock_context );
+
+  /* Refill the magazine with a batch of memory areas */
+  heap = RTEMS_Malloc_Heap;
+  size = MALLOC_CACHE_MIN_SIZE << class_index;
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( count = 0; count < MALLOC_CACHE_BATCH; ++count ) {
+    p = _Heap_Allocate( heap, size );
+
+    if ( p == NULL ) {
+      break;
+    }
+
+    areas[ count ] = p;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( count == 0 ) {
+    return NULL;
+  }
+
+  /*
+   * The executing thread may have migrated to another processor in the
+   * meantime, so use the magazine of the current processor.
+   */
+  --count;
+  p = areas[ count ];
+  cache = _Malloc_Per_CPU_cache_acquire( &lock_context );
+  magazine = &cache->magazines[ class_index ];
+
+  while ( count > 0 && magazine->count < MALLOC_CACHE_CAPACITY ) {
+    --count;
+    magazine->areas[ magazine->count ] = areas[ count ];
+    ++magazine->count;
+  }
+
+  _Malloc_Per_CPU_cache_release( cache, &lock_context );
+
+  if ( count > 0 ) {
+    _Malloc_Per_CPU_cache_free_to_heap( areas, count );
+  }
+
+  return p;
+}
+
+static bool _Malloc_Per_CPU_cache_free( void *ptr )
+{
+  Malloc_Per_CPU_cache *cache;
+  Malloc_Magazine      *magazine;
+  ISR_lock_Context      lock_context;
+  Heap_Control         *heap;
+  Heap_Block           *block;
+  Heap_Block           *next_block;
+  void                 *areas[ MALLOC_CACHE_BATCH ];
+  uintptr_t             usable_size;
+  size_t                class_index;
+  size_t                i;
+
+  heap = RTEMS_Malloc_Heap;
+  block = _Heap_Block_of_alloc_area( (uintptr_t) ptr, heap->page_size );
+
+  if ( !_Heap_Is_block_in_heap( heap, block ) ) {
+    return false;
+  }
+
+  /*
+   * Only allocated blocks may be cached.  Let the heap free path report an
+   * invalid free of a block which is not in use.
+   */
+  next_block = _Heap_Block_at( block, _Heap_Block_size( block ) );
+
+  if (
+    !_Heap_Is_block_in_heap( heap, next_block )
+      || !_Heap_Is_prev_used( next_block )
+  ) {
+    return false;
+  }
+
+  usable_size = (uintptr_t) block + _Heap_Block_size( block )
+    + HEAP_ALLOC_BONUS - (uintptr_t) ptr;
+
+  if (
+    usable_size < MALLOC_CACHE_MIN_SIZE
+      || usable_size >= 2 * MALLOC_CACHE_MAX_SIZE
+  ) {
+    return false;
+  }
+
+  class_index = _Malloc_Per_CPU_cache_area_class( usable_size );
+
+  cache = _Malloc_Per_CPU_cache_acquire( &lock_context );
+  magazine = &cache->magazines[ class_index ];
+
+  /*
+   * A memory area which is already in the magazine is an allocated block from
+   * the point of view of the heap, so the heap cannot detect this double free.
+   */
+  for ( i = 0; i < magazine->count; ++i ) {
+    if ( magazine->areas[ i ] == ptr ) {
+      _Malloc_Per_CPU_cache_release( cache, &lock_context );
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) ptr
+      );
+    }
+  }
+
+  if ( magazine->count < MALLOC_CACHE_CAPACITY ) {
+    magazine->areas[ magazine->count ] = ptr;
+    ++magazine->count;
+    _Malloc_Per_CPU_cache_release( cache, &lock_context );
+    return true;
+  }
+
+  if ( _Malloc_System_state() != MALLOC_SYSTEM_STATE_NORMAL ) {
+    _Malloc_Per_CPU_cache_release( cache, &lock_context );
+    return false;
+  }
+
+  /* Drain a batch of the least recently cached memory areas */
+  memcpy( areas, &magazine->areas[ 0 ], sizeof( areas ) );
+  memmove(
+    &magazine->areas[ 0 ],
+    &magazine->areas[ MALLOC_CACHE_BATCH ],
+    ( MALLOC_CACHE_CAPACITY - MALLOC_CACHE_BATCH ) * sizeof( void * )
+  );
+  magazine->count = MALLOC_CACHE_CAPACITY - MALLOC_CACHE_BATCH;
+  magazine->areas[ magazine->count ] = ptr;
+  ++magazine->count;
+  _Malloc_Per_CPU_cache_release( cache, &lock_context );
+
+  _Malloc_Per_CPU_cache_free_to_heap( areas, MALLOC_CACHE_BATCH );
+  return true;
+}
+
+static void _Malloc_Per_CPU_cache_flush( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Per_CPU_cache *cache;
+    size_t                i;
+
+    cache = _Malloc_Per_CPU_cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+
+    for ( i = 0; i < MALLOC_CACHE_CLASS_COUNT; ++i ) {
+      Malloc_Magazine *magazine;
+      void            *areas[ MALLOC_CACHE_BATCH ];
+      size_t           count;
+
+      magazine = &cache->magazines[ i ];
+
+      do {
+        ISR_lock_Context lock_context;
+
+        /* Bound the time interrupts are disabled by a batch of the areas */
+        _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+        count = 0;
+
+        while ( count < MALLOC_CACHE_BATCH && magazine->count > 0 ) {
+          --magazine->count;
+          areas[ count ] = magazine->areas[ magazine->count ];
+          ++count;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+        if ( count > 0 ) {
+          _Malloc_Per_CPU_cache_free_to_heap( areas, count );
+        }
+      } while ( count == MALLOC_CACHE_BATCH );
+    }
+  }
+}
+
+static const Malloc_Cache_operations _Malloc_Per_CPU_cache_operations = {
+  .allocate = _Malloc_Per_CPU_cache_allocate,
+  .free = _Malloc_Per_CPU_cache_free,
+  .flush = _Malloc_Per_CPU_cache_flush
+};
+
+void _Malloc_Enable_per_CPU_cache( void )
+{
+#if ISR_LOCK_NEEDS_OBJECT
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Per_CPU_cache *cache;
+
+    cache = _Malloc_Per_CPU_cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_Initialize( &cache->Lock, "Malloc Cache" );
+  }
+#endif
+
+  _Malloc_Cache = &_Malloc_Per_CPU_cache_operations;
+}
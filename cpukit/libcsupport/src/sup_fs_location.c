@@ -39,6 +39,7 @@
 #include <stdlib.h>
 
 #include <rtems/libio_.h>
+#include <rtems/rcu.h>
 
 rtems_interrupt_lock rtems_filesystem_mt_entry_lock_control =
   RTEMS_INTERRUPT_LOCK_INITIALIZER("mount table entry");
@@ -91,7 +92,7 @@ rtems_filesystem_global_location_t *rtems_filesystem_location_transform_to_globa
   rtems_filesystem_global_location_t *global_loc = malloc(sizeof(*global_loc));
 
   if (global_loc != NULL) {
-    global_loc->reference_count = 1;
+    _Atomic_Init_uint(&global_loc->reference_count, 1);
     global_loc->deferred_released_next = NULL;
     global_loc->deferred_released_count = 0;
     rtems_filesystem_location_copy(&global_loc->location, loc);
@@ -115,7 +116,7 @@ void rtems_filesystem_global_location_assign(
 
   rtems_filesystem_mt_entry_lock(lock_context);
   lhs_global_loc = *lhs_global_loc_ptr;
-  *lhs_global_loc_ptr = rhs_global_loc;
+  RTEMS_RCU_PUBLISH(lhs_global_loc_ptr, rhs_global_loc);
   rtems_filesystem_mt_entry_unlock(lock_context);
 
   rtems_filesystem_global_location_release(lhs_global_loc, true);
@@ -129,17 +130,25 @@ static void release_with_count(
   rtems_filesystem_mount_table_entry_t *mt_entry =
     global_loc->location.mt_entry;
   rtems_filesystem_mt_entry_declare_lock_context(lock_context);
+  unsigned int previous_count;
   bool do_free;
   bool do_unmount;
 
   rtems_filesystem_mt_entry_lock(lock_context);
-  global_loc->reference_count -= count;
-  do_free = global_loc->reference_count == 0;
+  previous_count = _Atomic_Fetch_sub_uint(
+    &global_loc->reference_count,
+    (unsigned int) count,
+    ATOMIC_ORDER_SEQ_CST
+  );
+  do_free = previous_count == (unsigned int) count;
   do_unmount = rtems_filesystem_is_ready_for_unmount(mt_entry);
   rtems_filesystem_mt_entry_unlock(lock_context);
 
   if (do_free) {
     rtems_filesystem_location_free(&global_loc->location);
+
+    /* Lock-free readers may still reference the global location */
+    rtems_rcu_synchronize();
     free(global_loc);
   }
 
@@ -172,6 +181,66 @@ static void deferred_release(void)
   } while (current != NULL);
 }
 
+static bool try_obtain(rtems_filesystem_global_location_t *global_loc)
+{
+  unsigned int count;
+
+  count = _Atomic_Load_uint(&global_loc->reference_count, ATOMIC_ORDER_RELAXED);
+
+  do {
+    /* A zero reference count indicates a global location about to be freed */
+    if (count == 0) {
+      return false;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      &global_loc->reference_count,
+      &count,
+      count + 1,
+      ATOMIC_ORDER_SEQ_CST,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  /*
+   * This fence pairs with the fence in
+   * rtems_filesystem_is_ready_for_unmount().
+   */
+  _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+  return true;
+}
+
+static rtems_filesystem_global_location_t *obtain_without_lock(
+  rtems_filesystem_global_location_t *const *global_loc_ptr
+)
+{
+  rtems_filesystem_global_location_t *global_loc;
+  bool obtained;
+
+  rtems_rcu_read_lock();
+  global_loc = RTEMS_RCU_DEREFERENCE(global_loc_ptr);
+  obtained = global_loc != NULL
+    && global_loc->location.mt_entry->mounted
+    && try_obtain(global_loc);
+  rtems_rcu_read_unlock();
+
+  if (!obtained) {
+    return NULL;
+  }
+
+  /*
+   * The file system instance may be in the process of an unmount.  The
+   * reference obtained above keeps the mount table entry alive.
+   */
+  if (!global_loc->location.mt_entry->mounted) {
+    release_with_count(global_loc, 1);
+    return NULL;
+  }
+
+  return global_loc;
+}
+
 rtems_filesystem_global_location_t *rtems_filesystem_global_location_obtain(
   rtems_filesystem_global_location_t *const *global_loc_ptr
 )
@@ -183,13 +252,18 @@ rtems_filesystem_global_location_t *rtems_filesystem_global_location_obtain(
     deferred_release();
   }
 
+  global_loc = obtain_without_lock(global_loc_ptr);
+  if (global_loc != NULL) {
+    return global_loc;
+  }
+
   rtems_filesystem_mt_entry_lock(lock_context);
   global_loc = *global_loc_ptr;
   if (global_loc == NULL || !global_loc->location.mt_entry->mounted) {
     global_loc = &rtems_filesystem_global_location_null;
     errno = ENXIO;
   }
-  ++global_loc->reference_count;
+  _Atomic_Fetch_add_uint(&global_loc->reference_count, 1, ATOMIC_ORDER_SEQ_CST);
   rtems_filesystem_mt_entry_unlock(lock_context);
 
   return global_loc;
@@ -257,5 +331,7 @@ void rtems_filesystem_do_unmount(
     }
   }
 
+  /* Lock-free readers may still reference the mount table entry */
+  rtems_rcu_synchronize();
   free(mt_entry);
 }
@@ -38,6 +38,8 @@
 
 #include <rtems/imfs.h>
 
+#include <string.h>
+
 IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_jnode_t *node,
   void *arg
@@ -46,6 +48,7 @@ IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_directory_t *dir = (IMFS_directory_t *) node;
 
   rtems_chain_initialize_empty( &dir->Entries );
+  memset( &dir->Index, 0, sizeof( dir->Index ) );
 
   return node;
 }
@@ -69,3 +72,9 @@ IMFS_jnode_t *IMFS_node_remove_directory( IMFS_jnode_t *node )
 
   return &dir->Node;
 }
+
+void IMFS_node_destroy_directory( IMFS_jnode_t *node )
+{
+  IMFS_directory_index_destroy( (IMFS_directory_t *) node );
+  IMFS_node_destroy_default( node );
+}
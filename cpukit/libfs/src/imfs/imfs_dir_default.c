@@ -163,7 +163,7 @@ const IMFS_mknod_control IMFS_mknod_control_dir_default = {
     .handlers = &IMFS_dir_default_handlers,
     .node_initialize = IMFS_node_initialize_directory,
     .node_remove = IMFS_node_remove_directory,
-    .node_destroy = IMFS_node_destroy_default
+    .node_destroy = IMFS_node_destroy_directory
   },
   .node_size = sizeof( IMFS_directory_t )
 };
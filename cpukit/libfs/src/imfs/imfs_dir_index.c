@@ -0,0 +1,227 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief This source file contains the implementation of the IMFS directory
+ *   hash index.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The table uses open addressing with linear probing.  A removed entry leaves
+ * a deleted slot behind so that the probe sequences of other entries stay
+ * intact.  The directory node itself marks deleted slots since a directory is
+ * never an entry of itself.
+ */
+
+static IMFS_jnode_t *IMFS_directory_index_deleted( const IMFS_directory_t *dir )
+{
+  return RTEMS_DECONST( IMFS_jnode_t *, &dir->Node );
+}
+
+static uint32_t IMFS_directory_index_hash( const char *name, size_t namelen )
+{
+  uint32_t hash = 2166136261U;
+  size_t   i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash = ( hash ^ (unsigned char) name[ i ] ) * 16777619U;
+  }
+
+  return hash;
+}
+
+static void IMFS_directory_index_put(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  IMFS_directory_index *index = &dir->Index;
+  IMFS_jnode_t         *deleted = IMFS_directory_index_deleted( dir );
+  uint32_t              mask = index->size - 1;
+  uint32_t              i;
+
+  i = IMFS_directory_index_hash( entry->name, entry->namelen ) & mask;
+
+  while ( index->table[ i ] != NULL && index->table[ i ] != deleted ) {
+    i = ( i + 1 ) & mask;
+  }
+
+  if ( index->table[ i ] == NULL ) {
+    ++index->used;
+  }
+
+  index->table[ i ] = entry;
+}
+
+static void IMFS_directory_index_free( IMFS_directory_index *index )
+{
+  free( index->table );
+  index->table = NULL;
+  index->size = 0;
+  index->used = 0;
+}
+
+/*
+ * Create a new table which is at most half full and add all entries of the
+ * directory to it.  This also drops the deleted slots.
+ */
+static void IMFS_directory_index_rebuild( IMFS_directory_t *dir )
+{
+  IMFS_directory_index *index = &dir->Index;
+  IMFS_jnode_t        **table;
+  uint32_t              size;
+  rtems_chain_node     *node;
+  rtems_chain_node     *tail;
+
+  size = 2 * IMFS_DIRECTORY_INDEX_THRESHOLD;
+
+  while ( size < 2 * index->count ) {
+    size *= 2;
+  }
+
+  table = calloc( size, sizeof( *table ) );
+  IMFS_directory_index_free( index );
+
+  if ( table == NULL ) {
+    return;
+  }
+
+  index->table = table;
+  index->size = size;
+
+  node = rtems_chain_first( &dir->Entries );
+  tail = rtems_chain_tail( &dir->Entries );
+
+  while ( node != tail ) {
+    IMFS_directory_index_put( dir, (IMFS_jnode_t *) node );
+    node = rtems_chain_next( node );
+  }
+}
+
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  IMFS_directory_index *index = &dir->Index;
+
+  ++index->count;
+
+  if ( IMFS_is_directory( entry ) ) {
+    ( (IMFS_directory_t *) entry )->Index.enabled = true;
+  }
+
+  if ( index->table != NULL ) {
+    if ( 4 * ( index->used + 1 ) <= 3 * index->size ) {
+      IMFS_directory_index_put( dir, entry );
+    } else {
+      IMFS_directory_index_rebuild( dir );
+    }
+  } else if ( index->count > IMFS_DIRECTORY_INDEX_THRESHOLD ) {
+    IMFS_directory_index_rebuild( dir );
+  }
+}
+
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  IMFS_directory_index *index = &dir->Index;
+
+  --index->count;
+
+  if ( index->table == NULL ) {
+    return;
+  }
+
+  if ( index->count <= IMFS_DIRECTORY_INDEX_THRESHOLD / 2 ) {
+    IMFS_directory_index_free( index );
+  } else {
+    uint32_t mask = index->size - 1;
+    uint32_t i;
+
+    i = IMFS_directory_index_hash( entry->name, entry->namelen ) & mask;
+
+    while ( index->table[ i ] != entry ) {
+      IMFS_assert( index->table[ i ] != NULL );
+      i = ( i + 1 ) & mask;
+    }
+
+    index->table[ i ] = IMFS_directory_index_deleted( dir );
+  }
+}
+
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+)
+{
+  const IMFS_directory_index *index = &dir->Index;
+  const IMFS_jnode_t         *deleted = &dir->Node;
+  uint32_t                    mask = index->size - 1;
+  uint32_t                    i;
+
+  i = IMFS_directory_index_hash( name, namelen ) & mask;
+
+  while ( true ) {
+    IMFS_jnode_t *entry = index->table[ i ];
+
+    if ( entry == NULL ) {
+      return NULL;
+    }
+
+    if (
+      entry != deleted
+        && entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0
+    ) {
+      return entry;
+    }
+
+    i = ( i + 1 ) & mask;
+  }
+}
+
+void IMFS_directory_index_destroy( IMFS_directory_t *dir )
+{
+  IMFS_directory_index_free( &dir->Index );
+}
@@ -0,0 +1,485 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief This source file contains the implementation of the IMFS extent
+ *   file handlers.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfsimpl.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t IMFS_extfile_locate(
+  const IMFS_extfile_t *extfile,
+  size_t               *offset
+)
+{
+  size_t i;
+
+  i = 0;
+
+  while ( *offset >= extfile->extents[ i ].size ) {
+    *offset -= extfile->extents[ i ].size;
+    ++i;
+  }
+
+  return i;
+}
+
+static void IMFS_extfile_copy_out(
+  const IMFS_extfile_t *extfile,
+  size_t                offset,
+  unsigned char        *destination,
+  size_t                length
+)
+{
+  size_t i;
+
+  i = IMFS_extfile_locate( extfile, &offset );
+
+  while ( length > 0 ) {
+    const IMFS_extent *extent;
+    size_t             chunk;
+
+    extent = &extfile->extents[ i ];
+    chunk = extent->size - offset;
+
+    if ( chunk > length ) {
+      chunk = length;
+    }
+
+    memcpy( destination, extent->data + offset, chunk );
+    destination += chunk;
+    length -= chunk;
+    offset = 0;
+    ++i;
+  }
+}
+
+/*
+ *  A NULL source fills the area with zeros.
+ */
+static void IMFS_extfile_copy_in(
+  IMFS_extfile_t      *extfile,
+  size_t               offset,
+  const unsigned char *source,
+  size_t               length
+)
+{
+  size_t i;
+
+  i = IMFS_extfile_locate( extfile, &offset );
+
+  while ( length > 0 ) {
+    IMFS_extent *extent;
+    size_t       chunk;
+
+    extent = &extfile->extents[ i ];
+    chunk = extent->size - offset;
+
+    if ( chunk > length ) {
+      chunk = length;
+    }
+
+    if ( source != NULL ) {
+      memcpy( extent->data + offset, source, chunk );
+      source += chunk;
+    } else {
+      memset( extent->data + offset, 0, chunk );
+    }
+
+    length -= chunk;
+    offset = 0;
+    ++i;
+  }
+}
+
+static bool IMFS_extfile_add_extent(
+  IMFS_extfile_t *extfile,
+  size_t          size
+)
+{
+  IMFS_extent   *extents;
+  unsigned char *data;
+  uint32_t       count;
+
+  count = extfile->extent_count;
+  extents = realloc( extfile->extents, ( count + 1 ) * sizeof( *extents ) );
+
+  if ( extents == NULL ) {
+    return false;
+  }
+
+  extfile->extents = extents;
+  data = malloc( size );
+
+  if ( data == NULL ) {
+    return false;
+  }
+
+  extents[ count ].data = data;
+  extents[ count ].size = size;
+  extfile->extent_count = count + 1;
+  extfile->capacity += size;
+  return true;
+}
+
+static bool IMFS_extfile_resize_extent(
+  IMFS_extfile_t *extfile,
+  size_t          size
+)
+{
+  unsigned char *data;
+
+  data = realloc( extfile->extents[ 0 ].data, size );
+
+  if ( data == NULL ) {
+    return false;
+  }
+
+  extfile->extents[ 0 ].data = data;
+  extfile->extents[ 0 ].size = size;
+  extfile->capacity = size;
+  return true;
+}
+
+/*
+ *  Makes sure that the capacity of the file is at least the requested size.
+ *  The capacity is at least doubled so that a sequentially written file needs
+ *  only a logarithmic number of allocations.  If the geometric growth fails,
+ *  then the exact size is tried before the request is rejected.
+ */
+static int IMFS_extfile_reserve( IMFS_extfile_t *extfile, size_t size )
+{
+  size_t capacity;
+  size_t new_capacity;
+
+  capacity = extfile->capacity;
+
+  if ( size <= capacity ) {
+    return 0;
+  }
+
+  if ( capacity <= SIZE_MAX / 2 ) {
+    new_capacity = 2 * capacity;
+  } else {
+    new_capacity = SIZE_MAX;
+  }
+
+  if ( new_capacity < size ) {
+    new_capacity = size;
+  }
+
+  if ( new_capacity < IMFS_EXTFILE_MINIMUM_CAPACITY ) {
+    new_capacity = IMFS_EXTFILE_MINIMUM_CAPACITY;
+  }
+
+  /*
+   *  Keep the file data contiguous as long as nobody refers to it directly.
+   */
+  if ( extfile->extent_count == 1 && !extfile->pinned ) {
+    if (
+      IMFS_extfile_resize_extent( extfile, new_capacity )
+        || IMFS_extfile_resize_extent( extfile, size )
+    ) {
+      return 0;
+    }
+  }
+
+  if (
+    IMFS_extfile_add_extent( extfile, new_capacity - capacity )
+      || IMFS_extfile_add_extent( extfile, size - capacity )
+  ) {
+    return 0;
+  }
+
+  rtems_set_errno_and_return_minus_one( ENOSPC );
+}
+
+/*
+ *  Extends the file to the new size.  The area between the current end of
+ *  file and the start of the next write must read back as zeros, so only
+ *  this gap is zero filled.
+ */
+static int IMFS_extfile_extend(
+  IMFS_extfile_t *extfile,
+  size_t          zero_fill_end,
+  size_t          new_size
+)
+{
+  size_t size;
+  int    rv;
+
+  rv = IMFS_extfile_reserve( extfile, new_size );
+
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  size = extfile->File.size;
+
+  if ( zero_fill_end > size ) {
+    IMFS_extfile_copy_in( extfile, size, NULL, zero_fill_end - size );
+  }
+
+  extfile->File.size = new_size;
+  return 0;
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  off_t           start;
+  size_t          size;
+
+  extfile = IMFS_iop_to_extfile( iop );
+  start = iop->offset;
+  size = extfile->File.size;
+
+  if ( start >= (off_t) size ) {
+    count = 0;
+  } else if ( count > size - (size_t) start ) {
+    count = size - (size_t) start;
+  }
+
+  if ( count > 0 ) {
+    IMFS_extfile_copy_out( extfile, (size_t) start, buffer, count );
+    iop->offset = start + (off_t) count;
+  }
+
+  IMFS_update_atime( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  off_t           start;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = (off_t) extfile->File.size;
+  }
+
+  start = iop->offset;
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  if ( (uintmax_t) start > SIZE_MAX - count ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  if ( (size_t) start + count > extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_extend( extfile, (size_t) start, (size_t) start + count );
+
+    if ( rv != 0 ) {
+      return rv;
+    }
+  }
+
+  IMFS_extfile_copy_in( extfile, (size_t) start, buffer, count );
+  iop->offset = start + (off_t) count;
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  IMFS_extfile_t *extfile;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( (uintmax_t) length > SIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  /*
+   *  Like the memfiles, the extent files treat a truncate beyond the end of
+   *  file as an extend operation and keep their memory until they are
+   *  deleted.
+   */
+  if ( (size_t) length > extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_extend( extfile, (size_t) length, (size_t) length );
+
+    if ( rv != 0 ) {
+      return rv;
+    }
+  } else {
+    extfile->File.size = (size_t) length;
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ *  Merges all extents into one, so that the whole file can be mapped.
+ */
+static bool IMFS_extfile_consolidate( IMFS_extfile_t *extfile )
+{
+  unsigned char *data;
+  size_t         size;
+  uint32_t       i;
+
+  data = malloc( extfile->capacity );
+
+  if ( data == NULL ) {
+    return false;
+  }
+
+  IMFS_extfile_copy_out( extfile, 0, data, extfile->File.size );
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    free( extfile->extents[ i ].data );
+  }
+
+  size = extfile->capacity;
+  extfile->extents[ 0 ].data = data;
+  extfile->extents[ 0 ].size = size;
+  extfile->extent_count = 1;
+  return true;
+}
+
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t *extfile;
+  size_t          offset;
+  size_t          i;
+
+  (void) prot;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if (
+    off < 0
+      || len == 0
+      || len > extfile->File.size
+      || (size_t) off > extfile->File.size - len
+  ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  offset = (size_t) off;
+  i = IMFS_extfile_locate( extfile, &offset );
+
+  if ( len > extfile->extents[ i ].size - offset ) {
+    /*
+     *  The range spans more than one extent.  This can only be resolved as
+     *  long as no other mapping refers to the current extents.
+     */
+    if ( extfile->pinned || !IMFS_extfile_consolidate( extfile ) ) {
+      rtems_set_errno_and_return_minus_one( ENOTSUP );
+    }
+
+    offset = (size_t) off;
+    i = 0;
+  }
+
+  extfile->pinned = true;
+  *addr = extfile->extents[ i ].data + offset;
+  return 0;
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile;
+  uint32_t        i;
+
+  extfile = (IMFS_extfile_t *) node;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    free( extfile->extents[ i ].data );
+  }
+
+  free( extfile->extents );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
@@ -77,6 +77,7 @@ int IMFS_initialize(
   const void                           *data
 )
 {
+  const IMFS_mount_options *options = data;
   IMFS_fs_info_t *fs_info = calloc( 1, sizeof( *fs_info ) );
   IMFS_mount_data mount_data = {
     .fs_info = fs_info,
@@ -88,5 +89,9 @@ int IMFS_initialize(
     rtems_set_errno_and_return_minus_one( ENOMEM );
   }
 
+  if ( options != NULL ) {
+    mount_data.directory_index = options->directory_index;
+  }
+
   return IMFS_initialize_support( mt_entry, &mount_data );
 }
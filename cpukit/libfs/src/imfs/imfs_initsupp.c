@@ -76,6 +76,8 @@ int IMFS_initialize_support(
   );
   IMFS_assert( root_node != NULL );
 
+  fs_info->Root_directory.Index.enabled = mount_data->directory_index;
+
   return 0;
 }
 
@@ -61,6 +61,31 @@ static ssize_t IMFS_linfile_read(
   return (ssize_t) count;
 }
 
+/*
+ *  The file image is not owned by the file system, so it stays valid even if
+ *  the node is removed or converted into a memfile.
+ */
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  size_t size = file->File.size;
+
+  (void) prot;
+
+  if ( off < 0 || len > size || (size_t) off > size - len )
+    rtems_set_errno_and_return_minus_one( ENXIO );
+
+  *addr = &file->Linearfile.direct[ off ];
+
+  return 0;
+}
+
 static int IMFS_linfile_open(
   rtems_libio_t *iop,
   const char    *pathname,
@@ -108,7 +133,7 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
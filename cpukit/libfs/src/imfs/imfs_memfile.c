@@ -152,6 +152,48 @@ static int memfile_ftruncate(
   return 0;
 }
 
+/*
+ *  memfile_mmap
+ *
+ *  The data of an in-memory file is only contiguous within a block, so only
+ *  ranges inside one block can be mapped directly.  The blocks are not
+ *  reclaimed until the file is deleted, so the mapping stays valid as long as
+ *  it holds a reference to the file node.
+ */
+static int memfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_memfile_t *memfile = IMFS_iop_to_memfile( iop );
+  unsigned int    block;
+  unsigned int    offset;
+  block_p        *block_ptr;
+
+  (void) prot;
+
+  if ( off < 0 || len > memfile->File.size ||
+       (size_t) off > memfile->File.size - len )
+    rtems_set_errno_and_return_minus_one( ENXIO );
+
+  block = off / IMFS_MEMFILE_BYTES_PER_BLOCK;
+  offset = off % IMFS_MEMFILE_BYTES_PER_BLOCK;
+
+  if ( len > IMFS_MEMFILE_BYTES_PER_BLOCK - offset )
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+
+  block_ptr = IMFS_memfile_get_block_pointer( memfile, block, 0 );
+  if ( !block_ptr || !*block_ptr )
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+
+  *addr = &(*block_ptr)[ offset ];
+
+  return 0;
+}
+
 /*
  *  IMFS_memfile_extend
  *
@@ -864,7 +906,7 @@ static const rtems_filesystem_file_handlers_r IMFS_memfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = memfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
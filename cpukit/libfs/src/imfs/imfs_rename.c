@@ -109,10 +109,13 @@ int IMFS_rename(
   control->Base.node_destroy = IMFS_renamed_destroy;
   control->replaced = node->control;
   node->control = &control->Base;
+
+  /* The directory index uses the name to find the node */
+  IMFS_remove_from_directory( node );
+
   node->name = control->name;
   node->namelen = namelen;
 
-  IMFS_remove_from_directory( node );
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
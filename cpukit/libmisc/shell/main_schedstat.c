@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ * @brief schedstat Shell Command Implementation
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems/rtems/status.h>
+#include <rtems/schedulerstats.h>
+#include <rtems/printer.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+#include <rtems/score/schedulerimpl.h>
+
+static int rtems_shell_main_schedstat(int argc, char **argv)
+{
+  if (argc == 1) {
+    rtems_printer printer;
+
+    rtems_print_printer_fprintf(&printer, stdout);
+    rtems_scheduler_statistics_report(&printer);
+    return 0;
+  }
+
+  if (argc == 2 && strcmp(argv[1], "-r") == 0) {
+    uint32_t scheduler_index;
+
+    for (
+      scheduler_index = 0;
+      scheduler_index < _Scheduler_Count;
+      ++scheduler_index
+    ) {
+      rtems_status_code sc;
+
+      sc = rtems_scheduler_reset_statistics(
+        _Scheduler_Build_id(scheduler_index)
+      );
+      if (sc != RTEMS_SUCCESSFUL) {
+        fprintf(stderr, "%s: %s\n", argv[0], rtems_status_text(sc));
+        return 1;
+      }
+    }
+
+    return 0;
+  }
+
+  fprintf(stderr, "%s: usage [-r]\n", argv[0]);
+  return 1;
+}
+
+rtems_shell_cmd_t rtems_shell_SCHEDSTAT_Command = {
+  .name = "schedstat",
+  .usage = "schedstat [-r]",
+  .topic = "rtems",
+  .command = rtems_shell_main_schedstat
+};
@@ -38,6 +38,7 @@
 #endif
 
 #include <rtems/posix/condimpl.h>
+#include <rtems/score/rcuimpl.h>
 
 /**
  *  11.4.2 Initializing and Destroying a Condition Variable,
@@ -55,12 +56,33 @@ int pthread_cond_destroy( pthread_cond_t *cond )
   _Thread_queue_Context_initialize( &queue_context );
   _POSIX_Condition_variables_Acquire( the_cond, &queue_context );
 
-  if ( !_Thread_queue_Is_empty( &the_cond->Queue.Queue ) ) {
+  if ( _POSIX_Condition_variables_Is_morphing( the_cond ) ) {
+    /*
+     *  The remaining waiters in the wait morphing mode were already woken up
+     *  by a broadcast from the point of view of the application.
+     */
+    _POSIX_Condition_variables_Stop_morphing( the_cond );
+    _Thread_queue_Flush_critical(
+      &the_cond->Queue.Queue,
+      POSIX_CONDITION_VARIABLES_TQ_OPERATIONS,
+      _Thread_queue_Flush_default_filter,
+      &queue_context
+    );
+  } else if ( !_Thread_queue_Is_empty( &the_cond->Queue.Queue ) ) {
     _POSIX_Condition_variables_Release( the_cond, &queue_context );
     return EBUSY;
+  } else {
+    _POSIX_Condition_variables_Release( the_cond, &queue_context );
+  }
+
+  /*
+   *  A mutex release may still use the condition variable, see
+   *  _POSIX_Mutex_Futex_surrender_slow().
+   */
+  if ( ( the_cond->flags & POSIX_CONDITION_VARIABLES_MORPHED ) != 0 ) {
+    _RCU_Synchronize();
   }
 
-  _POSIX_Condition_variables_Release( the_cond, &queue_context );
   _POSIX_Condition_variables_Destroy( the_cond );
   return 0;
 }
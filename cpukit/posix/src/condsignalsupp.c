@@ -39,6 +39,101 @@
 #endif
 
 #include <rtems/posix/condimpl.h>
+#include <rtems/score/chainimpl.h>
+
+/*
+ *  Instead of a wake up of all waiters, a broadcast with a locked mutex
+ *  which uses the futex fast path puts the waiters into the wait morphing
+ *  mode.  Each release of the mutex wakes up the next waiter.  The woken up
+ *  waiter acquires the mutex in the contended state, so that its release
+ *  continues the wake up chain.  This avoids that all waiters of the
+ *  condition variable stampede onto the mutex.
+ */
+static bool _POSIX_Condition_variables_Morph(
+  POSIX_Condition_variables_Control *the_cond,
+  Thread_queue_Heads                *heads,
+  Thread_Control                    *executing
+)
+{
+  POSIX_Mutex_Control *the_mutex;
+  uintptr_t            expected;
+
+  the_mutex = _POSIX_Mutex_Get( the_cond->mutex );
+
+  if (
+    !_POSIX_Mutex_Is_futex( the_mutex->flags )
+      || the_mutex->Futex.owner != executing
+  ) {
+    return false;
+  }
+
+  expected = 0;
+
+  if (
+    !_Atomic_Compare_exchange_uintptr(
+      &the_mutex->Futex.morph_cond,
+      &expected,
+      (uintptr_t) the_cond,
+      ATOMIC_ORDER_RELAXED,
+      ATOMIC_ORDER_RELAXED
+    ) && expected != (uintptr_t) the_cond
+  ) {
+    return false;
+  }
+
+  the_mutex->Futex.morph_count =
+    (unsigned int) _Chain_Node_count_unprotected( &heads->Heads.Fifo );
+  the_cond->flags |=
+    POSIX_CONDITION_VARIABLES_MORPH | POSIX_CONDITION_VARIABLES_MORPHED;
+  _Atomic_Store_uint(
+    &the_mutex->Futex.state,
+    POSIX_MUTEX_FUTEX_CONTENDED,
+    ATOMIC_ORDER_RELAXED
+  );
+  return true;
+}
+
+void _POSIX_Condition_variables_Wake_morphed(
+  POSIX_Condition_variables_Control *the_cond,
+  POSIX_Mutex_Control               *the_mutex
+)
+{
+  Thread_queue_Context  queue_context;
+  Thread_queue_Heads   *heads;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _POSIX_Condition_variables_Acquire( the_cond, &queue_context );
+
+  if (
+    !_POSIX_Condition_variables_Is_morphing( the_cond )
+      || _POSIX_Mutex_Get( the_cond->mutex ) != the_mutex
+  ) {
+    _POSIX_Condition_variables_Release( the_cond, &queue_context );
+    return;
+  }
+
+  heads = the_cond->Queue.Queue.heads;
+
+  if ( heads == NULL ) {
+    _POSIX_Condition_variables_Stop_morphing( the_cond );
+    _POSIX_Condition_variables_Release( the_cond, &queue_context );
+    return;
+  }
+
+  _Assert( the_mutex->Futex.morph_count > 0 );
+  --the_mutex->Futex.morph_count;
+
+  if ( the_mutex->Futex.morph_count == 0 ) {
+    _POSIX_Condition_variables_Stop_morphing( the_cond );
+  }
+
+  _Thread_queue_Surrender_no_priority(
+    &the_cond->Queue.Queue,
+    heads,
+    &queue_context,
+    POSIX_CONDITION_VARIABLES_TQ_OPERATIONS
+  );
+}
 
 /*
  *  _POSIX_Condition_variables_Signal_support
@@ -58,22 +153,52 @@ int _POSIX_Condition_variables_Signal_support(
 
   the_cond = _POSIX_Condition_variables_Get( cond );
   POSIX_CONDITION_VARIABLES_VALIDATE_OBJECT( the_cond, flags );
+
+  /*
+   *  A waiter enqueues itself before it releases the mutex.  If the caller
+   *  owns the mutex, then there is no waiter which could be missed by the
+   *  following check without the thread queue lock.
+   */
+  if (
+    _Thread_queue_Is_empty( &the_cond->Queue.Queue )
+      && the_cond->mutex == POSIX_CONDITION_VARIABLES_NO_MUTEX
+  ) {
+    return 0;
+  }
+
   _Thread_queue_Context_initialize( &queue_context );
 
   do {
     Thread_queue_Heads *heads;
+    Thread_Control     *executing;
 
-    _POSIX_Condition_variables_Acquire( the_cond, &queue_context );
+    executing = _POSIX_Condition_variables_Acquire(
+      the_cond,
+      &queue_context
+    );
 
     heads = the_cond->Queue.Queue.heads;
 
     if ( heads == NULL ) {
+      if ( _POSIX_Condition_variables_Is_morphing( the_cond ) ) {
+        _POSIX_Condition_variables_Stop_morphing( the_cond );
+      }
+
       the_cond->mutex = POSIX_CONDITION_VARIABLES_NO_MUTEX;
       _POSIX_Condition_variables_Release( the_cond, &queue_context );
 
       return 0;
     }
 
+    if (
+      is_broadcast
+        && _POSIX_Condition_variables_Morph( the_cond, heads, executing )
+    ) {
+      _POSIX_Condition_variables_Release( the_cond, &queue_context );
+
+      return 0;
+    }
+
     _Thread_queue_Surrender_no_priority(
       &the_cond->Queue.Queue,
       heads,
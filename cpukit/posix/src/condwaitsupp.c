@@ -191,7 +191,11 @@ int _POSIX_Condition_variables_Wait_support(
   if ( error != EPERM ) {
     int mutex_error;
 
-    mutex_error = pthread_mutex_lock( mutex );
+    mutex_error = _POSIX_Mutex_Lock_support(
+      mutex,
+      (const struct timespec *) POSIX_MUTEX_ABSTIME_COND_RELOCK,
+      _Thread_queue_Enqueue_do_nothing_extra
+    );
     if ( mutex_error != 0 ) {
       _Assert( mutex_error == EINVAL );
       error = EINVAL;
@@ -68,12 +68,15 @@ void *mmap(
   bool            map_shared;
   bool            map_private;
   bool            is_shared_shm;
+  bool            read_only;
+  bool            map_direct;
   int             err;
 
   map_fixed = (flags & MAP_FIXED) == MAP_FIXED;
   map_anonymous = (flags & MAP_ANON) == MAP_ANON;
   map_shared = (flags & MAP_SHARED) == MAP_SHARED;
   map_private = (flags & MAP_PRIVATE) == MAP_PRIVATE;
+  read_only = (prot & PROT_WRITE) != PROT_WRITE;
 
   /* Clear errno. */
   errno = 0;
@@ -96,9 +99,10 @@ void *mmap(
   /*
    * We can not normally provide restriction of write access. Reject any
    * attempt to map without write permission, since we are not able to
-   * prevent a write from succeeding.
+   * prevent a write from succeeding.  Read-only mappings of regular files are
+   * the exception, see below.
    */
-  if ( PROT_WRITE != (prot & PROT_WRITE) ) {
+  if ( read_only && map_anonymous ) {
     errno = ENOTSUP;
     return MAP_FAILED;
   }
@@ -176,11 +180,18 @@ void *mmap(
       return MAP_FAILED;
     }
 
+    /*
+     * Read-only mappings are only supported for regular files.  The
+     * application is trusted to not write to these mappings.
+     */
+    if ( read_only && !S_ISREG( sb.st_mode ) ) {
+      errno = ENOTSUP;
+      return MAP_FAILED;
+    }
+
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
@@ -233,9 +244,16 @@ void *mmap(
     is_shared_shm = false;
   }
 
+  /*
+   * A read-only private mapping of a regular file may refer directly to the
+   * file data, if the file system provides it.  Since nobody writes to the
+   * mapping, it cannot be distinguished from a copy of the file data.
+   */
+  map_direct = map_private && read_only && !map_fixed;
+
   if ( map_fixed ) {
     mapping->addr = addr;
-  } else if ( map_private ) {
+  } else if ( map_private && !map_direct ) {
     /* private mappings of shared memory do not need special treatment. */
     is_shared_shm = false;
     err = posix_memalign( &mapping->addr, PAGE_SIZE, len );
@@ -276,8 +294,26 @@ void *mmap(
     }
   }
 
+  if ( map_direct ) {
+    err = (*iop->pathinfo.handlers->mmap_h)(
+        iop, &mapping->addr, len, prot, off );
+    if ( err != 0 ) {
+      /* Fall back to a copy of the file data */
+      map_direct = false;
+      err = posix_memalign( &mapping->addr, PAGE_SIZE, len );
+      if ( err != 0 ) {
+        mmap_mappings_lock_release( );
+        free( mapping );
+        errno = ENOMEM;
+        return MAP_FAILED;
+      }
+    }
+  }
+
   /* Populate the data */
-  if ( map_private ) {
+  if ( map_direct ) {
+    mapping->is_file = true;
+  } else if ( map_private ) {
     if ( !map_anonymous ) {
       /*
        * Use read() for private mappings. This updates atime as needed.
@@ -311,6 +347,19 @@ void *mmap(
       free( mapping );
       return MAP_FAILED;
     }
+
+    mapping->is_file = S_ISREG( sb.st_mode );
+  }
+
+  /*
+   * Mappings which refer to the file data hold a reference to the file node.
+   * The file system must keep the mapped data of a node until the last
+   * reference is released, even if the file is unlinked or truncated.
+   */
+  if ( mapping->is_file ) {
+    rtems_filesystem_instance_lock( &iop->pathinfo );
+    rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+    rtems_filesystem_instance_unlock( &iop->pathinfo );
   }
 
   rtems_chain_append_unprotected( &mmap_mappings, &mapping->node );
@@ -77,12 +77,20 @@ int munmap(void *addr, size_t len)
         POSIX_Shm_Attempt_delete(mapping->shm);
       }
 
+      /* file mappings hold a reference to the file node */
+      if ( mapping->is_file ) {
+        rtems_filesystem_location_free( &mapping->location );
+      }
+
       /* only free the mapping address for non-fixed mapping */
       if (( mapping->flags & MAP_FIXED ) != MAP_FIXED ) {
         /* only free the mapping address for non-shared mapping, because we
          * re-use the mapping address across all of the shared mappings, and
-         * it is memory managed independently... */
-        if (( mapping->flags & MAP_SHARED ) != MAP_SHARED ) {
+         * it is memory managed independently... The same holds for file
+         * mappings which refer directly to the file data. */
+        if (
+          ( mapping->flags & MAP_SHARED ) != MAP_SHARED && !mapping->is_file
+        ) {
           free( mapping->addr );
         }
       }
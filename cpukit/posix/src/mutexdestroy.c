@@ -58,7 +58,25 @@ int pthread_mutex_destroy(
 
   _POSIX_Mutex_Acquire( the_mutex, &queue_context );
 
-  if ( _POSIX_Mutex_Get_owner( the_mutex ) == NULL ) {
+  if ( _POSIX_Mutex_Is_futex( flags ) ) {
+    /*
+     * The thread queue lock synchronizes with the mutex release in
+     * _POSIX_Mutex_Futex_surrender_slow().
+     */
+    if (
+      _Atomic_Load_uint( &the_mutex->Futex.state, ATOMIC_ORDER_RELAXED )
+        == POSIX_MUTEX_FUTEX_UNLOCKED
+        && _Atomic_Load_uintptr(
+          &the_mutex->Futex.morph_cond,
+          ATOMIC_ORDER_RELAXED
+        ) == 0
+    ) {
+      the_mutex->flags = ~the_mutex->flags;
+      eno = 0;
+    } else {
+      eno = EBUSY;
+    }
+  } else if ( _POSIX_Mutex_Get_owner( the_mutex ) == NULL ) {
     the_mutex->flags = ~the_mutex->flags;
     eno = 0;
   } else {
@@ -41,6 +41,7 @@
 #include <rtems/posix/muteximpl.h>
 #include <rtems/posix/posixapi.h>
 #include <rtems/posix/priorityimpl.h>
+#include <rtems/posix/pthread.h>
 #include <rtems/score/schedulerimpl.h>
 
 #include <limits.h>
@@ -158,11 +159,19 @@ int pthread_mutex_init(
     case PTHREAD_MUTEX_RECURSIVE:
     case PTHREAD_MUTEX_ERRORCHECK:
     case PTHREAD_MUTEX_DEFAULT:
+    case PTHREAD_MUTEX_ADAPTIVE_NP:
       break;
 
     default:
       return EINVAL;
   }
+
+  if (
+    the_attr->type == PTHREAD_MUTEX_ADAPTIVE_NP
+      && protocol == POSIX_MUTEX_PRIORITY_CEILING
+  ) {
+    return EINVAL;
+  }
 #endif
 
   the_mutex = _POSIX_Mutex_Get( mutex );
@@ -175,6 +184,10 @@ int pthread_mutex_init(
     flags |= POSIX_MUTEX_RECURSIVE;
   }
 
+  if ( the_attr->type == PTHREAD_MUTEX_ADAPTIVE_NP ) {
+    flags |= POSIX_MUTEX_ADAPTIVE_SPIN;
+  }
+
   the_mutex->flags = flags;
 
   if ( protocol == POSIX_MUTEX_PRIORITY_CEILING ) {
@@ -203,6 +216,11 @@ int pthread_mutex_init(
   );
   the_mutex->Recursive.nest_level = 0;
   _Priority_Node_initialize( &the_mutex->Priority_ceiling, priority );
+
+  if ( _POSIX_Mutex_Is_futex( flags ) ) {
+    _POSIX_Mutex_Futex_initialize( the_mutex );
+  }
+
   the_mutex->scheduler = scheduler;
   return 0;
 }
@@ -40,6 +40,7 @@
 
 #include <rtems/posix/muteximpl.h>
 #include <rtems/posix/posixapi.h>
+#include <rtems/score/futeximpl.h>
 
 Status_Control _POSIX_Mutex_Seize_slow(
   POSIX_Mutex_Control           *the_mutex,
@@ -71,6 +72,63 @@ Status_Control _POSIX_Mutex_Seize_slow(
   }
 }
 
+Status_Control _POSIX_Mutex_Futex_seize_slow(
+  POSIX_Mutex_Control          *the_mutex,
+  Thread_Control               *executing,
+  const struct timespec        *abstime,
+  Thread_queue_Enqueue_callout  enqueue_callout
+)
+{
+  if ( (uintptr_t) abstime == POSIX_MUTEX_ABSTIME_COND_RELOCK ) {
+    abstime = NULL;
+  }
+
+  while (
+    _Atomic_Exchange_uint(
+      &the_mutex->Futex.state,
+      POSIX_MUTEX_FUTEX_CONTENDED,
+      ATOMIC_ORDER_ACQUIRE
+    ) != POSIX_MUTEX_FUTEX_UNLOCKED
+  ) {
+    Thread_queue_Context queue_context;
+    Status_Control       status;
+
+    _Thread_queue_Context_initialize( &queue_context );
+    _Thread_queue_Context_set_thread_state(
+      &queue_context,
+      STATES_WAITING_FOR_MUTEX
+    );
+    _Thread_queue_Context_set_enqueue_callout(
+      &queue_context,
+      enqueue_callout
+    );
+    _Thread_queue_Context_set_deadlock_callout(
+      &queue_context,
+      _Thread_queue_Deadlock_status
+    );
+    _Thread_queue_Context_set_timeout_argument(
+      &queue_context,
+      abstime,
+      true
+    );
+    status = _Futex_Queue_wait(
+      &the_mutex->Recursive.Mutex.Queue,
+      &the_mutex->Futex.state,
+      POSIX_MUTEX_FUTEX_CONTENDED,
+      &the_mutex->Futex.owner,
+      &queue_context
+    );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      return status;
+    }
+  }
+
+  the_mutex->Futex.owner = executing;
+  _Thread_Resource_count_increment( executing );
+  return STATUS_SUCCESSFUL;
+}
+
 int _POSIX_Mutex_Lock_support(
   pthread_mutex_t              *mutex,
   const struct timespec        *abstime,
@@ -86,6 +144,16 @@ int _POSIX_Mutex_Lock_support(
   the_mutex = _POSIX_Mutex_Get( mutex );
   POSIX_MUTEX_VALIDATE_OBJECT( the_mutex, flags );
 
+  if ( _POSIX_Mutex_Is_futex( flags ) ) {
+    status = _POSIX_Mutex_Futex_seize(
+      the_mutex,
+      flags,
+      abstime,
+      enqueue_callout
+    );
+    return _POSIX_Get_error( status );
+  }
+
   executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
   _Thread_queue_Context_set_enqueue_callout( &queue_context, enqueue_callout);
   _Thread_queue_Context_set_timeout_argument( &queue_context, abstime, true );
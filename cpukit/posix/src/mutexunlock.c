@@ -38,8 +38,11 @@
 #include "config.h"
 #endif
 
+#include <rtems/posix/condimpl.h>
 #include <rtems/posix/muteximpl.h>
 #include <rtems/posix/posixapi.h>
+#include <rtems/score/futeximpl.h>
+#include <rtems/score/rcuimpl.h>
 
 bool _POSIX_Mutex_Auto_initialization( POSIX_Mutex_Control *the_mutex )
 {
@@ -84,6 +87,41 @@ bool _POSIX_Mutex_Auto_initialization( POSIX_Mutex_Control *the_mutex )
   return true;
 }
 
+void _POSIX_Mutex_Futex_surrender_slow( POSIX_Mutex_Control *the_mutex )
+{
+  Per_CPU_Control                   *cpu_self;
+  POSIX_Condition_variables_Control *the_cond;
+  int                                woken;
+
+  /*
+   * The RCU read-side critical section ensures that a condition variable in
+   * the wait morphing mode is not destroyed before we are done with it, see
+   * pthread_cond_destroy().  The mutex itself may be destroyed as soon as the
+   * futex state is stored.
+   */
+  cpu_self = _RCU_Read_lock();
+  the_cond = (POSIX_Condition_variables_Control *) _Atomic_Load_uintptr(
+    &the_mutex->Futex.morph_cond,
+    ATOMIC_ORDER_ACQUIRE
+  );
+  woken = _Futex_Queue_store_and_wake(
+    &the_mutex->Recursive.Mutex.Queue,
+    &the_mutex->Futex.state,
+    POSIX_MUTEX_FUTEX_UNLOCKED,
+    1
+  );
+
+  /*
+   * A woken up mutex waiter acquires the mutex in the contended state.  Its
+   * release wakes up the next condition variable waiter.
+   */
+  if ( woken == 0 && the_cond != NULL ) {
+    _POSIX_Condition_variables_Wake_morphed( the_cond, the_mutex );
+  }
+
+  _RCU_Read_unlock( cpu_self );
+}
+
 /*
  *  11.3.3 Locking and Unlocking a Mutex, P1003.1c/Draft 10, p. 93
  *
@@ -103,6 +141,11 @@ int pthread_mutex_unlock(
   the_mutex = _POSIX_Mutex_Get( mutex );
   POSIX_MUTEX_VALIDATE_OBJECT( the_mutex, flags );
 
+  if ( _POSIX_Mutex_Is_futex( flags ) ) {
+    status = _POSIX_Mutex_Futex_surrender( the_mutex );
+    return _POSIX_Get_error( status );
+  }
+
   executing = _POSIX_Mutex_Acquire( the_mutex, &queue_context );
 
   switch ( _POSIX_Mutex_Get_protocol( flags ) ) {
@@ -48,6 +48,16 @@ int pthread_rwlock_destroy(
   the_rwlock = _POSIX_RWLock_Get( _rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    if ( _BRLock_Is_busy( &the_rwlock->BRLock ) ) {
+      return EBUSY;
+    }
+
+    the_rwlock->flags = ~the_rwlock->flags;
+    _BRLock_Destroy( &the_rwlock->BRLock );
+    return 0;
+  }
+
   _CORE_RWLock_Acquire( &the_rwlock->RWLock, &queue_context );
 
   /*
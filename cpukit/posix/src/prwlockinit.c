@@ -78,6 +78,7 @@ int pthread_rwlock_init(
 )
 {
   POSIX_RWLock_Control *the_rwlock;
+  unsigned long         flags;
 
   the_rwlock = _POSIX_RWLock_Get( rwlock );
 
@@ -85,6 +86,9 @@ int pthread_rwlock_init(
     return EINVAL;
   }
 
+  flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  flags &= ~POSIX_RWLOCK_FLAGS_MASK;
+
   if ( attr != NULL ) {
     if ( !attr->is_initialized ) {
       return EINVAL;
@@ -93,9 +97,18 @@ int pthread_rwlock_init(
     if ( !_POSIX_Is_valid_pshared( attr->process_shared ) ) {
       return EINVAL;
     }
+
+    if ( ( attr->is_initialized & POSIX_RWLOCKATTR_READ_MOSTLY ) != 0 ) {
+      if ( !_BRLock_Initialize( &the_rwlock->BRLock, NULL ) ) {
+        return EAGAIN;
+      }
+
+      the_rwlock->flags = flags | POSIX_RWLOCK_READ_MOSTLY;
+      return 0;
+    }
   }
 
-  the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  the_rwlock->flags = flags;
   _CORE_RWLock_Initialize( &the_rwlock->RWLock );
   return 0;
 }
@@ -59,10 +59,20 @@ int pthread_rwlock_timedrdlock(
     abstime,
     true
   );
-  status = _CORE_RWLock_Seize_for_reading(
-    &the_rwlock->RWLock,
-    true,
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    status = _BRLock_Seize_for_reading(
+      &the_rwlock->BRLock,
+      true,
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_reading(
+      &the_rwlock->RWLock,
+      true,
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
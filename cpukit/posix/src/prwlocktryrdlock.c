@@ -53,10 +53,20 @@ int pthread_rwlock_tryrdlock(
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
   _Thread_queue_Context_initialize( &queue_context );
-  status = _CORE_RWLock_Seize_for_reading(
-    &the_rwlock->RWLock,
-    false,                  /* do not wait for the rwlock */
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    status = _BRLock_Seize_for_reading(
+      &the_rwlock->BRLock,
+      false,                  /* do not wait for the rwlock */
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_reading(
+      &the_rwlock->RWLock,
+      false,                  /* do not wait for the rwlock */
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -53,10 +53,20 @@ int pthread_rwlock_trywrlock(
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
   _Thread_queue_Context_initialize( &queue_context );
-  status = _CORE_RWLock_Seize_for_writing(
-    &the_rwlock->RWLock,
-    false,                 /* we are not willing to wait */
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    status = _BRLock_Seize_for_writing(
+      &the_rwlock->BRLock,
+      false,                 /* we are not willing to wait */
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_writing(
+      &the_rwlock->RWLock,
+      false,                 /* we are not willing to wait */
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -48,6 +48,7 @@
 bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock )
 {
   POSIX_RWLock_Control zero;
+  unsigned long        flags;
 
   memset( &zero, 0, sizeof( zero ) );
 
@@ -55,7 +56,9 @@ bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock )
     return false;
   }
 
-  the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
+  flags &= ~POSIX_RWLOCK_FLAGS_MASK;
+  the_rwlock->flags = flags;
   return true;
 }
 
@@ -69,6 +72,11 @@ int pthread_rwlock_unlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
-  status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    status = _BRLock_Surrender( &the_rwlock->BRLock );
+  } else {
+    status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -56,10 +56,20 @@ int pthread_rwlock_wrlock(
 
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
-  status = _CORE_RWLock_Seize_for_writing(
-    &the_rwlock->RWLock,
-    true,          /* do not timeout -- wait forever */
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_read_mostly( the_rwlock ) ) {
+    status = _BRLock_Seize_for_writing(
+      &the_rwlock->BRLock,
+      true,          /* do not timeout -- wait forever */
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_writing(
+      &the_rwlock->RWLock,
+      true,          /* do not timeout -- wait forever */
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
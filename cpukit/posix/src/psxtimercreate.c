@@ -138,6 +138,7 @@ int timer_create(
   ptimer->timer_data.it_interval.tv_sec  = 0;
   ptimer->timer_data.it_interval.tv_nsec = 0;
   ptimer->clock_type = clock_id;
+  ptimer->watchdog_header = PER_CPU_WATCHDOG_MONOTONIC;
 
   _Watchdog_Preinitialize( &ptimer->Timer, _Per_CPU_Get_snapshot() );
   _Watchdog_Initialize( &ptimer->Timer, _POSIX_Timer_TSR );
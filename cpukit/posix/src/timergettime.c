@@ -77,19 +77,13 @@ int timer_gettime(
   }
 
   cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
-  rtems_timespec_from_ticks( ptimer->Timer.expire, &expire );
+  _Watchdog_Ticks_to_timespec( ptimer->Timer.expire, &expire );
+  _POSIX_Timer_Get_now( ptimer, &now );
 
-  if ( ptimer->clock_type == CLOCK_MONOTONIC ) {
-  _Timecounter_Nanouptime(&now);
-  } else  if (ptimer->clock_type == CLOCK_REALTIME) {
-    _TOD_Get(&now);
-  } else {
-    _POSIX_Timer_Release( cpu, &lock_context );
-    rtems_set_errno_and_return_minus_one( EINVAL );
-  }
-
-
- if ( rtems_timespec_less_than( &now, &expire ) ) {
+  if (
+    ptimer->state == POSIX_TIMER_STATE_CREATE_RUN
+      && rtems_timespec_less_than( &now, &expire )
+  ) {
       rtems_timespec_subtract( &now, &expire, &result );
   } else {
     result.tv_nsec = 0;
@@ -49,21 +49,31 @@
 #include <rtems/seterr.h>
 
 static void _POSIX_Timer_Insert(
-  POSIX_Timer_Control *ptimer,
-  Per_CPU_Control     *cpu,
-  Watchdog_Interval    ticks
+  POSIX_Timer_Control   *ptimer,
+  Per_CPU_Control       *cpu,
+  unsigned int           watchdog_header,
+  const struct timespec *expire
 )
 {
+  uint64_t ticks;
+
   /* The state really did not change but just to be safe */
   ptimer->state = POSIX_TIMER_STATE_CREATE_RUN;
 
   /* Store the time when the timer was started again */
   _TOD_Get( &ptimer->time );
 
+  if ( _Watchdog_Is_far_future_timespec( expire ) ) {
+    ticks = WATCHDOG_MAXIMUM_TICKS;
+  } else {
+    ticks = _Watchdog_Ticks_from_timespec( expire );
+  }
+
+  ptimer->watchdog_header = watchdog_header;
   _Watchdog_Insert(
-    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+    _POSIX_Timer_Get_watchdog_header( ptimer, cpu ),
     &ptimer->Timer,
-    cpu->Watchdog.ticks + ticks
+    ticks
   );
 }
 
@@ -86,7 +96,42 @@ void _POSIX_Timer_TSR( Watchdog_Control *the_watchdog )
   /* The timer must be reprogrammed */
   if ( ( ptimer->timer_data.it_interval.tv_sec  != 0 ) ||
        ( ptimer->timer_data.it_interval.tv_nsec != 0 ) ) {
-    _POSIX_Timer_Insert( ptimer, cpu, ptimer->ticks );
+    struct timespec expire;
+    struct timespec now;
+
+    /*
+     * The next expiration time is relative to the previous one and not to the
+     * time of the timer service, so that the period does not drift.  If the
+     * next expiration time has already passed, then start from the current
+     * time to avoid a storm of expirations.  The interval is relative, so the
+     * timer continues on the monotonic watchdog header.
+     */
+    _Watchdog_Ticks_to_timespec( ptimer->Timer.expire, &expire );
+    _Timecounter_Nanouptime( &now );
+
+    if ( ptimer->watchdog_header == PER_CPU_WATCHDOG_REALTIME ) {
+      struct timespec realtime;
+      struct timespec delta;
+
+      /* Convert the realtime expiration time to the monotonic clock */
+      _Timecounter_Nanotime( &realtime );
+      _Timespec_Subtract( &expire, &realtime, &delta );
+
+      if ( _Timespec_Less_than( &now, &delta ) ) {
+        expire = now;
+      } else {
+        _Timespec_Subtract( &delta, &now, &expire );
+      }
+    }
+
+    _Timespec_Add_to( &expire, &ptimer->timer_data.it_interval );
+
+    if ( _Timespec_Less_than( &expire, &now ) ) {
+      expire = now;
+      _Timespec_Add_to( &expire, &ptimer->timer_data.it_interval );
+    }
+
+    _POSIX_Timer_Insert( ptimer, cpu, PER_CPU_WATCHDOG_MONOTONIC, &expire );
   } else {
    /* Indicates that the timer is stopped */
    ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
@@ -125,7 +170,6 @@ int timer_settime(
 {
   POSIX_Timer_Control *ptimer;
   ISR_lock_Context     lock_context;
-  uint32_t             initial_period;
   struct itimerspec    normalize;
 
   if ( !value )
@@ -146,32 +190,51 @@ int timer_settime(
     rtems_set_errno_and_return_minus_one( EINVAL );
   }
 
-  normalize = *value;
-
-  /* Convert absolute to relative time */
-  if (flags == TIMER_ABSTIME) {
-    struct timespec now;
-    _TOD_Get( &now );
-    /* Check for seconds in the past */
-    if ( _Timespec_Greater_than( &now, &normalize.it_value ) )
-      rtems_set_errno_and_return_minus_one( EINVAL );
-    _Timespec_Subtract( &now, &normalize.it_value, &normalize.it_value );
-  }
-
-  /* If the function reaches this point, then it will be necessary to do
-   * something with the structure of times of the timer: to stop, start
-   * or start it again
-   */
-
   ptimer = _POSIX_Timer_Get( timerid, &lock_context );
   if ( ptimer != NULL ) {
     Per_CPU_Control *cpu;
+    struct timespec  now;
+    struct timespec  expire;
+    unsigned int     watchdog_header;
 
     cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
+    normalize = *value;
 
-    /* Stop the timer */
+    /*
+     * An absolute expiration time uses the clock of the timer.  A relative
+     * expiration time does not change with the time of day, so it uses the
+     * monotonic clock independent of the clock of the timer.
+     */
+    if ( flags == TIMER_ABSTIME && ptimer->clock_type == CLOCK_REALTIME ) {
+      watchdog_header = PER_CPU_WATCHDOG_REALTIME;
+      _Timecounter_Nanotime( &now );
+    } else {
+      watchdog_header = PER_CPU_WATCHDOG_MONOTONIC;
+      _Timecounter_Nanouptime( &now );
+    }
+
+    /* Convert absolute to relative time */
+    if (flags == TIMER_ABSTIME) {
+      /* Check for seconds in the past */
+      if ( _Timespec_Greater_than( &now, &normalize.it_value ) ) {
+        _POSIX_Timer_Release( cpu, &lock_context );
+        rtems_set_errno_and_return_minus_one( EINVAL );
+      }
+      expire = normalize.it_value;
+      _Timespec_Subtract( &now, &normalize.it_value, &normalize.it_value );
+    } else {
+      expire = now;
+      _Timespec_Add_to( &expire, &normalize.it_value );
+    }
+
+    /* If the function reaches this point, then it will be necessary to do
+     * something with the structure of times of the timer: to stop, start
+     * or start it again
+     */
+
+    /* Stop the timer, it may be on the watchdog header of its last start */
     _Watchdog_Remove(
-      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      _POSIX_Timer_Get_watchdog_header( ptimer, cpu ),
       &ptimer->Timer
     );
 
@@ -189,11 +252,7 @@ int timer_settime(
       return 0;
     }
 
-    /* Convert from seconds and nanoseconds to ticks */
-    ptimer->ticks  = _Timespec_To_ticks( &value->it_interval );
-    initial_period = _Timespec_To_ticks( &normalize.it_value );
-
-    _POSIX_Timer_Insert( ptimer, cpu, initial_period );
+    _POSIX_Timer_Insert( ptimer, cpu, watchdog_header, &expire );
 
     /*
      * The timer has been started and is running.  So we return the
@@ -40,8 +40,7 @@
 #endif
 
 #include <rtems/rtems/eventimpl.h>
-#include <rtems/rtems/tasksdata.h>
-#include <rtems/score/threadimpl.h>
+#include <rtems/rtems/tasksimpl.h>
 
 rtems_status_code rtems_event_send(
   rtems_id        id,
@@ -52,7 +51,7 @@ rtems_status_code rtems_event_send(
   RTEMS_API_Control *api;
   ISR_lock_Context   lock_context;
 
-  the_thread = _Thread_Get( id, &lock_context );
+  the_thread = _RTEMS_tasks_Get( id, &lock_context );
 
   if ( the_thread == NULL ) {
 #if defined(RTEMS_MULTIPROCESSING)
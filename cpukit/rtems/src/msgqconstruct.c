@@ -110,6 +110,29 @@ rtems_status_code _Message_queue_Create(
     return RTEMS_INVALID_SIZE;
   }
 
+  if (
+    _Attributes_Is_single_producer( config->attributes )
+      && !_Attributes_Is_single_consumer( config->attributes )
+  ) {
+    return RTEMS_NOT_DEFINED;
+  }
+
+  if (
+    _Attributes_Is_single_consumer( config->attributes )
+      && ( config->maximum_pending_messages
+        & ( config->maximum_pending_messages - 1 ) ) != 0
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if (
+    _Attributes_Is_message_reference( config->attributes )
+      && config->maximum_message_size
+        != sizeof( rtems_message_queue_reference )
+  ) {
+    return RTEMS_INVALID_SIZE;
+  }
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _System_state_Is_multiprocessing ) {
     is_global = _Attributes_Is_global( config->attributes );
@@ -117,6 +140,14 @@ rtems_status_code _Message_queue_Create(
     is_global = false;
   }
 
+  if ( is_global && _Attributes_Is_single_consumer( config->attributes ) ) {
+    return RTEMS_NOT_DEFINED;
+  }
+
+  if ( is_global && _Attributes_Is_message_reference( config->attributes ) ) {
+    return RTEMS_NOT_DEFINED;
+  }
+
 #if 1
   /*
    * I am not 100% sure this should be an error.
@@ -186,6 +217,16 @@ rtems_status_code _Message_queue_Create(
     return _Status_Get( status );
   }
 
+  the_message_queue->is_reference =
+    _Attributes_Is_message_reference( config->attributes );
+
+  if ( _Attributes_Is_single_consumer( config->attributes ) ) {
+    _CORE_message_queue_Ring_initialize(
+      &the_message_queue->message_queue,
+      _Attributes_Is_single_producer( config->attributes )
+    );
+  }
+
   *id = _Objects_Open_u32(
     &_Message_queue_Information,
     &the_message_queue->Object,
@@ -63,6 +63,14 @@ rtems_status_code rtems_message_queue_flush(
 #endif
   }
 
+  if ( the_message_queue->message_queue.Ring.enabled ) {
+    *count = _CORE_message_queue_Ring_flush(
+      &the_message_queue->message_queue,
+      &queue_context
+    );
+    return RTEMS_SUCCESSFUL;
+  }
+
   *count = _CORE_message_queue_Flush(
     &the_message_queue->message_queue,
     &queue_context
@@ -63,6 +63,14 @@ rtems_status_code rtems_message_queue_get_number_pending(
 #endif
   }
 
+  if ( the_message_queue->message_queue.Ring.enabled ) {
+    *count = _CORE_message_queue_Ring_get_number_pending(
+      &the_message_queue->message_queue
+    );
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
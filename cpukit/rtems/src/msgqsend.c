@@ -66,6 +66,21 @@ rtems_status_code rtems_message_queue_send(
 #endif
   }
 
+  if ( _Message_queue_Is_reference_queue( the_message_queue ) ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return RTEMS_NOT_DEFINED;
+  }
+
+  if ( the_message_queue->message_queue.Ring.enabled ) {
+    status = _CORE_message_queue_Ring_submit(
+      &the_message_queue->message_queue,
+      buffer,
+      size,
+      &queue_context
+    );
+    return _Status_Get( status );
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
@@ -39,6 +39,7 @@
 #endif
 
 #include <rtems/rtems/semdata.h>
+#include <rtems/score/objectimpl.h>
 
 OBJECTS_INFORMATION_DEFINE_ZERO(
   _Semaphore,
@@ -46,3 +47,11 @@ OBJECTS_INFORMATION_DEFINE_ZERO(
   OBJECTS_RTEMS_SEMAPHORES,
   OBJECTS_NO_STRING_NAME
 );
+
+Objects_Control *_Semaphore_Get_configured(
+  Objects_Id        id,
+  ISR_lock_Context *lock_context
+)
+{
+  return _Objects_Get( id, lock_context, &_Semaphore_Information );
+}
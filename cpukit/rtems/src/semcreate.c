@@ -46,6 +46,7 @@
 #include <rtems/rtems/tasksimpl.h>
 #include <rtems/score/schedulerimpl.h>
 #include <rtems/score/sysstate.h>
+#include <rtems/score/wkspace.h>
 #include <rtems/sysinit.h>
 
 #define SEMAPHORE_KIND_MASK ( RTEMS_SEMAPHORE_CLASS | RTEMS_INHERIT_PRIORITY \
@@ -122,6 +123,30 @@ rtems_status_code rtems_semaphore_create(
     return RTEMS_NOT_DEFINED;
   }
 
+  if (
+    _Attributes_Is_adaptive_spin( attribute_set )
+      && variant != SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL
+      && variant != SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+  ) {
+    return RTEMS_NOT_DEFINED;
+  }
+
+  if ( _Attributes_Is_priority_bit_map( attribute_set ) ) {
+    if (
+      ( variant != SEMAPHORE_VARIANT_COUNTING
+        && variant != SEMAPHORE_VARIANT_SIMPLE_BINARY )
+        || !_Attributes_Is_priority( attribute_set )
+    ) {
+      return RTEMS_NOT_DEFINED;
+    }
+
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Attributes_Is_global( attribute_set ) ) {
+      return RTEMS_NOT_DEFINED;
+    }
+#endif
+  }
+
   if ( count > 1 && variant != SEMAPHORE_VARIANT_COUNTING ) {
     return RTEMS_INVALID_NUMBER;
   }
@@ -162,6 +187,10 @@ rtems_status_code rtems_semaphore_create(
     flags = _Semaphore_Set_discipline( flags, SEMAPHORE_DISCIPLINE_FIFO );
   }
 
+  if ( _Attributes_Is_adaptive_spin( attribute_set ) ) {
+    flags = _Semaphore_Make_adaptive_spin( flags );
+  }
+
   _Semaphore_Set_flags( the_semaphore, flags );
   executing = _Thread_Get_executing();
 
@@ -248,7 +277,28 @@ rtems_status_code rtems_semaphore_create(
         &the_semaphore->Core_control.Semaphore,
         count
       );
-      status = STATUS_SUCCESSFUL;
+
+      if ( _Attributes_Is_priority_bit_map( attribute_set ) ) {
+        Thread_queue_Priority_bit_map *bit_map;
+
+        bit_map = _Workspace_Allocate( sizeof( *bit_map ) );
+
+        if ( bit_map != NULL ) {
+          _Thread_queue_Priority_bit_map_initialize( bit_map );
+          the_semaphore->Core_control.Priority_bit_map.bit_map = bit_map;
+          _Semaphore_Set_flags(
+            the_semaphore,
+            _Semaphore_Make_priority_bit_map( flags )
+          );
+          status = STATUS_SUCCESSFUL;
+        } else {
+          _Thread_queue_Destroy( &the_semaphore->Core_control.Wait_queue );
+          status = STATUS_UNSATISFIED;
+        }
+      } else {
+        status = STATUS_SUCCESSFUL;
+      }
+
       break;
   }
 
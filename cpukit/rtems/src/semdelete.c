@@ -41,6 +41,7 @@
 
 #include <rtems/rtems/semimpl.h>
 #include <rtems/rtems/statusimpl.h>
+#include <rtems/score/wkspace.h>
 
 rtems_status_code rtems_semaphore_delete(
   rtems_id   id
@@ -152,6 +153,10 @@ rtems_status_code rtems_semaphore_delete(
   }
 #endif
 
+  if ( _Semaphore_Is_priority_bit_map( flags ) ) {
+    _Workspace_Free( the_semaphore->Core_control.Priority_bit_map.bit_map );
+  }
+
   _Semaphore_Free( the_semaphore );
   _Objects_Allocator_unlock();
   return RTEMS_SUCCESSFUL;
@@ -112,6 +112,7 @@ rtems_status_code rtems_semaphore_obtain(
         CORE_MUTEX_TQ_PRIORITY_INHERIT_OPERATIONS,
         executing,
         wait,
+        _Semaphore_Is_adaptive_spin( flags ),
         _CORE_recursive_mutex_Seize_nested,
         &queue_context
       );
@@ -131,6 +132,7 @@ rtems_status_code rtems_semaphore_obtain(
         _Semaphore_Get_operations( flags ),
         executing,
         wait,
+        _Semaphore_Is_adaptive_spin( flags ),
         _CORE_recursive_mutex_Seize_nested,
         &queue_context
       );
@@ -150,6 +152,14 @@ rtems_status_code rtems_semaphore_obtain(
         variant == SEMAPHORE_VARIANT_SIMPLE_BINARY
           || variant == SEMAPHORE_VARIANT_COUNTING
       );
+
+      if ( _Semaphore_Is_priority_bit_map( flags ) ) {
+        _Thread_queue_Context_set_priority_bit_map(
+          &queue_context,
+          the_semaphore->Core_control.Priority_bit_map.bit_map
+        );
+      }
+
       status = _CORE_semaphore_Seize(
         &the_semaphore->Core_control.Semaphore,
         _Semaphore_Get_operations( flags ),
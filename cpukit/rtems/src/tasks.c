@@ -40,9 +40,18 @@
 #endif
 
 #include <rtems/rtems/tasksdata.h>
+#include <rtems/score/objectimpl.h>
 
 THREAD_INFORMATION_DEFINE_ZERO(
   _RTEMS_tasks,
   OBJECTS_CLASSIC_API,
   OBJECTS_RTEMS_TASKS
 );
+
+Objects_Control *_RTEMS_tasks_Get_configured(
+  Objects_Id        id,
+  ISR_lock_Context *lock_context
+)
+{
+  return _Objects_Get( id, lock_context, &_RTEMS_tasks_Information.Objects );
+}
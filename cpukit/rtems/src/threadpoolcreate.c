@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIClassicThreadPool
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_thread_pool_create().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/threadpool.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/threadpoolimpl.h>
+
+static void _Thread_pool_Worker( rtems_task_argument arg )
+{
+  Thread_pool_Control *pool;
+  Thread_Control      *executing;
+  Thread_pool_Work    *work;
+
+  pool = (Thread_pool_Control *) arg;
+  executing = _Thread_Get_executing();
+
+  while ( ( work = _Thread_pool_Get_work( pool, executing ) ) != NULL ) {
+    ( *work->handler )( work );
+  }
+
+  rtems_task_exit();
+}
+
+rtems_status_code rtems_thread_pool_create(
+  rtems_thread_pool              *pool,
+  const rtems_thread_pool_config *config
+)
+{
+  uint32_t i;
+
+  if ( pool == NULL || config == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( config->worker_count == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  _Thread_pool_Initialize( pool, "Thread Pool" );
+
+  for ( i = 0; i < config->worker_count; ++i ) {
+    rtems_status_code sc;
+    rtems_id          id;
+
+    sc = rtems_task_create(
+      config->name,
+      config->initial_priority,
+      config->stack_size,
+      config->initial_modes,
+      config->attributes,
+      &id
+    );
+
+    if ( sc == RTEMS_SUCCESSFUL && config->affinity != NULL ) {
+      sc = rtems_task_set_affinity(
+        id,
+        config->affinity_size,
+        config->affinity
+      );
+
+      if ( sc != RTEMS_SUCCESSFUL ) {
+        (void) rtems_task_delete( id );
+      }
+    }
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      _Thread_pool_Terminate( pool, _Thread_Get_executing() );
+      return sc;
+    }
+
+    _Thread_pool_Add_worker( pool );
+    sc = rtems_task_start(
+      id,
+      _Thread_pool_Worker,
+      (rtems_task_argument) pool
+    );
+    _Assert( sc == RTEMS_SUCCESSFUL );
+    (void) sc;
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
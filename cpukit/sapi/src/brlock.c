@@ -0,0 +1,123 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIBRLock
+ *
+ * @brief This source file contains the implementation of the
+ *   @ref RTEMSAPIBRLock.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/brlock.h>
+#include <rtems/rtems/statusimpl.h>
+#include <rtems/score/brlockimpl.h>
+
+rtems_status_code rtems_brlock_initialize(
+  rtems_brlock *lock,
+  const char   *name
+)
+{
+  if ( !_BRLock_Initialize( lock, name ) ) {
+    return RTEMS_TOO_MANY;
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_brlock_destroy( rtems_brlock *lock )
+{
+  if ( _BRLock_Is_busy( lock ) ) {
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  _BRLock_Destroy( lock );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_brlock_read_lock( rtems_brlock *lock )
+{
+  Thread_queue_Context queue_context;
+  Status_Control       status;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  status = _BRLock_Seize_for_reading( lock, true, &queue_context );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_brlock_try_read_lock( rtems_brlock *lock )
+{
+  Thread_queue_Context queue_context;
+  Status_Control       status;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  status = _BRLock_Seize_for_reading( lock, false, &queue_context );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_brlock_read_unlock( rtems_brlock *lock )
+{
+  Status_Control status;
+
+  status = _BRLock_Surrender( lock );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_brlock_write_lock( rtems_brlock *lock )
+{
+  Thread_queue_Context queue_context;
+  Status_Control       status;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  status = _BRLock_Seize_for_writing( lock, true, &queue_context );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_brlock_try_write_lock( rtems_brlock *lock )
+{
+  Thread_queue_Context queue_context;
+  Status_Control       status;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  status = _BRLock_Seize_for_writing( lock, false, &queue_context );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_brlock_write_unlock( rtems_brlock *lock )
+{
+  Status_Control status;
+
+  status = _BRLock_Surrender( lock );
+  return _Status_Get( status );
+}
@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISchedulerStatistics
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_scheduler_get_latency_histogram(),
+ *   rtems_scheduler_get_statistics(),
+ *   rtems_scheduler_latency_bucket_lower_bound(), and
+ *   rtems_scheduler_reset_statistics().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/schedulerstats.h>
+#include <rtems/counter.h>
+#include <rtems/score/schedulerimpl.h>
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+RTEMS_STATIC_ASSERT(
+  RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT
+    == SCHEDULER_STATISTICS_PRIORITY_COUNT,
+  scheduler_statistics_priority_count
+);
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT
+    == SCHEDULER_STATISTICS_BUCKET_COUNT,
+  scheduler_statistics_bucket_count
+);
+
+static uint32_t _Scheduler_Statistics_Load( const Atomic_Uint *counter )
+{
+  return _Atomic_Load_uint( counter, ATOMIC_ORDER_RELAXED );
+}
+
+static void _Scheduler_Statistics_Get_counters(
+  const Scheduler_Control    *scheduler,
+  rtems_scheduler_statistics *statistics
+)
+{
+  const Scheduler_Statistics *source;
+
+  source = _Scheduler_Statistics_Get( scheduler );
+  statistics->blocks = _Scheduler_Statistics_Load( &source->blocks );
+  statistics->unblocks = _Scheduler_Statistics_Load( &source->unblocks );
+  statistics->priority_updates =
+    _Scheduler_Statistics_Load( &source->priority_updates );
+  statistics->help_requests =
+    _Scheduler_Statistics_Load( &source->help_requests );
+  statistics->switches = _Scheduler_Statistics_Load( &source->switches );
+  statistics->preemptions = _Scheduler_Statistics_Load( &source->preemptions );
+}
+
+static void _Scheduler_Statistics_Get_histogram(
+  const Scheduler_Control           *scheduler,
+  rtems_task_priority                priority,
+  rtems_scheduler_latency_histogram *histogram
+)
+{
+  const Atomic_Uint *counts;
+  size_t             i;
+
+  counts = &_Scheduler_Statistics_Get( scheduler )->latencies[ priority ][ 0 ];
+
+  for ( i = 0; i < SCHEDULER_STATISTICS_BUCKET_COUNT; ++i ) {
+    histogram->counts[ i ] = _Scheduler_Statistics_Load( &counts[ i ] );
+  }
+}
+
+static void _Scheduler_Statistics_Reset( const Scheduler_Control *scheduler )
+{
+  Scheduler_Statistics *statistics;
+  size_t                priority;
+  size_t                i;
+
+  statistics = _Scheduler_Statistics_Get( scheduler );
+  _Atomic_Store_uint( &statistics->blocks, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &statistics->unblocks, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &statistics->priority_updates, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &statistics->help_requests, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &statistics->switches, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &statistics->preemptions, 0, ATOMIC_ORDER_RELAXED );
+
+  for (
+    priority = 0;
+    priority < SCHEDULER_STATISTICS_PRIORITY_COUNT;
+    ++priority
+  ) {
+    for ( i = 0; i < SCHEDULER_STATISTICS_BUCKET_COUNT; ++i ) {
+      _Atomic_Store_uint(
+        &statistics->latencies[ priority ][ i ],
+        0,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+}
+#endif
+
+rtems_status_code rtems_scheduler_get_statistics(
+  rtems_id                    scheduler_id,
+  rtems_scheduler_statistics *statistics
+)
+{
+  const Scheduler_Control *scheduler;
+
+  if ( statistics == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  scheduler = _Scheduler_Get_by_id( scheduler_id );
+
+  if ( scheduler == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Get_counters( scheduler, statistics );
+  return RTEMS_SUCCESSFUL;
+#else
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+rtems_status_code rtems_scheduler_get_latency_histogram(
+  rtems_id                           scheduler_id,
+  rtems_task_priority                priority,
+  rtems_scheduler_latency_histogram *histogram
+)
+{
+  const Scheduler_Control *scheduler;
+
+  if ( histogram == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  scheduler = _Scheduler_Get_by_id( scheduler_id );
+
+  if ( scheduler == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+  if ( priority >= RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT ) {
+    return RTEMS_INVALID_PRIORITY;
+  }
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Get_histogram( scheduler, priority, histogram );
+  return RTEMS_SUCCESSFUL;
+#else
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+rtems_status_code rtems_scheduler_reset_statistics( rtems_id scheduler_id )
+{
+  const Scheduler_Control *scheduler;
+
+  scheduler = _Scheduler_Get_by_id( scheduler_id );
+
+  if ( scheduler == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+  _Scheduler_Statistics_Reset( scheduler );
+  return RTEMS_SUCCESSFUL;
+#else
+  return RTEMS_NOT_IMPLEMENTED;
+#endif
+}
+
+uint64_t rtems_scheduler_latency_bucket_lower_bound( uint32_t bucket )
+{
+  if ( bucket == 0 ) {
+    return 0;
+  }
+
+  return rtems_counter_ticks_to_nanoseconds(
+    (rtems_counter_ticks) ( 1U << bucket )
+  );
+}
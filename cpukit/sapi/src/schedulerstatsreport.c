@@ -0,0 +1,175 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISchedulerStatistics
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_scheduler_statistics_report().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/schedulerstats.h>
+#include <rtems/score/schedulerimpl.h>
+
+#include <ctype.h>
+#include <inttypes.h>
+
+static char bits_to_char( uint8_t bits )
+{
+  return isprint( bits ) ? (char) bits : '?';
+}
+
+static void name_to_str( uint32_t name, char str[ 5 ] )
+{
+  str[ 0 ] = bits_to_char( (uint8_t) ( name >> 24 ) );
+  str[ 1 ] = bits_to_char( (uint8_t) ( name >> 16 ) );
+  str[ 2 ] = bits_to_char( (uint8_t) ( name >> 8 ) );
+  str[ 3 ] = bits_to_char( (uint8_t) ( name >> 0 ) );
+  str[ 4 ] = '\0';
+}
+
+static int report_histograms(
+  const rtems_printer *printer,
+  rtems_id             scheduler_id
+)
+{
+  rtems_task_priority priority;
+  int                 n;
+
+  n = rtems_printf(
+    printer,
+    "  PRIORITY |     LATENCY MIN [ns] |     LATENCY MAX [ns] |      COUNT\n"
+  );
+
+  for (
+    priority = 0;
+    priority < RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT;
+    ++priority
+  ) {
+    rtems_scheduler_latency_histogram histogram;
+    uint32_t                          bucket;
+
+    (void) rtems_scheduler_get_latency_histogram(
+      scheduler_id,
+      priority,
+      &histogram
+    );
+
+    for (
+      bucket = 0;
+      bucket < RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT;
+      ++bucket
+    ) {
+      uint64_t upper_bound;
+
+      if ( histogram.counts[ bucket ] == 0 ) {
+        continue;
+      }
+
+      if ( bucket + 1 < RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT ) {
+        upper_bound = rtems_scheduler_latency_bucket_lower_bound( bucket + 1 );
+      } else {
+        upper_bound = UINT64_MAX;
+      }
+
+      n += rtems_printf(
+        printer,
+        "  %8" PRIu32 " | %20" PRIu64 " | %20" PRIu64 " | %10" PRIu32 "\n",
+        priority,
+        rtems_scheduler_latency_bucket_lower_bound( bucket ),
+        upper_bound,
+        histogram.counts[ bucket ]
+      );
+    }
+  }
+
+  return n;
+}
+
+int rtems_scheduler_statistics_report( const rtems_printer *printer )
+{
+  uint32_t scheduler_index;
+  int      n;
+
+  n = rtems_printf(
+    printer,
+    "-------------------------------------------------------------------------------\n"
+    "                              SCHEDULER STATISTICS\n"
+    "-------------------------------------------------------------------------------\n"
+  );
+
+  for (
+    scheduler_index = 0;
+    scheduler_index < _Scheduler_Count;
+    ++scheduler_index
+  ) {
+    rtems_scheduler_statistics statistics;
+    rtems_status_code          sc;
+    rtems_id                   scheduler_id;
+    char                       scheduler_str[ 5 ];
+
+    scheduler_id = _Scheduler_Build_id( scheduler_index );
+    name_to_str( _Scheduler_Table[ scheduler_index ].name, scheduler_str );
+    sc = rtems_scheduler_get_statistics( scheduler_id, &statistics );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      n += rtems_printf(
+        printer,
+        "scheduler statistics are disabled (RTEMS_SCHEDULER_STATISTICS)\n"
+      );
+      break;
+    }
+
+    n += rtems_printf(
+      printer,
+      "SCHEDULER 0x%08" PRIx32 " (%s)\n"
+      "  BLOCKS:           %10" PRIu32 "\n"
+      "  UNBLOCKS:         %10" PRIu32 "\n"
+      "  PRIORITY UPDATES: %10" PRIu32 "\n"
+      "  HELP REQUESTS:    %10" PRIu32 "\n"
+      "  SWITCHES:         %10" PRIu32 "\n"
+      "  PREEMPTIONS:      %10" PRIu32 "\n",
+      scheduler_id,
+      &scheduler_str[ 0 ],
+      statistics.blocks,
+      statistics.unblocks,
+      statistics.priority_updates,
+      statistics.help_requests,
+      statistics.switches,
+      statistics.preemptions
+    );
+    n += report_histograms( printer, scheduler_id );
+  }
+
+  return n;
+}
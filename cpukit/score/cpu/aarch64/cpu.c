@@ -39,10 +39,43 @@
 #endif
 
 #include <rtems/score/cpuimpl.h>
+#include <rtems/score/percpu.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/tls.h>
 
-#ifdef AARCH64_MULTILIB_VFP
+#include <string.h>
+
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  RTEMS_STATIC_ASSERT(
+    offsetof( Context_Control, fp_context )
+      == AARCH64_CONTEXT_CONTROL_FP_CONTEXT_OFFSET,
+    AARCH64_CONTEXT_CONTROL_FP_CONTEXT_OFFSET
+  );
+
+  RTEMS_STATIC_ASSERT(
+    offsetof( AArch64_FP_context, register_fpsr )
+      == AARCH64_FP_CONTEXT_FPSR_OFFSET,
+    AARCH64_FP_CONTEXT_FPSR_OFFSET
+  );
+
+  RTEMS_STATIC_ASSERT(
+    offsetof( AArch64_FP_context, register_fpcr )
+      == AARCH64_FP_CONTEXT_FPCR_OFFSET,
+    AARCH64_FP_CONTEXT_FPCR_OFFSET
+  );
+
+  RTEMS_STATIC_ASSERT(
+    offsetof( Per_CPU_Control, cpu_per_cpu.fp_owner )
+      == AARCH64_PER_CPU_FP_OWNER_OFFSET,
+    AARCH64_PER_CPU_FP_OWNER_OFFSET
+  );
+
+  RTEMS_STATIC_ASSERT(
+    offsetof( Per_CPU_Control, cpu_per_cpu.fp_executing )
+      == AARCH64_PER_CPU_FP_EXECUTING_OFFSET,
+    AARCH64_PER_CPU_FP_EXECUTING_OFFSET
+  );
+#elif defined(AARCH64_MULTILIB_VFP)
   RTEMS_STATIC_ASSERT(
     offsetof( Context_Control, register_d8 )
       == AARCH64_CONTEXT_CONTROL_D8_OFFSET,
@@ -144,6 +177,10 @@ void _CPU_Context_Initialize(
   if ( tls_area != NULL ) {
     the_context->thread_id = (uintptr_t) _TLS_Initialize_area( tls_area );
   }
+
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  memset( &the_context->fp_context, 0, sizeof( the_context->fp_context ) );
+#endif
 }
 
 #if !defined(RTEMS_PARAVIRT)
@@ -88,6 +88,31 @@
 
 #define CPU_USE_DEFERRED_FP_SWITCH FALSE
 
+/*
+ * The lazy floating point switch is enabled by the RTEMS_LAZY_FP_SWITCH build
+ * option.  During a context switch, the floating point unit is disabled for
+ * EL1 (CPACR_EL1.FPEN) if the heir thread is not the floating point owner of
+ * the processor.  The first floating point or SIMD instruction of the heir
+ * traps.  The trap handler saves the floating point context of the owner,
+ * restores the floating point context of the executing thread, and makes it
+ * the new owner.  The floating point unit is enabled during interrupt
+ * processing, so interrupt handlers may use it.
+ *
+ * In SMP configurations, the lazy floating point switch is not supported.
+ * The floating point registers of a thread may be owned by a processor other
+ * than the one the thread migrated to.  This would require to flush the
+ * floating point context through an inter-processor interrupt.  The build
+ * option is therefore not available in SMP configurations.
+ *
+ * The ARM port (FPEXC.EN) and the RISC-V port (mstatus.FS) could use the same
+ * trap based approach, however, they implement only the eager floating point
+ * switch.
+ */
+#if defined(AARCH64_MULTILIB_VFP) && defined(RTEMS_LAZY_FP_SWITCH) && \
+  !defined(RTEMS_SMP)
+  #define AARCH64_USE_LAZY_FP_SWITCH
+#endif
+
 #define CPU_ENABLE_ROBUST_THREAD_DISPATCH TRUE
 
 #define CPU_STACK_GROWS_UP FALSE
@@ -131,7 +156,11 @@
 
 #define AARCH64_CONTEXT_CONTROL_THREAD_ID_OFFSET 0x70
 
-#ifdef AARCH64_MULTILIB_VFP
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  #define AARCH64_CONTEXT_CONTROL_FP_CONTEXT_OFFSET 0x80
+  #define AARCH64_FP_CONTEXT_FPSR_OFFSET 0x200
+  #define AARCH64_FP_CONTEXT_FPCR_OFFSET 0x208
+#elif defined(AARCH64_MULTILIB_VFP)
   #define AARCH64_CONTEXT_CONTROL_D8_OFFSET 0x78
 #endif
 
@@ -170,6 +199,18 @@ extern "C" {
 typedef unsigned __int128 uint128_t;
 #pragma GCC diagnostic pop
 
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+/**
+ * @brief This structure contains the floating point context saved and
+ *   restored on demand by the lazy floating point switch.
+ */
+typedef struct {
+  uint128_t register_q[ 32 ];
+  uint64_t register_fpsr;
+  uint64_t register_fpcr;
+} AArch64_FP_context;
+#endif
+
 typedef struct {
   uint64_t register_x19;
   uint64_t register_x20;
@@ -186,7 +227,9 @@ typedef struct {
   uint64_t register_sp;
   uint64_t isr_dispatch_disable;
   uint64_t thread_id;
-#ifdef AARCH64_MULTILIB_VFP
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  AArch64_FP_context fp_context;
+#elif defined(AARCH64_MULTILIB_VFP)
   uint64_t register_d8;
   uint64_t register_d9;
   uint64_t register_d10;
@@ -306,6 +349,16 @@ void _CPU_Context_Initialize(
 #define _CPU_Context_Restart_self( _the_context ) \
    _CPU_Context_restore( (_the_context) );
 
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+#define _CPU_Context_Destroy( _the_thread, _the_context ) \
+  do { \
+    Per_CPU_Control *cpu_self = _Per_CPU_Get(); \
+    if ( cpu_self->cpu_per_cpu.fp_owner == ( _the_context ) ) { \
+      cpu_self->cpu_per_cpu.fp_owner = NULL; \
+    } \
+  } while ( 0 )
+#endif
+
 #define _CPU_Context_Initialize_fp( _destination ) \
   do { \
     *(*(_destination)) = _CPU_Null_fp_context; \
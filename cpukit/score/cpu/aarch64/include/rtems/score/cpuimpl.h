@@ -49,9 +49,47 @@
  * @{
  */
 
-#define CPU_PER_CPU_CONTROL_SIZE 0
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  #define CPU_PER_CPU_CONTROL_SIZE 16
 
-#define CPU_INTERRUPT_FRAME_SIZE 0x2E0
+  /**
+   * @brief Offset of the CPU_Per_CPU_control::fp_owner field relative to the
+   * Per_CPU_Control begin.
+   */
+  #define AARCH64_PER_CPU_FP_OWNER_OFFSET 0
+
+  /**
+   * @brief Offset of the CPU_Per_CPU_control::fp_executing field relative to
+   * the Per_CPU_Control begin.
+   */
+  #define AARCH64_PER_CPU_FP_EXECUTING_OFFSET 8
+
+  #define CPU_INTERRUPT_FRAME_SIZE 0x2F0
+
+  /**
+   * @brief Offset of the CPU_Interrupt_frame::register_cpacr field relative to
+   * the interrupt frame begin on the stack.
+   */
+  #define AARCH64_INTERRUPT_FRAME_CPACR_OFFSET 0x0
+
+  /**
+   * @brief Offset of the CPU_Interrupt_frame::register_fpsr field relative to
+   * the interrupt frame begin on the stack.
+   */
+  #define AARCH64_INTERRUPT_FRAME_FPSR_OFFSET 0x10
+
+  /**
+   * @brief This CPACR_EL1 bit enables the floating point unit for EL1.
+   *
+   * It is the lower bit of the CPACR_EL1.FPEN field.  If it is cleared, then
+   * floating point and SIMD instructions executed at EL1 trap.
+   */
+  #define AARCH64_CPACR_EL1_FPEN_EL1_BIT 20
+#else
+  #define CPU_PER_CPU_CONTROL_SIZE 0
+
+  #define CPU_INTERRUPT_FRAME_SIZE 0x2E0
+#endif
 
 #define CPU_THREAD_LOCAL_STORAGE_VARIANT 11
 
@@ -124,8 +162,49 @@ typedef struct {
   uint64_t register_spsr;
   uint64_t register_fpsr;
   uint64_t register_fpcr;
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+  /**
+   * @brief This member contains the CPACR_EL1 value at interrupt entry.
+   *
+   * If the floating point unit was disabled at interrupt entry, then the
+   * saved floating point registers belong to the floating point owner and not
+   * to the interrupted thread.  The floating point unit is disabled again
+   * after the restore of the floating point registers.
+   */
+  uint64_t register_cpacr;
+  uint64_t reserved_for_stack_alignment;
+#endif
 } CPU_Interrupt_frame;
 
+#if defined(AARCH64_USE_LAZY_FP_SWITCH)
+typedef struct {
+  /**
+   * @brief This member references the context of the current floating point
+   *   owner of the processor.
+   *
+   * The floating point registers contain the floating point context of the
+   * owner.  If this member is NULL, then the floating point registers have no
+   * owner.
+   */
+  Context_Control *fp_owner;
+#ifdef AARCH64_MULTILIB_ARCH_V8_ILP32
+  uint32_t _fp_owner_top;
+#endif
+
+  /**
+   * @brief This member references the context of the thread executing on the
+   *   processor.
+   *
+   * It is set by the context switch and used by the lazy floating point
+   * switch to get the context of the new floating point owner.
+   */
+  Context_Control *fp_executing;
+#ifdef AARCH64_MULTILIB_ARCH_V8_ILP32
+  uint32_t _fp_executing_top;
+#endif
+} CPU_Per_CPU_control;
+#endif
+
 #ifdef RTEMS_SMP
 
 static inline
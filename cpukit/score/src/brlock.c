@@ -0,0 +1,460 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRLock
+ *
+ * @brief This source file contains the implementation of the
+ *   @ref RTEMSScoreBRLock.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/brlockimpl.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+typedef struct {
+  Atomic_Uint readers[ BRLOCK_MAXIMUM_COUNT ];
+} BRLock_Per_CPU;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( BRLock_Per_CPU, _BRLock_Per_CPU );
+
+static Atomic_Uint _BRLock_Slots;
+
+RTEMS_STATIC_ASSERT(
+  BRLOCK_MAXIMUM_COUNT <= sizeof( unsigned int ) * 8,
+  BRLOCK_MAXIMUM_COUNT
+);
+
+static uint8_t *_BRLock_Get_read_nest_level(
+  const BRLock_Control *brlock,
+  Thread_Control       *the_thread
+)
+{
+  return &the_thread->brlock_read_nest_levels[ brlock->slot ];
+}
+
+static Atomic_Uint *_BRLock_Get_readers(
+  const BRLock_Control  *brlock,
+  const Per_CPU_Control *cpu
+)
+{
+  BRLock_Per_CPU *per_cpu;
+
+  per_cpu = PER_CPU_DATA_GET( cpu, BRLock_Per_CPU, _BRLock_Per_CPU );
+  return &per_cpu->readers[ brlock->slot ];
+}
+
+static unsigned int _BRLock_Sum_readers( const BRLock_Control *brlock )
+{
+  unsigned int sum;
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+
+  /*
+   * A reader may increment the counter of one processor and decrement the
+   * counter of another processor after a thread migration.  The counters are
+   * unsigned integers, so only the sum of all counters is meaningful.
+   */
+  sum = 0;
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    sum += _Atomic_Load_uint(
+      _BRLock_Get_readers( brlock, cpu ),
+      ATOMIC_ORDER_ACQUIRE
+    );
+  }
+
+  return sum;
+}
+
+static Thread_Control *_BRLock_Acquire(
+  BRLock_Control       *brlock,
+  Thread_queue_Context *queue_context
+)
+{
+  ISR_Level       level;
+  Thread_Control *executing;
+
+  _Thread_queue_Context_ISR_disable( queue_context, level );
+  _Thread_queue_Context_set_ISR_level( queue_context, level );
+  executing = _Thread_Executing;
+  _Thread_queue_Queue_acquire_critical(
+    &brlock->Queue,
+    &executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  return executing;
+}
+
+static void _BRLock_Release(
+  BRLock_Control       *brlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Queue_release(
+    &brlock->Queue,
+    &queue_context->Lock_context.Lock_context
+  );
+}
+
+static void _BRLock_Flush(
+  BRLock_Control       *brlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Flush_critical(
+    &brlock->Queue,
+    BRLOCK_TQ_OPERATIONS,
+    _Thread_queue_Flush_default_filter,
+    queue_context
+  );
+}
+
+static Status_Control _BRLock_Wait(
+  BRLock_Control       *brlock,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_RWLOCK
+  );
+  _Thread_queue_Context_set_deadlock_callout(
+    queue_context,
+    _Thread_queue_Deadlock_status
+  );
+  _Thread_queue_Enqueue(
+    &brlock->Queue,
+    BRLOCK_TQ_OPERATIONS,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+bool _BRLock_Initialize( BRLock_Control *brlock, const char *name )
+{
+  unsigned int slots;
+  unsigned int slot;
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+
+  slots = _Atomic_Load_uint( &_BRLock_Slots, ATOMIC_ORDER_RELAXED );
+
+  do {
+    slot = 0;
+
+    while (
+      slot < BRLOCK_MAXIMUM_COUNT && ( slots & ( 1U << slot ) ) != 0
+    ) {
+      ++slot;
+    }
+
+    if ( slot == BRLOCK_MAXIMUM_COUNT ) {
+      return false;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      &_BRLock_Slots,
+      &slots,
+      slots | ( 1U << slot ),
+      ATOMIC_ORDER_ACQ_REL,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  _Thread_queue_Queue_initialize( &brlock->Queue, name );
+  _Atomic_Init_uint( &brlock->writer, 0 );
+  brlock->slot = slot;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    _Atomic_Store_uint(
+      _BRLock_Get_readers( brlock, cpu ),
+      0,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+
+  return true;
+}
+
+void _BRLock_Destroy( BRLock_Control *brlock )
+{
+  _Assert( !_BRLock_Is_busy( brlock ) );
+  _Assert( _BRLock_Sum_readers( brlock ) == 0 );
+  _Atomic_Fetch_and_uint(
+    &_BRLock_Slots,
+    ~( 1U << brlock->slot ),
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+static Status_Control _BRLock_Seize_for_reading_slow(
+  BRLock_Control       *brlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *executing;
+
+  executing = _BRLock_Acquire( brlock, queue_context );
+
+  /*
+   * A writer announces its presence while it owns the thread queue lock, so
+   * the writer observes the reader counter increment below.
+   */
+  while ( _Atomic_Load_uint( &brlock->writer, ATOMIC_ORDER_RELAXED ) != 0 ) {
+    Status_Control status;
+
+    if ( !wait ) {
+      _BRLock_Release( brlock, queue_context );
+      return STATUS_UNAVAILABLE;
+    }
+
+    status = _BRLock_Wait( brlock, executing, queue_context );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      return status;
+    }
+
+    executing = _BRLock_Acquire( brlock, queue_context );
+  }
+
+  _Atomic_Fetch_add_uint(
+    _BRLock_Get_readers( brlock, _Per_CPU_Get_snapshot() ),
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _BRLock_Release( brlock, queue_context );
+  return STATUS_SUCCESSFUL;
+}
+
+static void _BRLock_Surrender_for_reading( BRLock_Control *brlock )
+{
+  /*
+   * The thread may execute on another processor than the one of the
+   * corresponding reader counter increment.  This is fine, since only the sum
+   * of all reader counters matters.
+   */
+  _Atomic_Fetch_sub_uint(
+    _BRLock_Get_readers( brlock, _Per_CPU_Get_snapshot() ),
+    1,
+    ATOMIC_ORDER_RELEASE
+  );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _Atomic_Load_uint( &brlock->writer, ATOMIC_ORDER_RELAXED ) != 0 ) {
+    Thread_queue_Context queue_context;
+
+    /*
+     * Wake up the writer waiting for the readers to drain.  It checks the
+     * reader counters again while it owns the thread queue lock.  Readers
+     * waiting for the writer will block again.
+     */
+    _Thread_queue_Context_initialize( &queue_context );
+    _BRLock_Acquire( brlock, &queue_context );
+    _BRLock_Flush( brlock, &queue_context );
+  }
+}
+
+Status_Control _BRLock_Seize_for_reading(
+  BRLock_Control       *brlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  uint8_t        *nest_level;
+  Status_Control  status;
+
+  nest_level = _BRLock_Get_read_nest_level( brlock, _Thread_Get_executing() );
+
+  /*
+   * A recursive read lock must not wait for a writer, since the writer waits
+   * for the readers to drain.  Only the outermost read lock and unlock of the
+   * thread change the reader counters.
+   */
+  if ( *nest_level != 0 ) {
+    if ( *nest_level == UINT8_MAX ) {
+      return STATUS_TOO_MANY;
+    }
+
+    ++*nest_level;
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Atomic_Fetch_add_uint(
+    _BRLock_Get_readers( brlock, _Per_CPU_Get_snapshot() ),
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  /*
+   * The fence pairs with the fence of the writer after it announced its
+   * presence.  Either the writer observes our reader counter increment or we
+   * observe the writer.
+   */
+  if (
+    _Atomic_Load_uint( &brlock->writer, ATOMIC_ORDER_ACQUIRE ) == 0
+  ) {
+    *nest_level = 1;
+    return STATUS_SUCCESSFUL;
+  }
+
+  _BRLock_Surrender_for_reading( brlock );
+  status = _BRLock_Seize_for_reading_slow( brlock, wait, queue_context );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *nest_level = 1;
+  }
+
+  return status;
+}
+
+static void _BRLock_Give_up_writing(
+  BRLock_Control       *brlock,
+  Thread_queue_Context *queue_context
+)
+{
+  brlock->Queue.owner = NULL;
+  _Atomic_Store_uint( &brlock->writer, 0, ATOMIC_ORDER_RELEASE );
+  _BRLock_Flush( brlock, queue_context );
+}
+
+Status_Control _BRLock_Seize_for_writing(
+  BRLock_Control       *brlock,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *executing;
+  Status_Control  status;
+
+  /*
+   * The calling thread would wait forever for its own reader counter
+   * increment to drain.
+   */
+  if ( *_BRLock_Get_read_nest_level( brlock, _Thread_Get_executing() ) != 0 ) {
+    return STATUS_DEADLOCK;
+  }
+
+  executing = _BRLock_Acquire( brlock, queue_context );
+
+  while ( _Atomic_Load_uint( &brlock->writer, ATOMIC_ORDER_RELAXED ) != 0 ) {
+    if ( !wait ) {
+      _BRLock_Release( brlock, queue_context );
+      return STATUS_UNAVAILABLE;
+    }
+
+    status = _BRLock_Wait( brlock, executing, queue_context );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      return status;
+    }
+
+    executing = _BRLock_Acquire( brlock, queue_context );
+  }
+
+  _Atomic_Store_uint( &brlock->writer, 1, ATOMIC_ORDER_RELAXED );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  while ( _BRLock_Sum_readers( brlock ) != 0 ) {
+    if ( !wait ) {
+      _BRLock_Give_up_writing( brlock, queue_context );
+      return STATUS_UNAVAILABLE;
+    }
+
+    status = _BRLock_Wait( brlock, executing, queue_context );
+    executing = _BRLock_Acquire( brlock, queue_context );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      _BRLock_Give_up_writing( brlock, queue_context );
+      return status;
+    }
+  }
+
+  brlock->Queue.owner = executing;
+  _BRLock_Release( brlock, queue_context );
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _BRLock_Surrender( BRLock_Control *brlock )
+{
+  Thread_queue_Context  queue_context;
+  Thread_Control       *executing;
+
+  executing = _Thread_Get_executing();
+
+  if ( brlock->Queue.owner != executing ) {
+    uint8_t *nest_level;
+
+    nest_level = _BRLock_Get_read_nest_level( brlock, executing );
+
+    /*
+     * The reader counters are not associated with threads.  Make sure that
+     * the counters cannot underflow by an unlock of a thread which does not
+     * own the lock.
+     */
+    if ( *nest_level == 0 ) {
+      return STATUS_NOT_OWNER;
+    }
+
+    --*nest_level;
+
+    if ( *nest_level == 0 ) {
+      _BRLock_Surrender_for_reading( brlock );
+    }
+
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _BRLock_Acquire( brlock, &queue_context );
+  _BRLock_Give_up_writing( brlock, &queue_context );
+  return STATUS_SUCCESSFUL;
+}
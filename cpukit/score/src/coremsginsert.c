@@ -86,7 +86,7 @@ void _CORE_message_queue_Insert_message(
   ++the_message_queue->number_of_pending_messages;
 
   if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
-    _Chain_Append_unprotected( pending_messages, &the_message->Node );
+    _Chain_Append_unprotected( pending_messages, &the_message->Link.Node );
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   } else  if ( submit_type != CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
     int priority;
@@ -94,12 +94,12 @@ void _CORE_message_queue_Insert_message(
     priority = _CORE_message_queue_Get_message_priority( the_message );
     _Chain_Insert_ordered_unprotected(
       pending_messages,
-      &the_message->Node,
+      &the_message->Link.Node,
       &priority,
       _CORE_message_queue_Order
     );
 #endif
   } else {
-    _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
+    _Chain_Prepend_unprotected( pending_messages, &the_message->Link.Node );
   }
 }
@@ -0,0 +1,351 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of the lock-free ring
+ *   of single consumer message queues.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+/*
+ * The ring is a bounded queue in the style of D. Vyukov.  Each slot carries a
+ * sequence number.  A slot at position pos is free for the producer if its
+ * sequence number is pos, and it contains a message for the consumer if its
+ * sequence number is pos + 1.  The positions are free running counters which
+ * are reduced to a slot index by the ring mask.
+ */
+
+static CORE_message_queue_Buffer *_CORE_message_queue_Ring_slot(
+  const CORE_message_queue_Control *the_message_queue,
+  unsigned int                      pos
+)
+{
+  const CORE_message_queue_Ring *ring;
+
+  ring = &the_message_queue->Ring;
+  return (CORE_message_queue_Buffer *) (
+    (char *) the_message_queue->message_buffers
+      + (size_t) ( pos & ring->mask ) * ring->slot_size
+  );
+}
+
+static bool _CORE_message_queue_Ring_push(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *source,
+  size_t                      size
+)
+{
+  CORE_message_queue_Ring   *ring;
+  CORE_message_queue_Buffer *slot;
+  unsigned int               pos;
+
+  ring = &the_message_queue->Ring;
+  pos = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    unsigned int seq;
+    int          diff;
+
+    slot = _CORE_message_queue_Ring_slot( the_message_queue, pos );
+    seq = _Atomic_Load_uint( &slot->Link.sequence, ATOMIC_ORDER_ACQUIRE );
+    diff = (int) ( seq - pos );
+
+    if ( diff == 0 ) {
+      if ( ring->single_producer ) {
+        _Atomic_Store_uint( &ring->tail, pos + 1, ATOMIC_ORDER_RELAXED );
+        break;
+      }
+
+      if (
+        _Atomic_Compare_exchange_uint(
+          &ring->tail,
+          &pos,
+          pos + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( diff < 0 ) {
+      return false;
+    } else {
+      pos = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+    }
+  }
+
+  slot->size = size;
+  _CORE_message_queue_Copy_buffer( source, slot->buffer, size );
+  _Atomic_Store_uint( &slot->Link.sequence, pos + 1, ATOMIC_ORDER_RELEASE );
+  return true;
+}
+
+static bool _CORE_message_queue_Ring_pop(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *destination,
+  size_t                     *size_p
+)
+{
+  CORE_message_queue_Ring   *ring;
+  CORE_message_queue_Buffer *slot;
+  unsigned int               pos;
+  unsigned int               seq;
+
+  ring = &the_message_queue->Ring;
+  pos = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+  slot = _CORE_message_queue_Ring_slot( the_message_queue, pos );
+  seq = _Atomic_Load_uint( &slot->Link.sequence, ATOMIC_ORDER_ACQUIRE );
+
+  if ( seq != pos + 1 ) {
+    return false;
+  }
+
+  if ( destination != NULL ) {
+    *size_p = slot->size;
+    _CORE_message_queue_Copy_buffer( slot->buffer, destination, slot->size );
+  }
+
+  _Atomic_Store_uint(
+    &slot->Link.sequence,
+    pos + ring->mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+  _Atomic_Store_uint( &ring->head, pos + 1, ATOMIC_ORDER_RELAXED );
+  return true;
+}
+
+void _CORE_message_queue_Ring_initialize(
+  CORE_message_queue_Control *the_message_queue,
+  bool                        single_producer
+)
+{
+  CORE_message_queue_Ring *ring;
+  uint32_t                 i;
+
+  _Assert( the_message_queue->maximum_pending_messages != 0 );
+  _Assert(
+    ( the_message_queue->maximum_pending_messages
+      & ( the_message_queue->maximum_pending_messages - 1 ) ) == 0
+  );
+
+  ring = &the_message_queue->Ring;
+  ring->mask = the_message_queue->maximum_pending_messages - 1;
+  ring->slot_size = sizeof( CORE_message_queue_Buffer ) + RTEMS_ALIGN_UP(
+    the_message_queue->maximum_message_size,
+    sizeof( uintptr_t )
+  );
+  ring->single_producer = single_producer;
+  ring->enabled = true;
+  _Atomic_Init_uint( &ring->head, 0 );
+  _Atomic_Init_uint( &ring->tail, 0 );
+  _Atomic_Init_uint( &ring->receiver_waiting, 0 );
+
+  for ( i = 0; i <= ring->mask; ++i ) {
+    CORE_message_queue_Buffer *slot;
+
+    slot = _CORE_message_queue_Ring_slot( the_message_queue, i );
+    _Atomic_Init_uint( &slot->Link.sequence, i );
+  }
+
+  _Chain_Initialize_empty( &the_message_queue->Inactive_messages );
+}
+
+Status_Control _CORE_message_queue_Ring_submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Ring *ring;
+  Thread_queue_Heads      *heads;
+  Thread_Control          *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  if ( !_CORE_message_queue_Ring_push( the_message_queue, buffer, size ) ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_TOO_MANY;
+  }
+
+  /*
+   * Pairs with the fence in _CORE_message_queue_Ring_seize().  Either the
+   * consumer sees the message before it blocks, or we see that it may block.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+  ring = &the_message_queue->Ring;
+
+  if (
+    _Atomic_Load_uint( &ring->receiver_waiting, ATOMIC_ORDER_RELAXED ) == 0
+  ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Acquire_critical( the_message_queue, queue_context );
+
+  heads = the_message_queue->Wait_queue.Queue.heads;
+  if ( heads == NULL ) {
+    _Atomic_Store_uint( &ring->receiver_waiting, 0, ATOMIC_ORDER_RELAXED );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * The consumer is blocked, so we act as the consumer on its behalf while we
+   * own the thread queue lock.
+   */
+  the_thread = ( *the_message_queue->operations->first )( heads );
+  if (
+    !_CORE_message_queue_Ring_pop(
+      the_message_queue,
+      the_thread->Wait.return_argument_second.mutable_object,
+      the_thread->Wait.return_argument
+    )
+  ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  the_thread->Wait.count = (uint32_t) CORE_MESSAGE_QUEUE_SEND_REQUEST;
+  the_thread = ( *the_message_queue->operations->surrender )(
+    &the_message_queue->Wait_queue.Queue,
+    heads,
+    NULL,
+    queue_context
+  );
+  _Atomic_Store_uint( &ring->receiver_waiting, 0, ATOMIC_ORDER_RELAXED );
+  _Thread_queue_Resume(
+    &the_message_queue->Wait_queue.Queue,
+    the_thread,
+    queue_context
+  );
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Ring_seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Ring *ring;
+
+  if ( _CORE_message_queue_Ring_pop( the_message_queue, buffer, size_p ) ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  ring = &the_message_queue->Ring;
+  _CORE_message_queue_Acquire_critical( the_message_queue, queue_context );
+  _Atomic_Store_uint( &ring->receiver_waiting, 1, ATOMIC_ORDER_RELAXED );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _CORE_message_queue_Ring_pop( the_message_queue, buffer, size_p ) ) {
+    _Atomic_Store_uint( &ring->receiver_waiting, 0, ATOMIC_ORDER_RELAXED );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _Atomic_Store_uint( &ring->receiver_waiting, 0, ATOMIC_ORDER_RELAXED );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  /*
+   * If the wait times out, then the flag remains set until the next producer
+   * finds the thread queue empty.
+   */
+  executing->Wait.return_argument_second.mutable_object = buffer;
+  executing->Wait.return_argument = size_p;
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+uint32_t _CORE_message_queue_Ring_flush(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
+  uint32_t count;
+
+  count = 0;
+
+  while ( _CORE_message_queue_Ring_pop( the_message_queue, NULL, NULL ) ) {
+    ++count;
+  }
+
+  _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+  return count;
+}
+
+uint32_t _CORE_message_queue_Ring_get_number_pending(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  const CORE_message_queue_Ring *ring;
+  unsigned int                   head;
+  unsigned int                   tail;
+
+  ring = &the_message_queue->Ring;
+  head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+  tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+
+  if ( (int) ( tail - head ) < 0 ) {
+    return 0;
+  }
+
+  return tail - head;
+}
@@ -91,6 +91,14 @@ Status_Control _TOD_Set(
       );
     }
 
+    /* The expiration times of the realtime watchdogs changed in uptime */
+    if (
+      cpu->Watchdog.clock_update != NULL
+        && _Watchdog_Header_first( header ) != NULL
+    ) {
+      ( *cpu->Watchdog.clock_update )( cpu );
+    }
+
     _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context_2 );
   }
 
@@ -6,7 +6,8 @@
  * @ingroup RTEMSScoreFutex
  *
  * @brief This source file contains the implementation of
- *   _Futex_Wait() and _Futex_Wake().
+ *   _Futex_Wait(), _Futex_Wake(), _Futex_Queue_wait(), and
+ *   _Futex_Queue_store_and_wake().
  */
 
 /*
@@ -55,6 +56,7 @@
 
 #include <rtems/score/atomic.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/futeximpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -185,6 +187,37 @@ static Thread_Control *_Futex_Flush_filter(
   return the_thread;
 }
 
+static int _Futex_Wake_critical(
+  Thread_queue_Queue *queue,
+  int                 count,
+  ISR_Level           level,
+  Futex_Context      *context
+)
+{
+  /*
+   * For some synchronization objects like barriers the _Futex_Wake() must be
+   * called in the fast path.  Normally there are no threads on the queue, so
+   * check this condition early.
+   */
+  if ( RTEMS_PREDICT_TRUE( _Thread_queue_Is_empty( queue ) ) ) {
+    _Thread_queue_Queue_release_critical(
+      queue,
+      &context->Base.Lock_context.Lock_context
+    );
+    _ISR_Local_enable( level );
+    return 0;
+  }
+
+  context->count = count;
+  _Thread_queue_Context_set_ISR_level( &context->Base, level );
+  return (int) _Thread_queue_Flush_critical(
+    queue,
+    FUTEX_TQ_OPERATIONS,
+    _Futex_Flush_filter,
+    &context->Base
+  );
+}
+
 /**
  * @brief Performs the ``FUTEX_WAKE`` operation.
  *
@@ -204,23 +237,69 @@ int _Futex_Wake( struct _Futex_Control *_futex, int count )
   _Thread_queue_Context_initialize( &context.Base );
   _Thread_queue_Context_ISR_disable( &context.Base, level );
   _Futex_Queue_acquire_critical( futex, &context.Base );
+  return _Futex_Wake_critical( &futex->Queue.Queue, count, level, &context );
+}
 
-  /*
-   * For some synchronization objects like barriers the _Futex_Wake() must be
-   * called in the fast path.  Normally there are no threads on the queue, so
-   * check this condition early.
-   */
-  if ( RTEMS_PREDICT_TRUE( _Thread_queue_Is_empty( &futex->Queue.Queue ) ) ) {
-    _Futex_Queue_release( futex, level, &context.Base );
-    return 0;
+Status_Control _Futex_Queue_wait(
+  Thread_queue_Syslock_queue *queue,
+  const Atomic_Uint          *state,
+  unsigned int                val,
+  Thread_Control     * const *owner,
+  Thread_queue_Context       *queue_context
+)
+{
+  ISR_Level       level;
+  Thread_Control *executing;
+
+  _Thread_queue_Context_ISR_disable( queue_context, level );
+  executing = _Thread_Executing;
+  _Thread_queue_Queue_acquire_critical(
+    &queue->Queue,
+    &executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  if ( _Atomic_Load_uint( state, ATOMIC_ORDER_RELAXED ) != val ) {
+    _Thread_queue_Queue_release_critical(
+      &queue->Queue,
+      &queue_context->Lock_context.Lock_context
+    );
+    _ISR_Local_enable( level );
+    return STATUS_SUCCESSFUL;
   }
 
-  context.count = count;
-  _Thread_queue_Context_set_ISR_level( &context.Base, level );
-  return (int) _Thread_queue_Flush_critical(
-    &futex->Queue.Queue,
+  if ( owner != NULL ) {
+    queue->Queue.owner = *owner;
+  }
+
+  _Thread_queue_Context_set_ISR_level( queue_context, level );
+  _Thread_queue_Enqueue(
+    &queue->Queue,
     FUTEX_TQ_OPERATIONS,
-    _Futex_Flush_filter,
-    &context.Base
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+int _Futex_Queue_store_and_wake(
+  Thread_queue_Syslock_queue *queue,
+  Atomic_Uint                *state,
+  unsigned int                val,
+  int                         count
+)
+{
+  ISR_Level     level;
+  Futex_Context context;
+
+  _Thread_queue_Context_initialize( &context.Base );
+  _Thread_queue_Context_ISR_disable( &context.Base, level );
+  _Thread_queue_Queue_acquire_critical(
+    &queue->Queue,
+    &_Thread_Executing->Potpourri_stats,
+    &context.Base.Lock_context.Lock_context
   );
+  queue->Queue.owner = NULL;
+  _Atomic_Store_uint( state, val, ATOMIC_ORDER_RELEASE );
+  return _Futex_Wake_critical( &queue->Queue, count, level, &context );
 }
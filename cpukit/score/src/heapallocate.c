@@ -218,6 +218,132 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static uintptr_t _Heap_Search_free_list(
+  Heap_Control *heap,
+  Heap_Block **block_ptr,
+  const Heap_Block *end,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uint32_t *search_count
+)
+{
+  uintptr_t const block_size_floor = alloc_size + HEAP_BLOCK_HEADER_SIZE
+    - HEAP_ALLOC_BONUS;
+  Heap_Block *block = *block_ptr;
+  uintptr_t alloc_begin = 0;
+
+  while ( block != end ) {
+    _HAssert( _Heap_Is_prev_used( block ) );
+
+    _Heap_Protection_block_check( heap, block );
+
+    /*
+     * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+     * field.  Thus the value is about one unit larger than the real block
+     * size.  The greater than operator takes this into account.
+     */
+    if ( block->size_and_flag > block_size_floor ) {
+      if ( alignment == 0 ) {
+        alloc_begin = _Heap_Alloc_area_of_block( block );
+      } else {
+        alloc_begin = _Heap_Check_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary
+        );
+      }
+    }
+
+    /* Statistics */
+    ++*search_count;
+
+    if ( alloc_begin != 0 ) {
+      break;
+    }
+
+    block = block->next;
+  }
+
+  *block_ptr = block;
+
+  return alloc_begin;
+}
+
+static uintptr_t _Heap_Search_segregated_free_list(
+  Heap_Control *heap,
+  Heap_Block **block_ptr,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uint32_t *search_count
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  uintptr_t const block_size_floor = _Heap_Max(
+    alloc_size + HEAP_BLOCK_HEADER_SIZE - HEAP_ALLOC_BONUS,
+    heap->min_block_size
+  );
+  uintptr_t const floor_class = _Heap_Segregated_class( block_size_floor );
+  uintptr_t const fit_class = _Heap_Segregated_fit_class( block_size_floor );
+  uintptr_t first_class;
+  Heap_Block *first_fit_block;
+  uintptr_t alloc_begin;
+
+  /*
+   * All blocks of the first non-empty size class greater than or equal to the
+   * fit class are large enough.  Without alignment and boundary constraints,
+   * the first block of this size class is used.
+   */
+  first_class = _Heap_Segregated_find( index, fit_class );
+
+  if ( first_class < HEAP_SEGREGATED_CLASS_COUNT ) {
+    first_fit_block = index->first[ first_class ];
+  } else {
+    first_fit_block = free_list_tail;
+  }
+
+  *block_ptr = first_fit_block;
+  alloc_begin = _Heap_Search_free_list(
+    heap,
+    block_ptr,
+    free_list_tail,
+    alloc_size,
+    alignment,
+    boundary,
+    search_count
+  );
+
+  /*
+   * The blocks of the size class which contains the block size floor may be
+   * large enough.  Since the free list is ordered by size class and all size
+   * classes between the floor class and the first non-empty size class
+   * greater than or equal to the fit class are empty, the blocks of the floor
+   * class are in front of the first fit block.
+   */
+  if (
+    alloc_begin == 0
+      && floor_class != fit_class
+      && index->first[ floor_class ] != NULL
+  ) {
+    *block_ptr = index->first[ floor_class ];
+    alloc_begin = _Heap_Search_free_list(
+      heap,
+      block_ptr,
+      first_fit_block,
+      alloc_size,
+      alignment,
+      boundary,
+      search_count
+    );
+  }
+
+  return alloc_begin;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -247,44 +373,40 @@ void *_Heap_Allocate_aligned_with_boundary(
     if ( alignment == 0 ) {
       alignment = page_size;
     }
+  } else if (
+    heap->segregated != NULL
+      && alignment != 0
+      && _Heap_Is_aligned( page_size, alignment )
+  ) {
+    /*
+     * The allocation area of each block is page size aligned.  Use the
+     * allocation area begin of the first fitting block, so that the first
+     * block of a large enough size class is always suitable.
+     */
+    alignment = 0;
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
-
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
-
-      /* Statistics */
-      ++search_count;
-
-      if ( alloc_begin != 0 ) {
-        break;
-      }
-
-      block = block->next;
+    if ( heap->segregated == NULL ) {
+      block = _Heap_Free_list_first( heap );
+      alloc_begin = _Heap_Search_free_list(
+        heap,
+        &block,
+        _Heap_Free_list_tail( heap ),
+        alloc_size,
+        alignment,
+        boundary,
+        &search_count
+      );
+    } else {
+      alloc_begin = _Heap_Search_segregated_free_list(
+        heap,
+        &block,
+        alloc_size,
+        alignment,
+        boundary,
+        &search_count
+      );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -0,0 +1,237 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Enable_segregated_fit() and the segregated fit index support.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+RTEMS_STATIC_ASSERT(
+  sizeof( uintptr_t ) == sizeof( unsigned long ),
+  HEAP_SEGREGATED_CLZL
+);
+
+RTEMS_STATIC_ASSERT(
+  HEAP_SEGREGATED_SECOND_LEVEL_COUNT <= 8,
+  HEAP_SEGREGATED_SECOND_LEVEL_MAP
+);
+
+static void _Heap_Segregated_set_class_not_empty(
+  Heap_Segregated_index *index,
+  uintptr_t              size_class
+)
+{
+  uintptr_t first_level;
+  uintptr_t second_level;
+
+  first_level = size_class / HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  second_level = size_class % HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  index->second_level_map[ first_level ] |= (uint8_t) ( 1U << second_level );
+  index->first_level_map |= (uintptr_t) 1 << first_level;
+}
+
+static void _Heap_Segregated_set_class_empty(
+  Heap_Segregated_index *index,
+  uintptr_t              size_class
+)
+{
+  uintptr_t first_level;
+  uintptr_t second_level;
+
+  first_level = size_class / HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  second_level = size_class % HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  index->second_level_map[ first_level ] &= (uint8_t) ~( 1U << second_level );
+
+  if ( index->second_level_map[ first_level ] == 0 ) {
+    index->first_level_map &= ~( (uintptr_t) 1 << first_level );
+  }
+}
+
+uintptr_t _Heap_Segregated_find(
+  const Heap_Segregated_index *index,
+  uintptr_t                    size_class
+)
+{
+  uintptr_t first_level;
+  uintptr_t second_level;
+  unsigned int second_level_map;
+
+  if ( size_class >= HEAP_SEGREGATED_CLASS_COUNT ) {
+    return HEAP_SEGREGATED_CLASS_COUNT;
+  }
+
+  first_level = size_class / HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  second_level = size_class % HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+  second_level_map = index->second_level_map[ first_level ]
+    & ( ~0U << second_level );
+
+  if ( second_level_map == 0 ) {
+    uintptr_t first_level_map;
+
+    ++first_level;
+
+    if ( first_level >= HEAP_SEGREGATED_FIRST_LEVEL_COUNT ) {
+      return HEAP_SEGREGATED_CLASS_COUNT;
+    }
+
+    first_level_map = index->first_level_map
+      & ( ~(uintptr_t) 0 << first_level );
+
+    if ( first_level_map == 0 ) {
+      return HEAP_SEGREGATED_CLASS_COUNT;
+    }
+
+    first_level = (uintptr_t) __builtin_ctzl( first_level_map );
+    second_level_map = index->second_level_map[ first_level ];
+  }
+
+  second_level = (uintptr_t) __builtin_ctz( second_level_map );
+
+  return first_level * HEAP_SEGREGATED_SECOND_LEVEL_COUNT + second_level;
+}
+
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *index;
+  uintptr_t              size_class;
+  Heap_Block            *next;
+
+  index = heap->segregated;
+  size_class = _Heap_Segregated_class( _Heap_Block_size( block ) );
+  next = index->first[ size_class ];
+
+  if ( next == NULL ) {
+    uintptr_t next_class;
+
+    /*
+     * Keep the free list ordered by size class.  The new block is inserted in
+     * front of the first block of the next non-empty size class.
+     */
+    next_class = _Heap_Segregated_find( index, size_class + 1 );
+
+    if ( next_class < HEAP_SEGREGATED_CLASS_COUNT ) {
+      next = index->first[ next_class ];
+    } else {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    _Heap_Segregated_set_class_not_empty( index, size_class );
+  }
+
+  _Heap_Free_list_insert_before( next, block );
+  index->first[ size_class ] = block;
+}
+
+void _Heap_Segregated_extract( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *index;
+  uintptr_t              size_class;
+
+  index = heap->segregated;
+  size_class = _Heap_Segregated_class( _Heap_Block_size( block ) );
+
+  if ( index->first[ size_class ] == block ) {
+    Heap_Block *next;
+
+    next = block->next;
+
+    if (
+      next != _Heap_Free_list_tail( heap )
+        && _Heap_Segregated_class( _Heap_Block_size( next ) ) == size_class
+    ) {
+      index->first[ size_class ] = next;
+    } else {
+      index->first[ size_class ] = NULL;
+      _Heap_Segregated_set_class_empty( index, size_class );
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+void _Heap_Segregated_set_block_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+)
+{
+  if (
+    _Heap_Segregated_class( _Heap_Block_size( block ) )
+      == _Heap_Segregated_class( size )
+  ) {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  } else {
+    _Heap_Segregated_extract( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_insert( heap, block );
+  }
+}
+
+void _Heap_Enable_segregated_fit(
+  Heap_Control          *heap,
+  Heap_Segregated_index *index
+)
+{
+  Heap_Block *const free_list_head = _Heap_Free_list_head( heap );
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block       *block;
+
+  if ( heap->segregated != NULL ) {
+    return;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+
+  /*
+   * Detach the free blocks from the free list and insert them one by one, so
+   * that the free list is ordered by size class.
+   */
+  block = _Heap_Free_list_first( heap );
+  free_list_head->next = free_list_tail;
+  free_list_tail->prev = free_list_head;
+  heap->segregated = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *next;
+
+    next = block->next;
+    _Heap_Segregated_insert( heap, block );
+    block = next;
+  }
+}
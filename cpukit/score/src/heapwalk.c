@@ -139,6 +139,123 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  uintptr_t prev_class = HEAP_SEGREGATED_CLASS_COUNT;
+  uintptr_t size_class;
+  uintptr_t first_level;
+  uintptr_t class_count = 0;
+
+  if ( index == NULL ) {
+    return true;
+  }
+
+  while ( free_block != free_list_tail ) {
+    size_class = _Heap_Segregated_class( _Heap_Block_size( free_block ) );
+
+    if ( size_class != prev_class ) {
+      if (
+        prev_class != HEAP_SEGREGATED_CLASS_COUNT && size_class < prev_class
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: size class %u out of order\n",
+          free_block,
+          size_class
+        );
+
+        return false;
+      }
+
+      if ( index->first[ size_class ] != free_block ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not first block of size class %u\n",
+          free_block,
+          size_class
+        );
+
+        return false;
+      }
+
+      prev_class = size_class;
+      ++class_count;
+    }
+
+    free_block = free_block->next;
+  }
+
+  for (
+    first_level = 0;
+    first_level < HEAP_SEGREGATED_FIRST_LEVEL_COUNT;
+    ++first_level
+  ) {
+    uintptr_t const second_level_map = index->second_level_map[ first_level ];
+    bool const first_level_set =
+      ( index->first_level_map & ( (uintptr_t) 1 << first_level ) ) != 0;
+    uintptr_t second_level;
+
+    if ( first_level_set != ( second_level_map != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "first level map: invalid bit %u\n",
+        first_level
+      );
+
+      return false;
+    }
+
+    for (
+      second_level = 0;
+      second_level < HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+      ++second_level
+    ) {
+      bool const second_level_set =
+        ( second_level_map & ( 1U << second_level ) ) != 0;
+
+      size_class = first_level * HEAP_SEGREGATED_SECOND_LEVEL_COUNT
+        + second_level;
+
+      if ( second_level_set != ( index->first[ size_class ] != NULL ) ) {
+        (*printer)(
+          source,
+          true,
+          "second level map: invalid bit for size class %u\n",
+          size_class
+        );
+
+        return false;
+      }
+
+      if ( second_level_set ) {
+        --class_count;
+      }
+    }
+  }
+
+  if ( class_count != 0 ) {
+    (*printer)(
+      source,
+      true,
+      "segregated fit index: size class count mismatch\n"
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -256,7 +373,11 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  return _Heap_Walk_check_segregated_index( source, printer, heap );
 }
 
 static bool _Heap_Walk_check_free_block(
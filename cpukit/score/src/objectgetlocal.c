@@ -46,30 +46,10 @@ Objects_Control *_Objects_Get(
   const Objects_Information *information
 )
 {
-  Objects_Id delta;
-  Objects_Id maximum_id;
-  Objects_Id end;
-
-  maximum_id = information->maximum_id;
-  delta = maximum_id - id;
-  end = _Objects_Get_index( maximum_id );
-
-  if ( RTEMS_PREDICT_TRUE( delta < end ) ) {
-    ISR_Level        level;
-    Objects_Control *the_object;
-
-    _ISR_Local_disable( level );
-    _ISR_lock_Context_set_level( lock_context, level );
-
-    the_object =
-      information->local_table[ end - OBJECTS_INDEX_MINIMUM - delta ];
-    if ( RTEMS_PREDICT_TRUE( the_object != NULL ) ) {
-      /* ISR disabled on behalf of caller */
-      return the_object;
-    }
-
-    _ISR_Local_enable( level );
-  }
-
-  return NULL;
+  return _Objects_Get_from_table(
+    id,
+    lock_context,
+    information->maximum_id,
+    information->local_table
+  );
 }
@@ -42,21 +42,34 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/assert.h>
 
-#define _Per_CPU_Jobs_ISR_disable_and_acquire( cpu, lock_context ) \
-  _ISR_lock_ISR_disable_and_acquire( &( cpu )->Jobs.Lock, lock_context )
-
-#define _Per_CPU_Jobs_release_and_ISR_enable( cpu, lock_context ) \
-  _ISR_lock_Release_and_ISR_enable( &( cpu )->Jobs.Lock, lock_context )
-
 void _Per_CPU_Perform_jobs( Per_CPU_Control *cpu )
 {
-  ISR_lock_Context  lock_context;
-  Per_CPU_Job      *job;
+  Per_CPU_Job *job;
+  Per_CPU_Job *fifo;
+
+  /*
+   * Take all jobs submitted so far.  Jobs added afterwards, for example by the
+   * job handlers, are performed in the next call.
+   */
+  job = (Per_CPU_Job *) _Atomic_Exchange_uintptr(
+    &cpu->Jobs.head,
+    0,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  /* The list is in LIFO order, reverse it to perform the jobs in FIFO order */
+  fifo = NULL;
+
+  while ( job != NULL ) {
+    Per_CPU_Job *next;
 
-  _Per_CPU_Jobs_ISR_disable_and_acquire( cpu, &lock_context );
-  job = cpu->Jobs.head;
-  cpu->Jobs.head = NULL;
-  _Per_CPU_Jobs_release_and_ISR_enable( cpu, &lock_context );
+    next = job->next;
+    job->next = fifo;
+    fifo = job;
+    job = next;
+  }
+
+  job = fifo;
 
   while ( job != NULL ) {
     const Per_CPU_Job_context *context;
@@ -73,24 +86,27 @@ void _Per_CPU_Perform_jobs( Per_CPU_Control *cpu )
 
 void _Per_CPU_Add_job( Per_CPU_Control *cpu, Per_CPU_Job *job )
 {
-  ISR_lock_Context lock_context;
+  uintptr_t head;
 
   _Assert( job->context != NULL && job->context->handler != NULL );
 
-  _Atomic_Store_ulong( &job->done, 0, ATOMIC_ORDER_RELAXED );
-  _Assert( job->next == NULL );
-
-  _Per_CPU_Jobs_ISR_disable_and_acquire( cpu, &lock_context );
-
-  if ( cpu->Jobs.head == NULL ) {
-    cpu->Jobs.head = job;
-  } else {
-    *cpu->Jobs.tail = job;
-  }
-
-  cpu->Jobs.tail = &job->next;
-
-  _Per_CPU_Jobs_release_and_ISR_enable( cpu, &lock_context );
+  head = _Atomic_Load_uintptr( &cpu->Jobs.head, ATOMIC_ORDER_RELAXED );
+
+  /*
+   * The jobs are pushed to a lock-free LIFO list.  There is no ABA problem
+   * since the processor takes the complete list in _Per_CPU_Perform_jobs().
+   */
+  do {
+    job->next = (Per_CPU_Job *) head;
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      &cpu->Jobs.head,
+      &head,
+      (uintptr_t) job,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
 }
 
 void _Per_CPU_Submit_job( Per_CPU_Control *cpu, Per_CPU_Job *job )
@@ -0,0 +1,114 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief This source file contains the definition of ::_RCU_Generation and
+ *   the implementation of _RCU_Synchronize().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rcuimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/sysstate.h>
+
+Atomic_Ulong _RCU_Generation;
+
+static void _RCU_Request_quiescent_state( void *arg )
+{
+  (void) arg;
+
+  /*
+   * Carry out a thread dispatch on this processor as soon as thread
+   * dispatching is enabled, this reports a quiescent state.
+   */
+  _Per_CPU_Get()->dispatch_necessary = true;
+}
+
+static bool _RCU_Is_grace_period_over(
+  const Per_CPU_Control *cpu,
+  unsigned long          generation
+)
+{
+  unsigned long observed;
+
+  observed = _Atomic_Load_ulong( &cpu->RCU.generation, ATOMIC_ORDER_ACQUIRE );
+
+  return (long) ( observed - generation ) >= 0;
+}
+
+void _RCU_Synchronize( void )
+{
+  unsigned long    generation;
+  Per_CPU_Control *cpu_self;
+  uint32_t         cpu_max;
+  uint32_t         cpu_index;
+
+  /*
+   * Before multitasking is started, there are no read-side critical sections
+   * on other processors.
+   */
+  if ( !_System_state_Is_up( _System_state_Get() ) ) {
+    return;
+  }
+
+  _Assert( _Thread_Dispatch_is_enabled() );
+
+  generation = _Atomic_Fetch_add_ulong(
+    &_RCU_Generation,
+    1,
+    ATOMIC_ORDER_SEQ_CST
+  ) + 1;
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Broadcast_action( _RCU_Request_quiescent_state, NULL );
+  _Thread_Dispatch_enable( cpu_self );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( !_Per_CPU_Is_processor_online( cpu ) ) {
+      continue;
+    }
+
+    while ( !_RCU_Is_grace_period_over( cpu, generation ) ) {
+      /* Wait for the next quiescent state of the processor */
+    }
+  }
+}
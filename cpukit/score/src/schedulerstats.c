@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerStatistics
+ *
+ * @brief This source file contains the implementation of
+ *   _Scheduler_Statistics_Do_thread_switch().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerimpl.h>
+
+#if defined(RTEMS_SCHEDULER_STATISTICS)
+void _Scheduler_Statistics_Do_thread_switch(
+  const Per_CPU_Control *cpu_self,
+  Thread_Control        *executing,
+  Thread_Control        *heir
+)
+{
+  const Scheduler_Control *scheduler;
+  Scheduler_Statistics    *statistics;
+  bool                     wake_up_pending;
+
+  /*
+   * A wake-up of a thread which is still executing needs no thread switch to
+   * the thread.  Discard it, so that it is not accounted at the next switch.
+   */
+  executing->Scheduler.wake_up_pending = false;
+
+  wake_up_pending = heir->Scheduler.wake_up_pending;
+  heir->Scheduler.wake_up_pending = false;
+
+  scheduler = _Scheduler_Get_by_CPU( cpu_self );
+
+  if ( scheduler == NULL ) {
+    return;
+  }
+
+  statistics = _Scheduler_Statistics_Get( scheduler );
+  _Scheduler_Statistics_Increment( &statistics->switches );
+
+  if ( _States_Is_ready( executing->current_state ) ) {
+    _Scheduler_Statistics_Increment( &statistics->preemptions );
+  }
+
+  if ( wake_up_pending ) {
+    CPU_Counter_ticks latency;
+    Priority_Control  priority;
+    unsigned int      bucket;
+
+    latency = _CPU_Counter_read() - heir->Scheduler.wake_up_instant;
+    bucket = 31U - (unsigned int) __builtin_clz( (unsigned int) latency | 1U );
+    priority = _Scheduler_Unmap_priority(
+      scheduler,
+      _Thread_Get_priority( heir )
+    );
+
+    if ( priority >= SCHEDULER_STATISTICS_PRIORITY_COUNT ) {
+      priority = SCHEDULER_STATISTICS_PRIORITY_COUNT - 1;
+    }
+
+    _Scheduler_Statistics_Increment(
+      &statistics->latencies[ priority ][ bucket ]
+    );
+  }
+}
+#endif
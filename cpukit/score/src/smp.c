@@ -153,7 +153,6 @@ void _SMP_Handler_initialize( void )
 
     cpu = _Per_CPU_Get_by_index( cpu_index );
     _ISR_lock_Set_name( &cpu->Lock, "Per-CPU" );
-    _ISR_lock_Set_name( &cpu->Jobs.Lock, "Per-CPU Jobs" );
     _ISR_lock_Set_name( &cpu->Watchdog.Lock, "Per-CPU Watchdog" );
     _Chain_Initialize_empty( &cpu->Threads_in_need_for_help );
   }
@@ -351,11 +350,24 @@ void _SMP_Try_to_process_message(
 
 void _SMP_Send_message( Per_CPU_Control *cpu, unsigned long message )
 {
-  (void) _Atomic_Fetch_or_ulong(
+  unsigned long previous;
+
+  previous = _Atomic_Fetch_or_ulong(
     &cpu->message, message,
     ATOMIC_ORDER_RELEASE
   );
 
+  /*
+   * If the message is already pending, then the processor was already
+   * notified and did not fetch its messages yet.  It will fetch the message
+   * with an acquire exchange, so all changes made before this function call
+   * are visible to it.  This coalesces the inter-processor interrupts of
+   * concurrent senders.
+   */
+  if ( ( previous & message ) == message ) {
+    return;
+  }
+
   if ( _Per_CPU_Get_state( cpu ) == PER_CPU_STATE_UP ) {
     _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu ) );
   }
@@ -8,14 +8,14 @@
  * @brief This source file contains the definition of ::_Thread_Allocated_fp
  *   and ::_User_extensions_Switches_list and the implementation of
  *   _Thread_Dispatch_direct(), _Thread_Dispatch_enable(),
- *   and _Thread_Do_dispatch().
+ *   _Thread_Dispatch_request_batch_end(), and _Thread_Do_dispatch().
  */
 
 /*
  *  COPYRIGHT (c) 1989-2009.
  *  On-Line Applications Research Corporation (OAR).
  *
- *  Copyright (C) 2014, 2018 embedded brains GmbH & Co. KG
+ *  Copyright (C) 2014, 2026 embedded brains GmbH & Co. KG
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -46,6 +46,7 @@
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/isr.h>
+#include <rtems/score/rcuimpl.h>
 #include <rtems/score/schedulerimpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
@@ -151,6 +152,7 @@ static void _Thread_Ask_for_help( Thread_Control *the_thread )
     scheduler = _Scheduler_Node_get_scheduler( scheduler_node );
 
     _Scheduler_Acquire_critical( scheduler, &lock_context );
+    _Scheduler_Statistics_Ask_for_help( scheduler );
     success = ( *scheduler->Operations.ask_for_help )(
       scheduler,
       the_thread,
@@ -314,12 +316,25 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
      *  context switch.
      */
 
+    if ( RTEMS_PREDICT_FALSE( cpu_self->Watchdog.tickless_exit != NULL ) ) {
+      ISR_lock_Context lock_context;
+
+      /*
+       * The idle thread is about to be replaced, so bring the watchdog ticks
+       * up to date and resume the clock tick interrupt.
+       */
+      _Watchdog_Per_CPU_acquire_critical( cpu_self, &lock_context );
+      _Watchdog_Per_CPU_release_critical( cpu_self, &lock_context );
+    }
+
     cpu_budget_operations = heir->CPU_budget.operations;
 
     if ( cpu_budget_operations != NULL ) {
       ( *cpu_budget_operations->at_context_switch )( heir );
     }
 
+    _Scheduler_Statistics_Thread_switch( cpu_self, executing, heir );
+
     _ISR_Local_enable( level );
 
 #if !defined(RTEMS_SMP)
@@ -348,6 +363,9 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
    */
 
   _Assert( cpu_self->thread_dispatch_disable_level == 1 );
+#if defined(RTEMS_SMP)
+  _RCU_Report_quiescent_state( cpu_self );
+#endif
   cpu_self->thread_dispatch_disable_level = 0;
   _Profiling_Thread_dispatch_enable( cpu_self, 0 );
 
@@ -397,3 +415,38 @@ void _Thread_Dispatch_enable( Per_CPU_Control *cpu_self )
     cpu_self->thread_dispatch_disable_level = disable_level - 1;
   }
 }
+
+#if defined(RTEMS_SMP)
+void _Thread_Dispatch_request_batch_end( Per_CPU_Control *cpu_self )
+{
+  ISR_Level      level;
+  Processor_mask targets;
+  uint32_t       cpu_max;
+  uint32_t       cpu_index;
+
+  _Assert( cpu_self->Dispatch_requests.nest_level > 0 );
+
+  _ISR_Local_disable( level );
+
+  if ( --cpu_self->Dispatch_requests.nest_level != 0 ) {
+    _ISR_Local_enable( level );
+    return;
+  }
+
+  _Processor_mask_Assign( &targets, &cpu_self->Dispatch_requests.targets );
+  _Processor_mask_Zero( &cpu_self->Dispatch_requests.targets );
+  _ISR_Local_enable( level );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &targets, cpu_index ) ) {
+      Per_CPU_Control *cpu;
+
+      cpu = _Per_CPU_Get_by_index( cpu_index );
+      _Atomic_Fetch_or_ulong( &cpu->message, 0, ATOMIC_ORDER_RELEASE );
+      _CPU_SMP_Send_interrupt( cpu_index );
+    }
+  }
+}
+#endif
@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadPool
+ *
+ * @brief This source file contains the implementation of the
+ *   @ref RTEMSScoreThreadPool.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadpoolimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+void _Thread_pool_Initialize( Thread_pool_Control *pool, const char *name )
+{
+  _Thread_queue_Initialize( &pool->Queue, name );
+  _Chain_Initialize_empty( &pool->Pending );
+  pool->worker_count = 0;
+  pool->terminate = false;
+}
+
+void _Thread_pool_Add_worker( Thread_pool_Control *pool )
+{
+  Thread_queue_Context queue_context;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &pool->Queue, &queue_context );
+  ++pool->worker_count;
+  _Thread_queue_Release( &pool->Queue, &queue_context );
+}
+
+static void _Thread_pool_Wake_up_first(
+  Thread_pool_Control  *pool,
+  Thread_queue_Heads   *heads,
+  Thread_pool_Work     *work,
+  Thread_queue_Context *queue_context
+)
+{
+  const Thread_queue_Operations *operations;
+  Thread_Control                *the_thread;
+
+  operations = THREAD_POOL_TQ_OPERATIONS;
+  the_thread = ( *operations->surrender )(
+    &pool->Queue.Queue,
+    heads,
+    NULL,
+    queue_context
+  );
+  the_thread->Wait.return_argument = work;
+  _Thread_queue_Resume( &pool->Queue.Queue, the_thread, queue_context );
+}
+
+bool _Thread_pool_Submit( Thread_pool_Control *pool, Thread_pool_Work *work )
+{
+  Thread_queue_Context  queue_context;
+  Thread_queue_Heads   *heads;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &pool->Queue, &queue_context );
+
+  if ( pool->terminate ) {
+    _Thread_queue_Release( &pool->Queue, &queue_context );
+    return false;
+  }
+
+  heads = pool->Queue.Queue.heads;
+
+  if ( heads == NULL ) {
+    _Chain_Append_unprotected( &pool->Pending, &work->Node );
+    _Thread_queue_Release( &pool->Queue, &queue_context );
+    return true;
+  }
+
+  /*
+   * There are no pending work items if a worker is idle, so hand over the
+   * work item directly to the first idle worker.
+   */
+  _Assert( _Chain_Is_empty( &pool->Pending ) );
+  _Thread_pool_Wake_up_first( pool, heads, work, &queue_context );
+  return true;
+}
+
+Thread_pool_Work *_Thread_pool_Get_work(
+  Thread_pool_Control *pool,
+  Thread_Control      *executing
+)
+{
+  while ( true ) {
+    Thread_queue_Context  queue_context;
+    Thread_pool_Work     *work;
+
+    _Thread_queue_Context_initialize( &queue_context );
+    _Thread_queue_Acquire( &pool->Queue, &queue_context );
+
+    work = (Thread_pool_Work *) _Chain_Get_unprotected( &pool->Pending );
+
+    if ( work != NULL ) {
+      _Thread_queue_Release( &pool->Queue, &queue_context );
+      return work;
+    }
+
+    if ( pool->terminate ) {
+      Thread_queue_Heads *heads;
+
+      _Assert( pool->worker_count > 0 );
+      --pool->worker_count;
+      heads = pool->Queue.Queue.heads;
+
+      if ( pool->worker_count == 0 && heads != NULL ) {
+        /* Wake up the thread waiting in _Thread_pool_Terminate() */
+        _Thread_pool_Wake_up_first( pool, heads, NULL, &queue_context );
+      } else {
+        _Thread_queue_Release( &pool->Queue, &queue_context );
+      }
+
+      return NULL;
+    }
+
+    executing->Wait.return_argument = NULL;
+    _Thread_queue_Context_set_thread_state(
+      &queue_context,
+      STATES_WAITING_FOR_WORK
+    );
+    _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+    _Thread_queue_Enqueue(
+      &pool->Queue.Queue,
+      THREAD_POOL_TQ_OPERATIONS,
+      executing,
+      &queue_context
+    );
+
+    /*
+     * A worker woken up by _Thread_pool_Terminate() has no work item and
+     * checks the pending work items again.
+     */
+    work = executing->Wait.return_argument;
+
+    if ( work != NULL ) {
+      return work;
+    }
+  }
+}
+
+void _Thread_pool_Terminate(
+  Thread_pool_Control *pool,
+  Thread_Control      *executing
+)
+{
+  Thread_queue_Context queue_context;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &pool->Queue, &queue_context );
+  pool->terminate = true;
+  _Thread_queue_Flush_critical(
+    &pool->Queue.Queue,
+    THREAD_POOL_TQ_OPERATIONS,
+    _Thread_queue_Flush_default_filter,
+    &queue_context
+  );
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &pool->Queue, &queue_context );
+
+  if ( pool->worker_count == 0 ) {
+    _Thread_queue_Release( &pool->Queue, &queue_context );
+    return;
+  }
+
+  _Thread_queue_Context_set_thread_state(
+    &queue_context,
+    STATES_WAITING_FOR_JOIN
+  );
+  _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  _Thread_queue_Enqueue(
+    &pool->Queue.Queue,
+    THREAD_POOL_TQ_OPERATIONS,
+    executing,
+    &queue_context
+  );
+}
@@ -152,6 +152,12 @@ size_t _Thread_queue_Flush_critical(
     cpu_self = _Thread_queue_Dispatch_disable( queue_context );
     _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
 
+    /*
+     * Send at most one inter-processor interrupt to each processor which gets
+     * a new heir through the unblocked threads.
+     */
+    _Thread_Dispatch_request_batch_begin( cpu_self );
+
     do {
       Scheduler_Node *scheduler_node;
       Thread_Control *the_thread;
@@ -176,6 +182,7 @@ size_t _Thread_queue_Flush_critical(
       _Thread_State_release( owner, &lock_context );
     }
 
+    _Thread_Dispatch_request_batch_end( cpu_self );
     _Thread_Dispatch_enable( cpu_self );
   } else {
     _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
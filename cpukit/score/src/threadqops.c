@@ -7,12 +7,13 @@
  *
  * @brief This source file contains the definition of
  *   ::_Thread_queue_Operations_default, ::_Thread_queue_Operations_FIFO,
- *   ::_Thread_queue_Operations_priority, and
- *   ::_Thread_queue_Operations_priority_inherit.
+ *   ::_Thread_queue_Operations_priority,
+ *   ::_Thread_queue_Operations_priority_inherit, and
+ *   ::_Thread_queue_Operations_priority_bit_map.
  */
 
 /*
- * Copyright (C) 2015, 2021 embedded brains GmbH & Co. KG
+ * Copyright (C) 2015, 2026 embedded brains GmbH & Co. KG
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -44,6 +45,7 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/rbtreeimpl.h>
 #include <rtems/score/schedulerimpl.h>
 
@@ -1497,6 +1499,291 @@ static Thread_Control *_Thread_queue_Priority_inherit_surrender(
   return first;
 }
 
+void _Thread_queue_Priority_bit_map_initialize(
+  Thread_queue_Priority_bit_map *priority_bit_map
+)
+{
+  size_t i;
+
+  _Priority_bit_map_Initialize( &priority_bit_map->Bit_map );
+
+  for ( i = 0; i < THREAD_QUEUE_PRIORITY_BIT_MAP_BUCKET_COUNT; ++i ) {
+    _Chain_Initialize_empty( &priority_bit_map->Buckets[ i ] );
+  }
+}
+
+static void _Thread_queue_Priority_bit_map_insert(
+  Thread_queue_Priority_bit_map *priority_bit_map,
+  Scheduler_Node                *scheduler_node
+)
+{
+  Priority_Control  priority;
+  unsigned int      index;
+  Chain_Control    *bucket;
+  Chain_Node       *node;
+
+  priority = SCHEDULER_PRIORITY_UNMAP(
+    _Priority_Get_priority( &scheduler_node->Wait.Priority )
+  );
+
+  if ( priority < THREAD_QUEUE_PRIORITY_BIT_MAP_BUCKET_COUNT ) {
+    index = (unsigned int) priority;
+  } else {
+    index = THREAD_QUEUE_PRIORITY_BIT_MAP_BUCKET_COUNT - 1;
+  }
+
+  bucket = &priority_bit_map->Buckets[ index ];
+
+  if ( _Chain_Is_empty( bucket ) ) {
+    Priority_bit_map_Information bit_map_info;
+
+    _Priority_bit_map_Initialize_information(
+      &priority_bit_map->Bit_map,
+      &bit_map_info,
+      index
+    );
+    _Priority_bit_map_Add( &priority_bit_map->Bit_map, &bit_map_info );
+  }
+
+  node = &scheduler_node->Wait.Priority.Node.Node.Chain;
+  _Chain_Initialize_node( node );
+  _Chain_Append_unprotected( bucket, node );
+}
+
+static void _Thread_queue_Priority_bit_map_remove(
+  Thread_queue_Priority_bit_map *priority_bit_map,
+  Scheduler_Node                *scheduler_node
+)
+{
+  Chain_Node *node;
+  Chain_Node *previous;
+  uintptr_t   offset;
+
+  node = &scheduler_node->Wait.Priority.Node.Node.Chain;
+  previous = _Chain_Previous( node );
+  _Chain_Extract_unprotected( node );
+
+  /*
+   * The bucket of the node is not recorded, since the priority of the thread
+   * may have changed in the meantime.  If the previous node is the head of a
+   * bucket, then the node may have been the last node of this bucket.
+   */
+  offset = (uintptr_t) previous - (uintptr_t) &priority_bit_map->Buckets[ 0 ];
+
+  if ( offset < sizeof( priority_bit_map->Buckets ) ) {
+    unsigned int index;
+
+    index = (unsigned int) ( offset / sizeof( Chain_Control ) );
+
+    if ( _Chain_Is_empty( &priority_bit_map->Buckets[ index ] ) ) {
+      Priority_bit_map_Information bit_map_info;
+
+      _Priority_bit_map_Initialize_information(
+        &priority_bit_map->Bit_map,
+        &bit_map_info,
+        index
+      );
+      _Priority_bit_map_Remove( &priority_bit_map->Bit_map, &bit_map_info );
+    }
+  }
+}
+
+static void _Thread_queue_Priority_bit_map_priority_actions(
+  Thread_queue_Queue *queue,
+  Priority_Actions   *priority_actions
+)
+{
+  Thread_queue_Heads            *heads;
+  Thread_queue_Priority_bit_map *priority_bit_map;
+  Priority_Aggregation          *priority_aggregation;
+
+  heads = queue->heads;
+  _Assert( heads != NULL );
+  priority_bit_map = heads->Heads.Priority_bit_map;
+
+  _Assert( !_Priority_Actions_is_empty( priority_actions ) );
+  priority_aggregation = _Priority_Actions_move( priority_actions );
+
+  do {
+#if defined(RTEMS_SMP)
+    Priority_Aggregation *next_aggregation;
+#endif
+    Scheduler_Node       *scheduler_node;
+    Thread_Control       *the_thread;
+    Priority_Action_type  priority_action_type;
+
+#if defined(RTEMS_SMP)
+    next_aggregation = _Priority_Get_next_action( priority_aggregation );
+#endif
+
+    scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY( priority_aggregation );
+    the_thread = _Scheduler_Node_get_owner( scheduler_node );
+    priority_action_type = priority_aggregation->Action.type;
+
+    switch ( priority_action_type ) {
+#if defined(RTEMS_SMP)
+      case PRIORITY_ACTION_ADD:
+      case PRIORITY_ACTION_REMOVE:
+        /* Only the home scheduler node is in the priority bit map */
+        break;
+#endif
+      default:
+        /*
+         * The action type is only maintained in SMP or debug configurations,
+         * so all other actions are changes.  Only the priority of the home
+         * scheduler node is used for the ordering.  A changed priority moves
+         * the thread to the end of its new bucket.
+         */
+        if ( scheduler_node == _Thread_Scheduler_get_home_node( the_thread ) ) {
+          _Thread_queue_Priority_bit_map_remove(
+            priority_bit_map,
+            scheduler_node
+          );
+          _Thread_queue_Priority_bit_map_insert(
+            priority_bit_map,
+            scheduler_node
+          );
+        }
+        break;
+    }
+
+#if defined(RTEMS_SMP)
+    priority_aggregation = next_aggregation;
+  } while ( priority_aggregation != NULL );
+#else
+  } while ( false );
+#endif
+}
+
+static void _Thread_queue_Priority_bit_map_do_initialize(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context,
+  Thread_queue_Heads   *heads
+)
+{
+  Thread_queue_Priority_bit_map *priority_bit_map;
+
+  (void) queue;
+
+  priority_bit_map = queue_context->priority_bit_map;
+  _Assert( priority_bit_map != NULL );
+  _Assert( _Priority_bit_map_Is_empty( &priority_bit_map->Bit_map ) );
+  heads->Heads.Priority_bit_map = priority_bit_map;
+
+  _Thread_queue_Priority_bit_map_insert(
+    priority_bit_map,
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+static void _Thread_queue_Priority_bit_map_do_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context,
+  Thread_queue_Heads   *heads
+)
+{
+  (void) queue;
+  _Assert( queue_context->priority_bit_map == heads->Heads.Priority_bit_map );
+
+  _Thread_queue_Priority_bit_map_insert(
+    heads->Heads.Priority_bit_map,
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+static void _Thread_queue_Priority_bit_map_do_extract(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *current_or_previous_owner,
+  Thread_queue_Context *queue_context,
+  Thread_Control       *the_thread
+)
+{
+  (void) queue;
+  (void) current_or_previous_owner;
+  (void) queue_context;
+
+  _Thread_queue_Priority_bit_map_remove(
+    heads->Heads.Priority_bit_map,
+    _Thread_Scheduler_get_home_node( the_thread )
+  );
+}
+
+static void _Thread_queue_Priority_bit_map_enqueue(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Queue_enqueue(
+    queue,
+    the_thread,
+    queue_context,
+    _Thread_queue_Priority_bit_map_do_initialize,
+    _Thread_queue_Priority_bit_map_do_enqueue
+  );
+}
+
+static void _Thread_queue_Priority_bit_map_extract(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *the_thread,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Queue_extract(
+    queue,
+    queue->heads,
+    NULL,
+    queue_context,
+    the_thread,
+    _Thread_queue_Priority_bit_map_do_extract
+  );
+}
+
+static Thread_Control *_Thread_queue_Priority_bit_map_first(
+  const Thread_queue_Heads *heads
+)
+{
+  const Thread_queue_Priority_bit_map *priority_bit_map;
+  unsigned int                         index;
+  const Chain_Node                    *first;
+  const Scheduler_Node                *scheduler_node;
+
+  priority_bit_map = heads->Heads.Priority_bit_map;
+  _Assert( !_Priority_bit_map_Is_empty( &priority_bit_map->Bit_map ) );
+  index = _Priority_bit_map_Get_highest( &priority_bit_map->Bit_map );
+  first = _Chain_Immutable_first( &priority_bit_map->Buckets[ index ] );
+  scheduler_node = SCHEDULER_NODE_OF_WAIT_PRIORITY_NODE( first );
+
+  return _Scheduler_Node_get_owner( scheduler_node );
+}
+
+static Thread_Control *_Thread_queue_Priority_bit_map_surrender(
+  Thread_queue_Queue   *queue,
+  Thread_queue_Heads   *heads,
+  Thread_Control       *previous_owner,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *first;
+
+  (void) previous_owner;
+
+  first = _Thread_queue_Priority_bit_map_first( heads );
+  _Thread_queue_Queue_extract(
+    queue,
+    heads,
+    NULL,
+    queue_context,
+    first,
+    _Thread_queue_Priority_bit_map_do_extract
+  );
+
+  return first;
+}
+
 const Thread_queue_Operations _Thread_queue_Operations_default = {
   .priority_actions = _Thread_queue_Do_nothing_priority_actions
   /*
@@ -1529,3 +1816,11 @@ const Thread_queue_Operations _Thread_queue_Operations_priority_inherit = {
   .surrender = _Thread_queue_Priority_inherit_surrender,
   .first = _Thread_queue_Priority_first
 };
+
+const Thread_queue_Operations _Thread_queue_Operations_priority_bit_map = {
+  .priority_actions = _Thread_queue_Priority_bit_map_priority_actions,
+  .enqueue = _Thread_queue_Priority_bit_map_enqueue,
+  .extract = _Thread_queue_Priority_bit_map_extract,
+  .surrender = _Thread_queue_Priority_bit_map_surrender,
+  .first = _Thread_queue_Priority_bit_map_first
+};
@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _Thread_queue_Spin_for_owner().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/threadimpl.h>
+
+bool _Thread_queue_Spin_for_owner(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *owner,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+)
+{
+  CPU_Counter_ticks budget;
+  CPU_Counter_ticks start;
+
+  budget = (CPU_Counter_ticks) (
+    ( (uint64_t) _Thread_queue_Adaptive_spin_time * _CPU_Counter_frequency() )
+      / 1000000000
+  );
+
+  if ( budget == 0 || executing == owner ) {
+    return false;
+  }
+
+  _Thread_queue_Queue_release(
+    queue,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  start = _CPU_Counter_read();
+
+  /*
+   * The owner may terminate concurrently.  Its thread control block is then
+   * returned to the inactive objects of its object information and remains
+   * readable.  A terminated owner releases all its resources, so the owner of
+   * the thread queue changes and the spinning stops.
+   */
+  while (
+    queue->owner == owner
+      && _Thread_Is_executing_on_a_processor( owner )
+      && _CPU_Counter_read() - start < budget
+  ) {
+    RTEMS_COMPILER_MEMORY_BARRIER();
+  }
+
+  _ISR_lock_ISR_disable( &queue_context->Lock_context.Lock_context );
+  _Thread_queue_Queue_acquire_critical(
+    queue,
+    &executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  return queue->owner == NULL;
+}
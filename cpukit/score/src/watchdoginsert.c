@@ -53,6 +53,11 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -78,4 +83,23 @@ void _Watchdog_Insert(
   _RBTree_Initialize_node( &the_watchdog->Node.RBTree );
   _RBTree_Add_child( &the_watchdog->Node.RBTree, parent, link );
   _RBTree_Insert_color( &header->Watchdogs, &the_watchdog->Node.RBTree );
+
+  if ( new_first != old_first ) {
+    Per_CPU_Control *cpu;
+    void          ( *clock_update )( Per_CPU_Control * );
+
+    /*
+     * In high resolution mode, the clock interrupt may have to be programmed
+     * for the new first watchdog of a clock header.
+     */
+    cpu = _Watchdog_Get_CPU( the_watchdog );
+    clock_update = cpu->Watchdog.clock_update;
+
+    if (
+      RTEMS_PREDICT_FALSE( clock_update != NULL )
+        && header != &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+    ) {
+      ( *clock_update )( cpu );
+    }
+  }
 }
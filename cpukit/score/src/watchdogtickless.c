@@ -0,0 +1,188 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Ticks_until_next_expiry() and _Watchdog_Skip_ticks().
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/timecounter.h>
+
+static uint64_t _Watchdog_Ticks_until_timespec(
+  const Watchdog_Header *header,
+  const struct timespec *now,
+  uint64_t               maximum
+)
+{
+  const Watchdog_Control *first;
+  struct timespec         expire;
+  int64_t                 seconds;
+  int64_t                 nanoseconds;
+  uint64_t                ticks;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return maximum;
+  }
+
+  _Watchdog_Ticks_to_timespec( first->expire, &expire );
+  seconds = (int64_t) expire.tv_sec - (int64_t) now->tv_sec;
+
+  if ( seconds > (int64_t) ( maximum / _Watchdog_Ticks_per_second ) ) {
+    return maximum;
+  }
+
+  nanoseconds = seconds * 1000000000 + expire.tv_nsec - now->tv_nsec;
+
+  if ( nanoseconds <= 0 ) {
+    return 1;
+  }
+
+  /*
+   * The watchdogs of this header are serviced by the first clock tick at or
+   * after the expiration time.
+   */
+  ticks = ( (uint64_t) nanoseconds + _Watchdog_Nanoseconds_per_tick - 1 )
+    / _Watchdog_Nanoseconds_per_tick;
+
+  if ( ticks > maximum ) {
+    return maximum;
+  }
+
+  return ticks;
+}
+
+static uint64_t _Watchdog_Ticks_until_tick(
+  const Per_CPU_Control *cpu,
+  const Watchdog_Header *header,
+  uint64_t               maximum
+)
+{
+  uint64_t expire;
+
+  if ( header->wheel != NULL ) {
+    expire = _Watchdog_Wheel_next_expiry( header->wheel );
+  } else {
+    const Watchdog_Control *first;
+
+    first = _Watchdog_Header_first( header );
+
+    if ( first == NULL ) {
+      return maximum;
+    }
+
+    expire = first->expire;
+  }
+
+  if ( expire <= cpu->Watchdog.ticks ) {
+    return 1;
+  }
+
+  expire -= cpu->Watchdog.ticks;
+
+  if ( expire > maximum ) {
+    return maximum;
+  }
+
+  return expire;
+}
+
+uint64_t _Watchdog_Ticks_until_next_expiry(
+  Per_CPU_Control *cpu,
+  uint64_t         maximum
+)
+{
+  uint64_t        ticks;
+  struct timespec now;
+
+  _Assert( maximum > 0 );
+
+  ticks = _Watchdog_Ticks_until_tick(
+    cpu,
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+    maximum
+  );
+
+  /*
+   * In high resolution mode, the Clock Driver programs its interrupt for the
+   * monotonic and realtime watchdogs independent of the clock ticks.
+   */
+  if ( _Watchdog_High_resolution_timers ) {
+    return ticks;
+  }
+
+  if ( !_Watchdog_Header_is_empty(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  ) ) {
+    _Timecounter_Getnanouptime( &now );
+    ticks = _Watchdog_Ticks_until_timespec(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+      &now,
+      ticks
+    );
+  }
+
+  if ( !_Watchdog_Header_is_empty(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  ) ) {
+    _Timecounter_Getnanotime( &now );
+    ticks = _Watchdog_Ticks_until_timespec(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ],
+      &now,
+      ticks
+    );
+  }
+
+  return ticks;
+}
+
+void _Watchdog_Skip_ticks( Per_CPU_Control *cpu, uint64_t ticks )
+{
+#ifdef RTEMS_SMP
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+#endif
+    _Watchdog_Ticks_since_boot += (Watchdog_Interval) ticks;
+#ifdef RTEMS_SMP
+  }
+#endif
+
+  /*
+   * The timing wheel catches up with the skipped ticks in the next
+   * _Watchdog_Tick().
+   */
+  cpu->Watchdog.ticks += ticks;
+}
@@ -0,0 +1,373 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of the watchdog
+ *   timing wheel.
+ */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/smpimpl.h>
+
+#define WATCHDOG_WHEEL_LEVEL_MASK ( WATCHDOG_WHEEL_LEVEL_SIZE - 1 )
+
+#define WATCHDOG_WHEEL_RANGE \
+  ( (uint64_t) 1 << ( WATCHDOG_WHEEL_LEVEL_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) )
+
+static void _Watchdog_Wheel_splice( Chain_Control *to, Chain_Control *from )
+{
+  Chain_Node *first;
+  Chain_Node *last;
+  Chain_Node *tail;
+  Chain_Node *old_last;
+
+  if ( _Chain_Is_empty( from ) ) {
+    return;
+  }
+
+  first = _Chain_First( from );
+  last = _Chain_Last( from );
+  tail = _Chain_Tail( to );
+  old_last = _Chain_Last( to );
+
+  old_last->next = first;
+  first->previous = old_last;
+  last->next = tail;
+  tail->previous = last;
+
+  _Chain_Initialize_empty( from );
+}
+
+static void _Watchdog_Wheel_place(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  uint64_t      expire;
+  uint64_t      index;
+  Chain_Control *slot;
+
+  expire = the_watchdog->expire;
+
+  if ( expire <= wheel->now ) {
+    slot = &wheel->Expired;
+  } else {
+    int level;
+
+    /* Index relative to the next tick to process */
+    index = expire - wheel->now - 1;
+
+    if ( index >= WATCHDOG_WHEEL_RANGE ) {
+      expire = wheel->now + WATCHDOG_WHEEL_RANGE;
+      index = WATCHDOG_WHEEL_RANGE - 1;
+    }
+
+    level = 0;
+
+    while ( index >= WATCHDOG_WHEEL_LEVEL_SIZE ) {
+      index >>= WATCHDOG_WHEEL_LEVEL_BITS;
+      ++level;
+    }
+
+    slot = &wheel->Slots[ level ][
+      ( expire >> ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+        & WATCHDOG_WHEEL_LEVEL_MASK
+    ];
+  }
+
+  _Chain_Append_unprotected( slot, &the_watchdog->Node.Chain );
+}
+
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  int             level,
+  uint32_t        index
+)
+{
+  Chain_Control  pending;
+  Chain_Node    *node;
+
+  _Chain_Initialize_empty( &pending );
+  _Watchdog_Wheel_splice( &pending, &wheel->Slots[ level ][ index ] );
+
+  while ( ( node = _Chain_Get_unprotected( &pending ) ) != NULL ) {
+    _Watchdog_Wheel_place(
+      wheel,
+      RTEMS_CONTAINER_OF( node, Watchdog_Control, Node.Chain )
+    );
+  }
+}
+
+static bool _Watchdog_Wheel_is_level_empty(
+  const Watchdog_Wheel *wheel,
+  int                   level
+)
+{
+  uint32_t index;
+
+  for ( index = 0; index < WATCHDOG_WHEEL_LEVEL_SIZE; ++index ) {
+    if ( !_Chain_Is_empty( &wheel->Slots[ level ][ index ] ) ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void _Watchdog_Wheel_advance( Watchdog_Wheel *wheel, uint64_t now )
+{
+  if ( wheel->count == 0 ) {
+    if ( now > wheel->now ) {
+      wheel->now = now;
+    }
+
+    return;
+  }
+
+  while ( wheel->now < now ) {
+    uint64_t tick;
+    uint64_t skip;
+    int      level;
+
+    /*
+     * After clock ticks skipped in tickless idle mode, the wheel may have to
+     * advance by many ticks.  In case the lower levels are empty, then go
+     * directly to the tick before the next cascade of the first non-empty
+     * level.  The normal advance by one tick does not pay for this check.
+     */
+    level = 0;
+
+    if ( now - wheel->now > 1 ) {
+      while (
+        level < WATCHDOG_WHEEL_LEVEL_COUNT - 1
+          && _Watchdog_Wheel_is_level_empty( wheel, level )
+      ) {
+        ++level;
+      }
+    }
+
+    if ( level > 0 ) {
+      skip = wheel->now
+        | ( ( (uint64_t) 1 << ( level * WATCHDOG_WHEEL_LEVEL_BITS ) ) - 1 );
+
+      if ( skip > now ) {
+        skip = now;
+      }
+
+      if ( skip > wheel->now ) {
+        wheel->now = skip;
+        continue;
+      }
+    }
+
+    tick = wheel->now + 1;
+
+    /*
+     * Move the watchdogs of the higher level slots which start at this tick
+     * to the lower levels.  The time is not yet advanced, so the watchdogs
+     * are placed relative to this tick.
+     */
+    for ( level = 1; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+      uint64_t shifted;
+
+      if (
+        ( tick & ( ( (uint64_t) 1 << ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+          - 1 ) ) != 0
+      ) {
+        break;
+      }
+
+      shifted = tick >> ( level * WATCHDOG_WHEEL_LEVEL_BITS );
+      _Watchdog_Wheel_cascade(
+        wheel,
+        level,
+        (uint32_t) ( shifted & WATCHDOG_WHEEL_LEVEL_MASK )
+      );
+    }
+
+    wheel->now = tick;
+    _Watchdog_Wheel_splice(
+      &wheel->Expired,
+      &wheel->Slots[ 0 ][ tick & WATCHDOG_WHEEL_LEVEL_MASK ]
+    );
+  }
+}
+
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now )
+{
+  int      level;
+  uint32_t index;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    for ( index = 0; index < WATCHDOG_WHEEL_LEVEL_SIZE; ++index ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ index ] );
+    }
+  }
+
+  _Chain_Initialize_empty( &wheel->Expired );
+  wheel->now = now;
+  wheel->count = 0;
+}
+
+void _Watchdog_Wheel_initialize_processors( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Processor_configured_maximum;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+    Watchdog_Header *header;
+    Watchdog_Wheel  *wheel;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+    wheel = &_Watchdog_Wheels[ cpu_index ];
+
+    _Assert( _Watchdog_Header_first( header ) == NULL );
+    _Watchdog_Wheel_initialize( wheel, cpu->Watchdog.ticks );
+    header->wheel = wheel;
+  }
+}
+
+uint64_t _Watchdog_Wheel_next_expiry( const Watchdog_Wheel *wheel )
+{
+  uint64_t next;
+  int      level;
+
+  if ( wheel->count == 0 ) {
+    return UINT64_MAX;
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Expired ) ) {
+    return wheel->now + 1;
+  }
+
+  next = UINT64_MAX;
+
+  /*
+   * For the first level, the slot tick is the expiration time.  For the
+   * higher levels, it is the tick of the cascade to the lower levels.
+   */
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    uint64_t position;
+    uint32_t offset;
+
+    position = wheel->now >> ( level * WATCHDOG_WHEEL_LEVEL_BITS );
+
+    for ( offset = 1; offset <= WATCHDOG_WHEEL_LEVEL_SIZE; ++offset ) {
+      uint64_t slot;
+
+      slot = position + offset;
+
+      if (
+        !_Chain_Is_empty(
+          &wheel->Slots[ level ][ slot & WATCHDOG_WHEEL_LEVEL_MASK ]
+        )
+      ) {
+        slot <<= level * WATCHDOG_WHEEL_LEVEL_BITS;
+
+        if ( slot < next ) {
+          next = slot;
+        }
+
+        break;
+      }
+    }
+  }
+
+  return next;
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Watchdog_Wheel_place( wheel, the_watchdog );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+  ++wheel->count;
+}
+
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
+    _Assert( wheel->count > 0 );
+    _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    --wheel->count;
+  }
+}
+
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  Chain_Node *node;
+
+  _Watchdog_Wheel_advance( wheel, now );
+
+  /*
+   * The service routines may insert and remove watchdogs, so fetch one
+   * expired watchdog at a time while the lock is held.
+   */
+  while ( ( node = _Chain_Get_unprotected( &wheel->Expired ) ) != NULL ) {
+    Watchdog_Control               *the_watchdog;
+    Watchdog_Service_routine_entry  routine;
+
+    the_watchdog = RTEMS_CONTAINER_OF( node, Watchdog_Control, Node.Chain );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    --wheel->count;
+    routine = the_watchdog->routine;
+
+    _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+    ( *routine )( the_watchdog );
+    _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+  }
+}
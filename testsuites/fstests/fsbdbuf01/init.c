@@ -0,0 +1,340 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/bdbuf.h>
+#include <rtems/ramdisk.h>
+#include <rtems/test-info.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "FSBDBUF 1";
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define DISK_COUNT 4
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 128
+
+#define SHARD_COUNT 4
+
+typedef struct {
+  rtems_test_parallel_context base;
+  rtems_disk_device *dd[DISK_COUNT];
+  rtems_blkdev_stats stats[DISK_COUNT];
+  const char *test_sep;
+  const char *counter_sep;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t i;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    rtems_bdbuf_get_device_stats(ctx->dd[i], &ctx->stats[i]);
+  }
+
+  return test_duration();
+}
+
+static uint32_t test_read_misses(test_context *ctx)
+{
+  uint32_t misses = 0;
+  size_t i;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    rtems_blkdev_stats stats;
+
+    rtems_bdbuf_get_device_stats(ctx->dd[i], &stats);
+    misses += stats.read_misses - ctx->stats[i].read_misses;
+  }
+
+  return misses;
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long sum = 0;
+  const char *value_sep;
+  size_t i;
+
+  if (active_workers == 1) {
+    printf(
+      "%s{\n"
+      "    \"test\": \"%s\",\n"
+      "    \"shard-count\": %i,\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      name,
+      SHARD_COUNT
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "%s%lu",
+      value_sep,
+      local_counter
+    );
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"read-misses\": %" PRIu32 ",\n"
+    "        \"reads-per-second\": %lu",
+    test_read_misses(ctx),
+    sum * rtems_clock_get_ticks_per_second() / test_duration()
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+  }
+}
+
+static unsigned long test_read_blocks(
+  test_context *ctx,
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block
+)
+{
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    block = (block + 1) % MEDIA_BLOCK_COUNT;
+    ++counter;
+  }
+
+  return counter;
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 0;
+  unsigned long counter;
+
+  counter = test_read_blocks(ctx, ctx->dd[worker_index % DISK_COUNT], 0);
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "device per worker", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 1;
+  unsigned long counter;
+
+  counter = test_read_blocks(
+    ctx,
+    ctx->dd[0],
+    (worker_index * MEDIA_BLOCK_COUNT) / CPU_COUNT
+  );
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "shared device", 1, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }
+};
+
+static void create_disk(test_context *ctx, size_t i)
+{
+  char device[] = "/dev/rdX";
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  device[sizeof(device) - 2] = (char) ('a' + i);
+
+  rd = ramdisk_allocate(NULL, MEDIA_BLOCK_SIZE, MEDIA_BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &ctx->dd[i]);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  size_t i;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    create_disk(ctx, i);
+  }
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (512 * 1024)
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 4096
+
+#define CONFIGURE_BDBUF_SHARD_COUNT SHARD_COUNT
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (3 + DISK_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,300 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+#include <rtems/libio_.h>
+
+const char rtems_test_name[] = "FSIMFSDIRINDEX 1";
+
+#define ENTRY_COUNT 10000
+
+#define PLAIN_DIR "/plain"
+
+#define INDEXED_DIR "/indexed"
+
+#define MOUNTED_INDEXED_DIR "/mounted-indexed"
+
+typedef struct {
+  uint64_t create;
+  uint64_t lookup;
+  uint64_t remove;
+} test_times;
+
+static char path[64];
+
+static const char *entry_path(const char *dir, int i)
+{
+  int n;
+
+  n = snprintf(path, sizeof(path), "%s/e%i", dir, i);
+  rtems_test_assert(n > 0 && (size_t) n < sizeof(path));
+
+  return path;
+}
+
+static void check_index(const char *dir, bool enabled, bool has_table)
+{
+  const IMFS_directory_t *imfs_dir;
+  int fd;
+  int rv;
+
+  fd = open(dir, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  imfs_dir = rtems_libio_iop(fd)->pathinfo.node_access;
+  rtems_test_assert(imfs_dir->Index.enabled == enabled);
+  rtems_test_assert((imfs_dir->Index.table != NULL) == has_table);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_readdir_order(const char *dir)
+{
+  DIR *dirp;
+  struct dirent *dire;
+  char name[16];
+  int i;
+  int rv;
+
+  dirp = opendir(dir);
+  rtems_test_assert(dirp != NULL);
+
+  i = 0;
+
+  while ((dire = readdir(dirp)) != NULL) {
+    snprintf(name, sizeof(name), "e%i", i);
+    rtems_test_assert(strcmp(dire->d_name, name) == 0);
+    ++i;
+  }
+
+  rtems_test_assert(i == ENTRY_COUNT);
+
+  rv = closedir(dirp);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_rename(const char *dir)
+{
+  char new_path[64];
+  struct stat st;
+  int rv;
+
+  snprintf(new_path, sizeof(new_path), "%s/renamed", dir);
+
+  rv = rename(entry_path(dir, 0), new_path);
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = stat(entry_path(dir, 0), &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  rv = stat(new_path, &st);
+  rtems_test_assert(rv == 0);
+
+  rv = rename(new_path, entry_path(dir, 0));
+  rtems_test_assert(rv == 0);
+}
+
+static void run(const char *dir, bool expect_index, test_times *times)
+{
+  struct stat st;
+  uint64_t t0;
+  uint64_t t1;
+  int rv;
+  int i;
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < ENTRY_COUNT; ++i) {
+    rv = mknod(entry_path(dir, i), S_IFREG | S_IRWXU, 0);
+    rtems_test_assert(rv == 0);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  times->create = t1 - t0;
+
+  check_index(dir, expect_index, expect_index);
+
+  errno = 0;
+  rv = mknod(entry_path(dir, ENTRY_COUNT / 2), S_IFREG | S_IRWXU, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EEXIST);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = ENTRY_COUNT - 1; i >= 0; --i) {
+    rv = stat(entry_path(dir, i), &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(S_ISREG(st.st_mode));
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  times->lookup = t1 - t0;
+
+  check_readdir_order(dir);
+  check_rename(dir);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < ENTRY_COUNT; ++i) {
+    rv = unlink(entry_path(dir, i));
+    rtems_test_assert(rv == 0);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  times->remove = t1 - t0;
+
+  errno = 0;
+  rv = stat(entry_path(dir, 0), &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  /* The table is freed when the directory shrinks */
+  check_index(dir, expect_index, false);
+}
+
+static void print_times(const char *name, const test_times *times, bool last)
+{
+  printf(
+    "  {\n"
+    "    \"directory\": \"%s\",\n"
+    "    \"entries\": %i,\n"
+    "    \"create-ns-per-entry\": %" PRIu64 ",\n"
+    "    \"lookup-ns-per-entry\": %" PRIu64 ",\n"
+    "    \"remove-ns-per-entry\": %" PRIu64 "\n"
+    "  }%s\n",
+    name,
+    ENTRY_COUNT,
+    times->create / ENTRY_COUNT,
+    times->lookup / ENTRY_COUNT,
+    times->remove / ENTRY_COUNT,
+    last ? "" : ","
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  static const IMFS_mount_options indexed_options = {
+    .directory_index = true
+  };
+  test_times plain;
+  test_times indexed;
+  test_times mounted_indexed;
+  int rv;
+
+  TEST_BEGIN();
+
+  /*
+   * The root file system uses the directory index, a file system mounted
+   * through mount() without data uses the default IMFS mount options without
+   * an index.  The index of a mounted file system is enabled through the
+   * IMFS mount options.
+   */
+  rv = mkdir(PLAIN_DIR, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    "",
+    PLAIN_DIR,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir(MOUNTED_INDEXED_DIR, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    "",
+    MOUNTED_INDEXED_DIR,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &indexed_options
+  );
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir(INDEXED_DIR, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  run(PLAIN_DIR, false, &plain);
+  run(INDEXED_DIR, true, &indexed);
+  run(MOUNTED_INDEXED_DIR, true, &mounted_indexed);
+
+  rv = unmount(PLAIN_DIR);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(MOUNTED_INDEXED_DIR);
+  rtems_test_assert(rv == 0);
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n");
+  print_times("plain", &plain, false);
+  print_times("indexed", &indexed, false);
+  print_times("mounted-indexed", &mounted_indexed, true);
+  printf("]\n*** END OF JSON DATA ***\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,378 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+#define MEMFILE_DIR "/memfile"
+
+#define EXTFILE_DIR "/extfile"
+
+#define MINIMUM_FILE_SIZE (1024 * 1024)
+
+#define MAXIMUM_FILE_SIZE (64 * 1024 * 1024)
+
+#define CHUNK_SIZE (64 * 1024)
+
+typedef struct {
+  uint64_t write;
+  uint64_t read;
+} test_times;
+
+static unsigned char chunk[CHUNK_SIZE];
+
+static unsigned char buffer[CHUNK_SIZE];
+
+static void set_chunk_number(unsigned char *data, size_t i)
+{
+  memcpy(data, &i, sizeof(i));
+}
+
+static void check_chunk(const unsigned char *data, size_t i)
+{
+  set_chunk_number(chunk, i);
+  rtems_test_assert(memcmp(data, chunk, CHUNK_SIZE) == 0);
+}
+
+static bool write_file(const char *file, size_t size, test_times *times)
+{
+  uint64_t t0;
+  uint64_t t1;
+  size_t i;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < size / CHUNK_SIZE; ++i) {
+    set_chunk_number(chunk, i);
+    n = write(fd, chunk, CHUNK_SIZE);
+
+    if (n != CHUNK_SIZE) {
+      rtems_test_assert(n == -1);
+      rtems_test_assert(errno == ENOSPC);
+      rv = close(fd);
+      rtems_test_assert(rv == 0);
+      return false;
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  times->write = t1 - t0;
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+  return true;
+}
+
+static void read_file(const char *file, size_t size, test_times *times)
+{
+  uint64_t t0;
+  uint64_t t1;
+  size_t i;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(file, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < size / CHUNK_SIZE; ++i) {
+    n = read(fd, buffer, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+  times->read = t1 - t0;
+
+  n = read(fd, buffer, CHUNK_SIZE);
+  rtems_test_assert(n == 0);
+
+  rv = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < size / CHUNK_SIZE; ++i) {
+    n = read(fd, buffer, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+    check_chunk(buffer, i);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void map_file(const char *file, size_t size)
+{
+  unsigned char *p;
+  size_t i;
+  int fd;
+  int rv;
+
+  fd = open(file, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  rtems_test_assert(p != MAP_FAILED);
+
+  for (i = 0; i < size / CHUNK_SIZE; ++i) {
+    check_chunk(&p[i * CHUNK_SIZE], i);
+  }
+
+  rv = munmap(p, size);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static bool run(
+  const char *dir,
+  size_t size,
+  bool map,
+  test_times *times
+)
+{
+  char file[32];
+  bool ok;
+  int rv;
+
+  snprintf(file, sizeof(file), "%s/file", dir);
+  ok = write_file(file, size, times);
+
+  if (ok) {
+    read_file(file, size, times);
+
+    if (map) {
+      map_file(file, size);
+    }
+  }
+
+  rv = unlink(file);
+  rtems_test_assert(rv == 0);
+  return ok;
+}
+
+static void check_holes(void)
+{
+  static const char file[] = EXTFILE_DIR "/holes";
+  struct stat st;
+  size_t i;
+  off_t off;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  memset(chunk, 0xff, CHUNK_SIZE);
+  n = write(fd, chunk, 10);
+  rtems_test_assert(n == 10);
+
+  rv = ftruncate(fd, 5);
+  rtems_test_assert(rv == 0);
+
+  off = lseek(fd, 3 * CHUNK_SIZE, SEEK_SET);
+  rtems_test_assert(off == 3 * CHUNK_SIZE);
+
+  n = write(fd, chunk, CHUNK_SIZE);
+  rtems_test_assert(n == CHUNK_SIZE);
+
+  rv = ftruncate(fd, 5 * CHUNK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == 5 * CHUNK_SIZE);
+
+  off = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(off == 0);
+
+  for (i = 0; i < 5; ++i) {
+    n = read(fd, buffer, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+
+    if (i == 0) {
+      rtems_test_assert(memcmp(buffer, chunk, 5) == 0);
+      memset(buffer, 0, 5);
+    }
+
+    rtems_test_assert(buffer[0] == (i == 3 ? 0xff : 0));
+    rtems_test_assert(
+      memcmp(buffer, &buffer[1], CHUNK_SIZE - 1) == 0
+    );
+  }
+
+  n = read(fd, buffer, CHUNK_SIZE);
+  rtems_test_assert(n == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(file);
+  rtems_test_assert(rv == 0);
+
+  memset(chunk, 0xa5, CHUNK_SIZE);
+}
+
+static uint64_t mib_per_s(size_t size, uint64_t ns)
+{
+  if (ns == 0) {
+    return 0;
+  }
+
+  return ((uint64_t) size * 1000000000) / ns / (1024 * 1024);
+}
+
+static void print_times(
+  const char *name,
+  size_t size,
+  const test_times *times
+)
+{
+  printf(
+    "    \"%s\": {\n"
+    "      \"write-ns\": %" PRIu64 ",\n"
+    "      \"read-ns\": %" PRIu64 ",\n"
+    "      \"write-mib-per-s\": %" PRIu64 ",\n"
+    "      \"read-mib-per-s\": %" PRIu64 "\n"
+    "    }",
+    name,
+    times->write,
+    times->read,
+    mib_per_s(size, times->write),
+    mib_per_s(size, times->read)
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  size_t size;
+  int rv;
+
+  TEST_BEGIN();
+
+  /*
+   * The root file system uses extent files, a file system mounted through
+   * mount() uses the default IMFS mount data with block based memfiles.
+   */
+  rv = mkdir(MEMFILE_DIR, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    "",
+    MEMFILE_DIR,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir(EXTFILE_DIR, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  check_holes();
+
+  printf("*** BEGIN OF JSON DATA ***\n[");
+
+  for (size = MINIMUM_FILE_SIZE; size <= MAXIMUM_FILE_SIZE; size *= 2) {
+    test_times memfile;
+    test_times extfile;
+
+    /* Stop at the first file size which does not fit into the heap */
+    if (
+      !run(MEMFILE_DIR, size, false, &memfile)
+        || !run(EXTFILE_DIR, size, true, &extfile)
+    ) {
+      break;
+    }
+
+    printf(
+      "%s\n  {\n    \"file-size\": %zu,\n",
+      size == MINIMUM_FILE_SIZE ? "" : ",",
+      size
+    );
+    print_times("memfile", size, &memfile);
+    printf(",\n");
+    print_times("extfile", size, &extfile);
+    printf("\n  }");
+  }
+
+  printf("\n]\n*** END OF JSON DATA ***\n");
+
+  rv = unmount(MEMFILE_DIR);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+/* Use the largest block size so that the memfiles can hold 64 MiB */
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
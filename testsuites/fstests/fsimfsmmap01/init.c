@@ -0,0 +1,204 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+static const char image[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static void *map_file(
+  const char *path,
+  size_t len,
+  int prot,
+  int flags,
+  off_t off
+)
+{
+  void *p;
+  int fd;
+  int rv;
+
+  fd = open(path, (prot & PROT_WRITE) != 0 ? O_RDWR : O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  p = mmap(NULL, len, prot, flags, fd, off);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return p;
+}
+
+static void test_linear_file(void)
+{
+  const char *p;
+  const char *q;
+  int rv;
+
+  rv = IMFS_make_linearfile("/linear", S_IRWXU, image, sizeof(image));
+  rtems_test_assert(rv == 0);
+
+  /* Read-only private and shared mappings refer to the file image */
+  p = map_file("/linear", sizeof(image), PROT_READ, MAP_PRIVATE, 0);
+  rtems_test_assert(p == image);
+
+  q = map_file("/linear", 10, PROT_READ, MAP_SHARED, 26);
+  rtems_test_assert(q == &image[26]);
+
+  rv = munmap(RTEMS_DECONST(char *, q), 10);
+  rtems_test_assert(rv == 0);
+
+  /* The mapping stays valid after the removal of the file */
+  rv = unlink("/linear");
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(memcmp(p, image, sizeof(image)) == 0);
+
+  rv = munmap(RTEMS_DECONST(char *, p), sizeof(image));
+  rtems_test_assert(rv == 0);
+}
+
+static void write_file(const char *path, const void *data, size_t size)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_memfile(void)
+{
+  static const char data[] = "ABCDEFGHIJ";
+  static char big[4096];
+  char *p;
+  char *q;
+  int fd;
+  int rv;
+
+  write_file("/small", image, 16);
+
+  p = map_file("/small", 16, PROT_READ | PROT_WRITE, MAP_SHARED, 0);
+  rtems_test_assert(p != MAP_FAILED);
+  rtems_test_assert(memcmp(p, image, 16) == 0);
+
+  q = map_file("/small", 10, PROT_READ, MAP_PRIVATE, 6);
+  rtems_test_assert(q == &p[6]);
+
+  rv = munmap(q, 10);
+  rtems_test_assert(rv == 0);
+
+  /* Shared mappings see the changes of the file */
+  fd = open("/small", O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = pwrite(fd, data, 10, 0);
+  rtems_test_assert(rv == 10);
+  rtems_test_assert(memcmp(p, data, 10) == 0);
+
+  /* Truncate and remove the file while it is mapped */
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/small");
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(memcmp(p, data, 10) == 0);
+
+  rv = munmap(p, 16);
+  rtems_test_assert(rv == 0);
+
+  /* Ranges which span multiple blocks are not contiguous */
+  memset(big, 0x5a, sizeof(big));
+  write_file("/big", big, sizeof(big));
+
+  errno = 0;
+  p = map_file("/big", sizeof(big), PROT_READ | PROT_WRITE, MAP_SHARED, 0);
+  rtems_test_assert(p == MAP_FAILED);
+  rtems_test_assert(errno == ENOTSUP);
+
+  /* Private mappings fall back to a copy */
+  p = map_file("/big", sizeof(big), PROT_READ, MAP_PRIVATE, 0);
+  rtems_test_assert(p != MAP_FAILED);
+  rtems_test_assert(memcmp(p, big, sizeof(big)) == 0);
+
+  rv = munmap(p, sizeof(big));
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/big");
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_linear_file();
+  test_memfile();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -48,6 +48,12 @@ const char rtems_test_name[] = "BLOCK 14";
 
 #define DISK_PATH "/disk"
 
+#define STREAM_ACTION_COUNT 18
+
+#define STREAM_BLOCK_COUNT 64
+
+#define STREAM_DISK_PATH "/disk-streams"
+
 typedef struct {
   rtems_blkdev_bnum block;
   rtems_status_code (*get)(
@@ -94,7 +100,7 @@ static const test_action actions [ACTION_COUNT] = {
   { 7, rtems_bdbuf_read, NULL, RTEMS_SUCCESSFUL, rtems_bdbuf_release },
 };
 
-#define STATS(a, b, c, d, e, f, g, h, i) \
+#define STATS(a, b, c, d, e, f, g, h, i, j, k, l) \
   { \
     .read_hits = a, \
     .read_misses = b, \
@@ -104,59 +110,128 @@ static const test_action actions [ACTION_COUNT] = {
     .read_errors = f, \
     .write_transfers = g, \
     .write_blocks = h, \
-    .write_errors = i \
+    .write_errors = i, \
+    .read_ahead_hits = j, \
+    .read_ahead_misses = k, \
+    .read_ahead_waste = l \
   }
 
 static const rtems_blkdev_stats expected_stats [ACTION_COUNT] = {
-  STATS(0, 1, 0, 0, 1, 0, 0, 0, 0),
-  STATS(0, 2, 1, 0, 3, 0, 0, 0, 0),
-  STATS(1, 2, 2, 0, 4, 0, 0, 0, 0),
+  STATS(0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0),
+  STATS(0, 2, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0),
+  STATS(1, 2, 2, 0, 5, 0, 0, 0, 0, 1, 0, 0),
 
-  STATS(2, 2, 2, 0, 4, 0, 0, 0, 0),
+  STATS(2, 2, 2, 0, 5, 0, 0, 0, 0, 1, 0, 0),
 
-  STATS(2, 2, 2, 0, 4, 0, 1, 1, 0),
-  STATS(2, 3, 2, 0, 5, 1, 1, 1, 0),
-  STATS(2, 3, 2, 0, 5, 1, 2, 2, 1),
+  STATS(2, 2, 2, 0, 5, 0, 1, 1, 0, 1, 0, 0),
+  STATS(2, 3, 2, 0, 6, 1, 1, 1, 0, 1, 0, 0),
+  STATS(2, 3, 2, 0, 6, 1, 2, 2, 1, 1, 0, 0),
 
-  STATS(2, 4, 2, 0, 6, 1, 2, 2, 1),
-  STATS(2, 4, 3, 1, 7, 1, 2, 2, 1),
-  STATS(2, 5, 3, 1, 8, 1, 2, 2, 1),
-  STATS(2, 6, 4, 1, 10, 1, 2, 2, 1),
-  STATS(3, 6, 4, 1, 10, 1, 2, 2, 1),
+  STATS(2, 4, 2, 0, 7, 1, 2, 2, 1, 1, 0, 0),
+  STATS(2, 4, 3, 1, 8, 1, 2, 2, 1, 1, 0, 0),
+  STATS(2, 5, 3, 1, 9, 1, 2, 2, 1, 1, 0, 0),
+  STATS(2, 6, 4, 1, 11, 1, 2, 2, 1, 1, 0, 0),
+  STATS(3, 6, 4, 1, 11, 1, 2, 2, 1, 2, 0, 0),
 
-  STATS(3, 6, 5, 2, 11, 1, 2, 2, 1),
-  STATS(4, 6, 5, 2, 11, 1, 2, 2, 1),
+  STATS(3, 6, 5, 2, 12, 1, 2, 2, 1, 2, 0, 0),
+  STATS(4, 6, 5, 2, 12, 1, 2, 2, 1, 3, 0, 0),
 
-  STATS(4, 6, 6, 3, 12, 1, 2, 2, 1),
-  STATS(4, 7, 6, 3, 13, 1, 2, 2, 1),
+  STATS(4, 6, 6, 3, 13, 1, 2, 2, 1, 3, 0, 0),
+  STATS(4, 7, 6, 3, 14, 1, 2, 2, 1, 3, 0, 0),
 };
 
 static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
    { 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-   { 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-
-   { 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+   { 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 
    { 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-   { 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0 },
 
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0 },
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 1, 0, 0, 0, 1 },
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 1, 1, 0, 0, 1 },
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 1, 1, 1, 1, 1 },
-   { 1, 1, 1, 1, 1, 2, 0, 0, 0, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+   { 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0 },
 
-   { 1, 1, 1, 1, 1, 2, 1, 0, 0, 1, 1, 1, 1, 1 },
-   { 1, 1, 1, 1, 1, 2, 1, 0, 0, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 1, 0, 0, 0, 0 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 1, 0, 0, 0, 1 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 1, 1, 0, 0, 1 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 2, 0, 0, 0, 1, 1, 1, 1, 1 },
 
-   { 1, 1, 1, 1, 1, 2, 1, 0, 1, 1, 1, 1, 1, 1 },
-   { 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 2, 1, 0, 0, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 2, 1, 0, 0, 1, 1, 1, 1, 1 },
+
+   { 1, 1, 1, 1, 2, 2, 1, 0, 1, 1, 1, 1, 1, 1 },
+   { 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 },
 };
 
 static int block_access_counts [BLOCK_COUNT];
 
+typedef struct {
+  rtems_blkdev_bnum block;
+  uint32_t window_a;
+  uint32_t window_b;
+} stream_action;
+
+/*
+ * Stream A starts at block 0 and uses the first read-ahead stream of the
+ * device.  Stream B starts at block 32 and uses the second read-ahead stream.
+ * The cache has BLOCK_COUNT buffers.
+ */
+static const stream_action stream_actions [STREAM_ACTION_COUNT] = {
+  /* interleaved streams, the first trigger of a stream is no miss */
+  { 0, 0, 0 },
+  { 32, 0, 0 },
+  { 1, 1, 0 },
+  { 33, 1, 1 },
+
+  /* each trigger doubles the window up to the maximum */
+  { 2, 2, 1 },
+  { 34, 2, 2 },
+  { 3, 2, 2 },
+  { 35, 2, 2 },
+  { 4, 4, 2 },
+  { 36, 4, 4 },
+
+  /*
+   * Stream B continues alone and recycles the blocks 5 up to 8 read ahead by
+   * stream A, so the window of stream A shrinks
+   */
+  { 37, 4, 4 },
+  { 38, 4, 4 },
+  { 39, 4, 4 },
+  { 40, 4, 4 },
+  { 41, 4, 4 },
+  { 42, 4, 4 },
+  { 43, 1, 4 },
+
+  /* the trigger block of stream A was recycled, so this is a miss */
+  { 7, 2, 4 }
+};
+
+static const rtems_blkdev_stats expected_stream_stats [STREAM_ACTION_COUNT] = {
+  STATS(0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0),
+  STATS(0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0),
+  STATS(0, 3, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0),
+  STATS(0, 4, 2, 0, 6, 0, 0, 0, 0, 0, 0, 0),
+
+  STATS(1, 4, 3, 0, 8, 0, 0, 0, 0, 1, 0, 0),
+  STATS(2, 4, 4, 0, 10, 0, 0, 0, 0, 2, 0, 0),
+  STATS(3, 4, 4, 0, 10, 0, 0, 0, 0, 3, 0, 0),
+  STATS(4, 4, 4, 0, 10, 0, 0, 0, 0, 4, 0, 0),
+  STATS(5, 4, 5, 0, 14, 0, 0, 0, 0, 5, 0, 0),
+  STATS(6, 4, 6, 0, 18, 0, 0, 0, 0, 6, 0, 0),
+
+  STATS(7, 4, 6, 0, 18, 0, 0, 0, 0, 7, 0, 0),
+  STATS(8, 4, 6, 0, 18, 0, 0, 0, 0, 8, 0, 0),
+  STATS(9, 4, 7, 0, 22, 0, 0, 0, 0, 9, 0, 0),
+  STATS(10, 4, 7, 0, 22, 0, 0, 0, 0, 10, 0, 0),
+  STATS(11, 4, 7, 0, 22, 0, 0, 0, 0, 11, 0, 0),
+  STATS(12, 4, 7, 0, 22, 0, 0, 0, 0, 12, 0, 0),
+  STATS(13, 4, 8, 0, 26, 0, 0, 0, 0, 13, 0, 4),
+
+  STATS(13, 5, 9, 0, 29, 0, 0, 0, 0, 13, 1, 4)
+};
+
 static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
 {
   int rv = 0;
@@ -187,6 +262,27 @@ static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
   return rv;
 }
 
+static int stream_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_test_assert(sg [i].block < STREAM_BLOCK_COUNT);
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
 static void test_actions(rtems_disk_device *dd)
 {
   int i;
@@ -235,7 +331,44 @@ static void test_actions(rtems_disk_device *dd)
   rtems_blkdev_print_stats(&dd->stats, 0, 1, 2, &rtems_test_printer);
 }
 
-static void test(void)
+static void test_stream_actions(rtems_disk_device *dd)
+{
+  int i;
+
+  for (i = 0; i < STREAM_ACTION_COUNT; ++i) {
+    const stream_action *action = &stream_actions [i];
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+    rtems_blkdev_stats stats;
+
+    printf("stream action %i\n", i);
+
+    sc = rtems_bdbuf_read(dd, action->block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_test_assert(dd->read_ahead.window == action->window_a);
+    rtems_test_assert(dd->read_ahead_streams [0].window == action->window_b);
+
+    rtems_bdbuf_get_device_stats(dd, &stats);
+
+    rtems_test_assert(
+      memcmp(
+        &stats,
+        &expected_stream_stats [i],
+        sizeof(stats)
+      ) == 0
+    );
+  }
+}
+
+static rtems_disk_device *create_disk(
+  const char *path,
+  rtems_blkdev_bnum block_count,
+  rtems_block_device_ioctl handler
+)
 {
   rtems_status_code sc;
   rtems_disk_device *dd;
@@ -243,15 +376,15 @@ static void test(void)
   int rv;
 
   sc = rtems_blkdev_create(
-    DISK_PATH,
+    path,
     1,
-    BLOCK_COUNT,
-    test_disk_ioctl,
+    block_count,
+    handler,
     NULL
   );
   rtems_test_assert(sc == RTEMS_SUCCESSFUL);
 
-  fd = open(DISK_PATH, O_RDWR);
+  fd = open(path, O_RDWR);
   rtems_test_assert(fd >= 0);
 
   rv = rtems_disk_fd_get_disk_device(fd, &dd);
@@ -260,10 +393,25 @@ static void test(void)
   rv = close(fd);
   rtems_test_assert(rv == 0);
 
+  return dd;
+}
+
+static void test(void)
+{
+  rtems_disk_device *dd;
+  int rv;
+
+  dd = create_disk(DISK_PATH, BLOCK_COUNT, test_disk_ioctl);
   test_actions(dd);
 
   rv = unlink(DISK_PATH);
   rtems_test_assert(rv == 0);
+
+  dd = create_disk(STREAM_DISK_PATH, STREAM_BLOCK_COUNT, stream_disk_ioctl);
+  test_stream_actions(dd);
+
+  rv = unlink(STREAM_DISK_PATH);
+  rtems_test_assert(rv == 0);
 }
 
 static void Init(rtems_task_argument arg)
@@ -286,7 +434,9 @@ static void Init(rtems_task_argument arg)
 #define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
 #define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
 #define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
-#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 1
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 4
+#define CONFIGURE_BDBUF_MIN_READ_AHEAD_BLOCKS 1
+#define CONFIGURE_BDBUF_READ_AHEAD_STREAMS 2
 #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
 
 #define CONFIGURE_MAXIMUM_TASKS 1
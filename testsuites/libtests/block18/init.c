@@ -0,0 +1,288 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <rtems/ramdisk.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define BLOCK_SIZE 64
+
+#define BLOCK_COUNT 2048
+
+#define SHARD_COUNT 4
+
+#define BUFFER_COUNT 64
+
+#define WORKER_COUNT 2
+
+#define BLOCKS_PER_WORKER (BLOCK_COUNT / WORKER_COUNT)
+
+static rtems_disk_device *dd;
+
+static rtems_id init_task;
+
+static unsigned char pattern(rtems_blkdev_bnum block, uint32_t round)
+{
+  return (unsigned char) ((block * 7) + (block >> 8) + round);
+}
+
+static void fill_block(
+  rtems_bdbuf_buffer *bd,
+  rtems_blkdev_bnum block,
+  uint32_t round
+)
+{
+  size_t i;
+
+  for (i = 0; i < BLOCK_SIZE; ++i) {
+    bd->buffer[i] = pattern(block, round) + (unsigned char) i;
+  }
+}
+
+static void check_block(
+  const unsigned char *buf,
+  rtems_blkdev_bnum block,
+  uint32_t round
+)
+{
+  size_t i;
+
+  for (i = 0; i < BLOCK_SIZE; ++i) {
+    rtems_test_assert(buf[i] == (unsigned char) (pattern(block, round) + i));
+  }
+}
+
+static void write_blocks(
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end,
+  uint32_t round
+)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    sc = rtems_bdbuf_get(dd, block, &bd);
+    ASSERT_SC(sc);
+
+    fill_block(bd, block, round);
+
+    sc = rtems_bdbuf_release_modified(bd);
+    ASSERT_SC(sc);
+  }
+}
+
+static void read_blocks(
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end,
+  uint32_t round
+)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    ASSERT_SC(sc);
+
+    check_block(bd->buffer, block, round);
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum begin;
+  rtems_blkdev_bnum end;
+
+  begin = arg * BLOCKS_PER_WORKER;
+  end = begin + BLOCKS_PER_WORKER;
+
+  write_blocks(begin, end, 1);
+  read_blocks(begin, end, 1);
+
+  sc = rtems_event_send(init_task, RTEMS_EVENT_0 << arg);
+  ASSERT_SC(sc);
+
+  rtems_task_exit();
+}
+
+static void test_sequential(void)
+{
+  rtems_status_code sc;
+
+  write_blocks(0, BLOCK_COUNT, 0);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+
+  read_blocks(0, BLOCK_COUNT, 0);
+}
+
+static void test_concurrent(void)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_event_set all;
+  rtems_task_argument i;
+
+  all = 0;
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    ASSERT_SC(sc);
+
+    sc = rtems_task_start(id, worker_task, i);
+    ASSERT_SC(sc);
+
+    all |= RTEMS_EVENT_0 << i;
+  }
+
+  sc = rtems_event_receive(all, RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT, &events);
+  ASSERT_SC(sc);
+  rtems_test_assert(events == all);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+}
+
+static void test(void)
+{
+  static const char device[] = "/dev/rda";
+  rtems_status_code sc;
+  ramdisk *rd;
+  unsigned char *area;
+  rtems_blkdev_bnum block;
+  int fd;
+  int rv;
+
+  init_task = rtems_task_self();
+
+  area = calloc(BLOCK_COUNT, BLOCK_SIZE);
+  rtems_test_assert(area != NULL);
+
+  rd = ramdisk_allocate(area, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  /*
+   * The device is much larger than the cache, so the blocks span all shards
+   * and each shard has to reclaim its buffers several times.
+   */
+  test_sequential();
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    check_block(&area[block * BLOCK_SIZE], block, 0);
+  }
+
+  test_concurrent();
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    check_block(&area[block * BLOCK_SIZE], block, 1);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BUFFER_COUNT * BLOCK_SIZE)
+#define CONFIGURE_BDBUF_SHARD_COUNT SHARD_COUNT
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
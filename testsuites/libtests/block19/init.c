@@ -0,0 +1,312 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define BLOCK_COUNT 32
+
+#define BUFFER_COUNT 8
+
+#define BATCH_BLOCKS 2
+
+#define REQUEST_COUNT 32
+
+#define DISK_COUNT 2
+
+typedef struct {
+  int disk;
+  rtems_blkdev_bnum block;
+  uint32_t count;
+} write_request;
+
+static const char * const disk_paths[DISK_COUNT] = { "/dev/a", "/dev/b" };
+
+static rtems_disk_device *disks[DISK_COUNT];
+
+static write_request requests[REQUEST_COUNT];
+
+static size_t request_count;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+
+    if (breq->req == RTEMS_BLKDEV_REQ_WRITE) {
+      write_request *wr;
+      uint32_t i;
+
+      rtems_test_assert(request_count < REQUEST_COUNT);
+      wr = &requests[request_count];
+      ++request_count;
+
+      wr->disk = (int) (uintptr_t) rtems_disk_get_driver_data(dd);
+      wr->block = breq->bufs[0].block;
+      wr->count = breq->bufnum;
+
+      for (i = 1; i < breq->bufnum; ++i) {
+        rtems_test_assert(breq->bufs[i].block == wr->block + i);
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else if (req == RTEMS_BLKIO_CAPABILITIES) {
+    *(uint32_t *) arg = RTEMS_BLKDEV_CAP_MULTISECTOR_CONT;
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void modify(int disk, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(disks[disk], block, &bd);
+  ASSERT_SC(sc);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  ASSERT_SC(sc);
+}
+
+static void check_request(
+  size_t index,
+  int disk,
+  rtems_blkdev_bnum block,
+  uint32_t count
+)
+{
+  rtems_test_assert(index < request_count);
+  rtems_test_assert(requests[index].disk == disk);
+  rtems_test_assert(requests[index].block == block);
+  rtems_test_assert(requests[index].count == count);
+}
+
+static void test_merge_adjacent(void)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  request_count = 0;
+
+  /*
+   * Block 5 is held.  The sync of block 6 merges it into the write.
+   */
+  modify(0, 5);
+
+  sc = rtems_bdbuf_get(disks[0], 6, &bd);
+  ASSERT_SC(sc);
+
+  sc = rtems_bdbuf_sync(bd);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(request_count == 1);
+  check_request(0, 0, 5, 2);
+}
+
+static void test_circular_sweep(void)
+{
+  rtems_status_code sc;
+
+  request_count = 0;
+
+  /*
+   * The previous write ended at block 6, so the sweep continues with block 9
+   * and wraps around to block 2.
+   */
+  modify(0, 2);
+  modify(0, 9);
+
+  sc = rtems_bdbuf_syncdev(disks[0]);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(request_count == 2);
+  check_request(0, 0, 9, 1);
+  check_request(1, 0, 2, 1);
+}
+
+static void test_batch_sync(void)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+  size_t i;
+
+  request_count = 0;
+
+  for (block = 10; block < 16; ++block) {
+    modify(0, block);
+  }
+
+  /*
+   * The batch limit splits the sync into several swap-out passes.  The sync
+   * shall complete after the last pass.
+   */
+  sc = rtems_bdbuf_syncdev(disks[0]);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(request_count == 3);
+
+  for (i = 0; i < request_count; ++i) {
+    check_request(i, 0, 10 + i * BATCH_BLOCKS, BATCH_BLOCKS);
+  }
+}
+
+static void test_oldest_device(void)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_bnum block;
+  int disk;
+
+  request_count = 0;
+
+  /*
+   * The buffer of disk B is the oldest modified buffer.  It is moved to the
+   * end of the modified list by a second modification, so that the buffers
+   * of disk A are found first on the list.
+   */
+  modify(1, 0);
+
+  sc = rtems_task_wake_after(2);
+  ASSERT_SC(sc);
+
+  for (block = 0; block < BUFFER_COUNT - 1; ++block) {
+    modify(0, block);
+  }
+
+  modify(1, 0);
+
+  /*
+   * All buffers are modified and held.  Waiting for a free buffer forces the
+   * swap-out which shall write the device of the oldest buffer first.
+   */
+  sc = rtems_bdbuf_get(disks[0], BUFFER_COUNT, &bd);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(request_count >= 1);
+  check_request(0, 1, 0, 1);
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    sc = rtems_bdbuf_syncdev(disks[disk]);
+    ASSERT_SC(sc);
+  }
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  int disk;
+  int fd;
+  int rv;
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    sc = rtems_blkdev_create(
+      disk_paths[disk],
+      1,
+      BLOCK_COUNT,
+      test_disk_ioctl,
+      (void *) (uintptr_t) disk
+    );
+    ASSERT_SC(sc);
+
+    fd = open(disk_paths[disk], O_RDWR);
+    rtems_test_assert(fd >= 0);
+
+    rv = rtems_disk_fd_get_disk_device(fd, &disks[disk]);
+    rtems_test_assert(rv == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  test_merge_adjacent();
+  test_circular_sweep();
+  test_batch_sync();
+  test_oldest_device();
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    rv = unlink(disk_paths[disk]);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BUFFER_COUNT
+#define CONFIGURE_BDBUF_IO_SCHEDULER RTEMS_BDBUF_IO_SCHEDULER_DEADLINE
+#define CONFIGURE_BDBUF_SWAPOUT_BATCH_BLOCKS BATCH_BLOCKS
+
+/* Hold the modified buffers until the test forces the swap-out */
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD 1000000
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
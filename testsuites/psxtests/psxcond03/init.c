@@ -0,0 +1,314 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <pthread.h>
+
+const char rtems_test_name[] = "PSXCOND 3";
+
+#define WORKER_COUNT 3
+
+typedef struct {
+  pthread_mutex_t mtx;
+  pthread_mutex_t mtx_2;
+  pthread_cond_t cnd;
+  unsigned int waiting;
+  unsigned int woken;
+  rtems_id worker_ids[ WORKER_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void worker( rtems_task_argument arg )
+{
+  test_context *ctx;
+  int           eno;
+
+  ctx = (test_context *) arg;
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  ++ctx->waiting;
+
+  eno = pthread_cond_wait( &ctx->cnd, &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  ++ctx->woken;
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  rtems_task_exit();
+}
+
+static void start_workers( test_context *ctx )
+{
+  size_t i;
+
+  ctx->waiting = 0;
+  ctx->woken = 0;
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', 'K' ),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_ids[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_start(
+      ctx->worker_ids[ i ],
+      worker,
+      (rtems_task_argument) ctx
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  rtems_test_assert( ctx->waiting == WORKER_COUNT );
+  rtems_test_assert( ctx->woken == 0 );
+}
+
+static void test_mutex_fast_path( test_context *ctx )
+{
+  int eno;
+
+  eno = pthread_mutex_trylock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_trylock( &ctx->mtx );
+  rtems_test_assert( eno == EDEADLK );
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == EDEADLK );
+
+  eno = pthread_mutex_destroy( &ctx->mtx );
+  rtems_test_assert( eno == EBUSY );
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == EPERM );
+
+  eno = pthread_cond_signal( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_cond_broadcast( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+}
+
+static void deadlock_worker( rtems_task_argument arg )
+{
+  test_context *ctx;
+  int           eno;
+
+  ctx = (test_context *) arg;
+
+  eno = pthread_mutex_lock( &ctx->mtx_2 );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  ++ctx->woken;
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_unlock( &ctx->mtx_2 );
+  rtems_test_assert( eno == 0 );
+
+  rtems_task_exit();
+}
+
+static void test_mutex_deadlock( test_context *ctx )
+{
+  rtems_status_code sc;
+  int               eno;
+
+  ctx->woken = 0;
+
+  eno = pthread_mutex_init( &ctx->mtx_2, NULL );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'D', 'E', 'A', 'D' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_ids[ 0 ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The worker owns the second mutex and waits for the first mutex */
+  sc = rtems_task_start(
+    ctx->worker_ids[ 0 ],
+    deadlock_worker,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->woken == 0 );
+
+  eno = pthread_mutex_lock( &ctx->mtx_2 );
+  rtems_test_assert( eno == EDEADLK );
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert( ctx->woken == 1 );
+
+  eno = pthread_mutex_lock( &ctx->mtx_2 );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_unlock( &ctx->mtx_2 );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_destroy( &ctx->mtx_2 );
+  rtems_test_assert( eno == 0 );
+}
+
+static void test_broadcast_with_mutex( test_context *ctx )
+{
+  int eno;
+
+  start_workers( ctx );
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_cond_broadcast( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert( ctx->woken == 0 );
+
+  /* The mutex releases wake up the waiters one by one */
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert( ctx->woken == WORKER_COUNT );
+
+  eno = pthread_mutex_destroy( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_init( &ctx->mtx, NULL );
+  rtems_test_assert( eno == 0 );
+}
+
+static void test_destroy_after_broadcast( test_context *ctx )
+{
+  int eno;
+
+  start_workers( ctx );
+
+  eno = pthread_mutex_lock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_cond_broadcast( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+
+  /* All waiters were woken up by the broadcast from our point of view */
+  eno = pthread_cond_destroy( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_destroy( &ctx->mtx );
+  rtems_test_assert( eno == EBUSY );
+
+  eno = pthread_mutex_unlock( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert( ctx->woken == WORKER_COUNT );
+
+  eno = pthread_cond_init( &ctx->cnd, NULL );
+  rtems_test_assert( eno == 0 );
+}
+
+static void test_broadcast_without_mutex( test_context *ctx )
+{
+  int eno;
+
+  start_workers( ctx );
+
+  eno = pthread_cond_broadcast( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert( ctx->woken == WORKER_COUNT );
+
+  eno = pthread_cond_destroy( &ctx->cnd );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_destroy( &ctx->mtx );
+  rtems_test_assert( eno == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  int           eno;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  eno = pthread_mutex_init( &ctx->mtx, NULL );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_cond_init( &ctx->cnd, NULL );
+  rtems_test_assert( eno == 0 );
+
+  test_mutex_fast_path( ctx );
+  test_mutex_deadlock( ctx );
+  test_broadcast_with_mutex( ctx );
+  test_destroy_after_broadcast( ctx );
+  test_broadcast_without_mutex( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
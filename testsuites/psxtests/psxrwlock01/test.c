@@ -44,6 +44,10 @@
 /* #define __USE_XOPEN2K XXX already defined on GNU/Linux */
 #include <pthread.h>
 
+#if defined(__rtems__)
+#include <rtems/posix/pthread.h>
+#endif
+
 const char rtems_test_name[] = "PSXRWLOCK 1";
 
 /* forward declarations to avoid warnings */
@@ -333,6 +337,79 @@ static void test_rwlock_auto_initialization( void )
   }
 }
 
+#if defined(__rtems__)
+static void test_rwlock_read_mostly( void )
+{
+  pthread_rwlock_t rw;
+  pthread_rwlockattr_t attr;
+  int eno;
+  int i;
+
+  eno = pthread_rwlockattr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlockattr_setkind_np( &attr, PTHREAD_RWLOCK_READ_MOSTLY_NP );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_init( &rw, &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlockattr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+
+  /* An unlock without owning the lock shall not corrupt the reader counters */
+  eno = pthread_rwlock_unlock( &rw );
+  rtems_test_assert( eno == EPERM );
+
+  eno = pthread_rwlock_rdlock( &rw );
+  rtems_test_assert( eno == 0 );
+
+  /* Read locks are recursive */
+  eno = pthread_rwlock_rdlock( &rw );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_tryrdlock( &rw );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_wrlock( &rw );
+  rtems_test_assert( eno == EDEADLK );
+
+  eno = pthread_rwlock_trywrlock( &rw );
+  rtems_test_assert( eno == EDEADLK );
+
+  for ( i = 3; i < 255; ++i ) {
+    eno = pthread_rwlock_rdlock( &rw );
+    rtems_test_assert( eno == 0 );
+  }
+
+  eno = pthread_rwlock_rdlock( &rw );
+  rtems_test_assert( eno == EAGAIN );
+
+  eno = pthread_rwlock_tryrdlock( &rw );
+  rtems_test_assert( eno == EAGAIN );
+
+  for ( i = 0; i < 255; ++i ) {
+    eno = pthread_rwlock_unlock( &rw );
+    rtems_test_assert( eno == 0 );
+  }
+
+  eno = pthread_rwlock_unlock( &rw );
+  rtems_test_assert( eno == EPERM );
+
+  eno = pthread_rwlock_wrlock( &rw );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_unlock( &rw );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_unlock( &rw );
+  rtems_test_assert( eno == EPERM );
+
+  eno = pthread_rwlock_destroy( &rw );
+  rtems_test_assert( eno == 0 );
+}
+#endif
+
 /*
  *  main entry point to the test
  */
@@ -360,6 +437,9 @@ int main(
   test_rwlock_not_initialized();
   test_rwlock_invalid_copy();
   test_rwlock_auto_initialization();
+#if defined(__rtems__)
+  test_rwlock_read_mostly();
+#endif
 
   /*************** NULL POINTER CHECKS *****************/
   puts( "pthread_rwlockattr_init( NULL ) -- EINVAL" );
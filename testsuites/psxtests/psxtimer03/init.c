@@ -0,0 +1,225 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <signal.h>
+#include <time.h>
+
+const char rtems_test_name[] = "PSXTIMER 3";
+
+static volatile int signal_count;
+
+static void signal_handler( int signo )
+{
+  rtems_test_assert( signo == SIGUSR1 );
+  ++signal_count;
+}
+
+static void wait_milliseconds( uint32_t ms )
+{
+  rtems_status_code sc;
+  rtems_interval    ticks;
+
+  ticks = ( ms * rtems_clock_get_ticks_per_second() + 999 ) / 1000;
+  sc = rtems_task_wake_after( ticks );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wait_for_clock_tick( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void set_realtime( time_t delta )
+{
+  struct timespec now;
+  int             rv;
+
+  rv = clock_gettime( CLOCK_REALTIME, &now );
+  rtems_test_assert( rv == 0 );
+  now.tv_sec += delta;
+  rv = clock_settime( CLOCK_REALTIME, &now );
+  rtems_test_assert( rv == 0 );
+}
+
+static timer_t create_timer( void )
+{
+  struct sigevent event;
+  timer_t         timer;
+  int             rv;
+
+  event.sigev_notify = SIGEV_SIGNAL;
+  event.sigev_signo = SIGUSR1;
+  event.sigev_value.sival_int = 0;
+  rv = timer_create( CLOCK_REALTIME, &event, &timer );
+  rtems_test_assert( rv == 0 );
+
+  return timer;
+}
+
+static void delete_timer( timer_t timer )
+{
+  int rv;
+
+  rv = timer_delete( timer );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_relative_timer( void )
+{
+  struct itimerspec value;
+  timer_t           timer;
+  int               rv;
+
+  timer = create_timer();
+  signal_count = 0;
+
+  value.it_value.tv_sec = 0;
+  value.it_value.tv_nsec = 100000000;
+  value.it_interval.tv_sec = 0;
+  value.it_interval.tv_nsec = 0;
+  rv = timer_settime( timer, 0, &value, NULL );
+  rtems_test_assert( rv == 0 );
+
+  /* A relative timer does not expire if the time of day is set forward */
+  set_realtime( 3600 );
+  wait_for_clock_tick();
+  rtems_test_assert( signal_count == 0 );
+
+  rv = timer_gettime( timer, &value );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( value.it_value.tv_sec == 0 );
+  rtems_test_assert( value.it_value.tv_nsec > 0 );
+  rtems_test_assert( value.it_value.tv_nsec <= 100000000 );
+
+  /* A relative timer is not delayed if the time of day is set backward */
+  set_realtime( -7200 );
+  wait_milliseconds( 200 );
+  rtems_test_assert( signal_count == 1 );
+
+  delete_timer( timer );
+}
+
+static void test_absolute_timer( void )
+{
+  struct itimerspec value;
+  timer_t           timer;
+  int               rv;
+
+  timer = create_timer();
+  signal_count = 0;
+
+  rv = clock_gettime( CLOCK_REALTIME, &value.it_value );
+  rtems_test_assert( rv == 0 );
+  value.it_value.tv_sec += 3600;
+  value.it_interval.tv_sec = 0;
+  value.it_interval.tv_nsec = 0;
+  rv = timer_settime( timer, TIMER_ABSTIME, &value, NULL );
+  rtems_test_assert( rv == 0 );
+
+  /* An absolute CLOCK_REALTIME timer follows the time of day */
+  set_realtime( 7200 );
+  wait_for_clock_tick();
+  rtems_test_assert( signal_count == 1 );
+
+  delete_timer( timer );
+}
+
+static void test_periodic_timer( void )
+{
+  struct itimerspec value;
+  timer_t           timer;
+  int               rv;
+
+  timer = create_timer();
+  signal_count = 0;
+
+  rv = clock_gettime( CLOCK_REALTIME, &value.it_value );
+  rtems_test_assert( rv == 0 );
+  value.it_value.tv_sec += 3600;
+  value.it_interval.tv_sec = 0;
+  value.it_interval.tv_nsec = 100000000;
+  rv = timer_settime( timer, TIMER_ABSTIME, &value, NULL );
+  rtems_test_assert( rv == 0 );
+
+  set_realtime( 3600 );
+  wait_for_clock_tick();
+  rtems_test_assert( signal_count == 1 );
+
+  /* The intervals of a periodic timer are relative */
+  set_realtime( 3600 );
+  wait_for_clock_tick();
+  rtems_test_assert( signal_count == 1 );
+
+  set_realtime( -7200 );
+  wait_milliseconds( 100 );
+  rtems_test_assert( signal_count == 2 );
+
+  delete_timer( timer );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  struct sigaction act;
+  int              rv;
+
+  TEST_BEGIN();
+
+  act.sa_handler = signal_handler;
+  act.sa_flags = 0;
+  sigemptyset( &act.sa_mask );
+  rv = sigaction( SIGUSR1, &act, NULL );
+  rtems_test_assert( rv == 0 );
+
+  test_relative_timer();
+  test_absolute_timer();
+  test_periodic_timer();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 1
+#define CONFIGURE_MAXIMUM_POSIX_TIMERS 1
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
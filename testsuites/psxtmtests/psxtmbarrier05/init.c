@@ -0,0 +1,331 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "PSXTMBARRIER 5";
+
+#define SAMPLE_COUNT 10
+
+#define WAITER_MAXIMUM 1000
+
+#define INIT_PRIORITY 1
+
+#define BACKGROUND_PRIORITY 250
+
+typedef enum {
+  VARIANT_BARRIER,
+  VARIANT_SEMAPHORE_PRIORITY,
+  VARIANT_SEMAPHORE_PRIORITY_BIT_MAP
+} test_variant;
+
+typedef struct {
+  test_variant variant;
+  pthread_barrier_t barrier;
+  rtems_id semaphores[ 2 ];
+  rtems_id waiters[ WAITER_MAXIMUM ];
+  uint32_t waiter_count;
+} test_context;
+
+static test_context test_instance;
+
+static const char *test_sep = "";
+
+static rtems_id get_semaphore( const test_context *ctx, test_variant variant )
+{
+  return ctx->semaphores[ variant - VARIANT_SEMAPHORE_PRIORITY ];
+}
+
+static void waiter_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    test_variant variant;
+
+    variant = ctx->variant;
+
+    if ( variant == VARIANT_BARRIER ) {
+      int eno;
+
+      eno = pthread_barrier_wait( &ctx->barrier );
+      rtems_test_assert( eno == 0 || eno == PTHREAD_BARRIER_SERIAL_THREAD );
+    } else {
+      rtems_status_code sc;
+
+      sc = rtems_semaphore_obtain(
+        get_semaphore( ctx, variant ),
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert( sc == RTEMS_UNSATISFIED );
+    }
+  }
+}
+
+static void wait_for_waiters( void )
+{
+  rtems_status_code sc;
+  rtems_task_priority priority;
+
+  /*
+   * Let the released waiters execute until they are blocked again.  The
+   * waiters have a higher priority than the background priority.
+   */
+  sc = rtems_task_set_priority( RTEMS_SELF, BACKGROUND_PRIORITY, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_task_set_priority( RTEMS_SELF, INIT_PRIORITY, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void release_waiters( test_context *ctx, test_variant variant )
+{
+  if ( variant == VARIANT_BARRIER ) {
+    int eno;
+
+    eno = pthread_barrier_wait( &ctx->barrier );
+    rtems_test_assert( eno == PTHREAD_BARRIER_SERIAL_THREAD );
+  } else {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_flush( get_semaphore( ctx, variant ) );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void measure(
+  test_context *ctx,
+  test_variant  variant,
+  const char   *type,
+  uint32_t      waiter_request
+)
+{
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  int      i;
+
+  if ( ctx->variant != variant ) {
+    test_variant previous;
+
+    previous = ctx->variant;
+    ctx->variant = variant;
+    release_waiters( ctx, previous );
+    wait_for_waiters();
+  }
+
+  min = UINT64_MAX;
+  max = 0;
+  sum = 0;
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_counter_ticks begin;
+    rtems_counter_ticks end;
+    uint64_t            delta;
+
+    begin = rtems_counter_read();
+    release_waiters( ctx, variant );
+    end = rtems_counter_read();
+    wait_for_waiters();
+
+    delta = rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference( end, begin )
+    );
+
+    if ( delta < min ) {
+      min = delta;
+    }
+
+    if ( delta > max ) {
+      max = delta;
+    }
+
+    sum += delta;
+  }
+
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"waiter-request\": %" PRIu32 ",\n"
+    "    \"waiters\": %" PRIu32 ",\n"
+    "    \"samples\": %i,\n"
+    "    \"min-ns\": %" PRIu64 ",\n"
+    "    \"max-ns\": %" PRIu64 ",\n"
+    "    \"mean-ns\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    waiter_request,
+    ctx->waiter_count,
+    SAMPLE_COUNT,
+    min,
+    max,
+    sum / SAMPLE_COUNT
+  );
+  test_sep = ", ";
+}
+
+static void run( test_context *ctx, uint32_t waiter_request )
+{
+  rtems_status_code sc;
+  uint32_t          i;
+  int               eno;
+
+  for ( i = 0; i < waiter_request; ++i ) {
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'A', 'I', 'T' ),
+      2 + i % 200,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->waiters[ i ]
+    );
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      /* Measure with the waiters available in this configuration */
+      break;
+    }
+  }
+
+  ctx->waiter_count = i;
+
+  if ( ctx->waiter_count == 0 ) {
+    return;
+  }
+
+  eno = pthread_barrier_init( &ctx->barrier, NULL, ctx->waiter_count + 1 );
+  rtems_test_assert( eno == 0 );
+  ctx->variant = VARIANT_BARRIER;
+
+  for ( i = 0; i < ctx->waiter_count; ++i ) {
+    sc = rtems_task_start( ctx->waiters[ i ], waiter_task, (uintptr_t) ctx );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  wait_for_waiters();
+
+  measure( ctx, VARIANT_BARRIER, "barrier", waiter_request );
+  measure(
+    ctx,
+    VARIANT_SEMAPHORE_PRIORITY,
+    "semaphore-priority",
+    waiter_request
+  );
+  measure(
+    ctx,
+    VARIANT_SEMAPHORE_PRIORITY_BIT_MAP,
+    "semaphore-priority-bit-map",
+    waiter_request
+  );
+
+  /* The waiters are now blocked on a semaphore and not on the barrier */
+  for ( i = 0; i < ctx->waiter_count; ++i ) {
+    sc = rtems_task_delete( ctx->waiters[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  eno = pthread_barrier_destroy( &ctx->barrier );
+  rtems_test_assert( eno == 0 );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  test_context        *ctx;
+  rtems_status_code    sc;
+  rtems_task_priority  priority;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_task_set_priority( RTEMS_SELF, INIT_PRIORITY, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'P', 'R', 'I', 'O' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->semaphores[ 0 ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'P', 'B', 'M', 'P' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY | RTEMS_PRIORITY_BIT_MAP,
+    0,
+    &ctx->semaphores[ 1 ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+  run( ctx, 10 );
+  run( ctx, 100 );
+  run( ctx, WAITER_MAXIMUM );
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  sc = rtems_semaphore_delete( ctx->semaphores[ 0 ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_semaphore_delete( ctx->semaphores[ 1 ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS rtems_resource_unlimited( 32 )
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,288 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <rtems.h>
+
+#if defined(PSXTMHRTIMER02)
+const char rtems_test_name[] = "PSXTMHRTIMER 2";
+#define TIMER_IMPLEMENTATION "clock-tick"
+#else
+const char rtems_test_name[] = "PSXTMHRTIMER 1";
+#define TIMER_IMPLEMENTATION "high-resolution"
+#endif
+
+#define SAMPLE_COUNT 500
+
+#define MINIMUM_DELAY_NS 50000
+
+#define MAXIMUM_DELAY_NS 5000000
+
+#define TIMER_SIGNAL SIGUSR1
+
+static const uint32_t histogram_bounds_us[] = {
+  1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000
+};
+
+typedef struct {
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  uint32_t histogram[ RTEMS_ARRAY_SIZE( histogram_bounds_us ) + 1 ];
+} statistics;
+
+static statistics stats;
+
+static timer_t timer;
+
+static const char *test_sep = "";
+
+static uint64_t timespec_to_ns( const struct timespec *ts )
+{
+  return (uint64_t) ts->tv_sec * 1000000000 + (uint64_t) ts->tv_nsec;
+}
+
+static void ns_to_timespec( uint64_t ns, struct timespec *ts )
+{
+  ts->tv_sec = (time_t) ( ns / 1000000000 );
+  ts->tv_nsec = (long) ( ns % 1000000000 );
+}
+
+static uint64_t now_ns( void )
+{
+  struct timespec now;
+  int eno;
+
+  eno = clock_gettime( CLOCK_MONOTONIC, &now );
+  rtems_test_assert( eno == 0 );
+
+  return timespec_to_ns( &now );
+}
+
+static uint64_t random_delay( void )
+{
+  return MINIMUM_DELAY_NS +
+    (uint64_t) rand() % ( MAXIMUM_DELAY_NS - MINIMUM_DELAY_NS );
+}
+
+static void reset_statistics( void )
+{
+  memset( &stats, 0, sizeof( stats ) );
+  stats.min = UINT64_MAX;
+}
+
+static void add_sample( uint64_t target, uint64_t actual )
+{
+  uint64_t error;
+  size_t i;
+
+  /* A timer shall never expire before its expiration time */
+  rtems_test_assert( actual >= target );
+  error = actual - target;
+
+  if ( error < stats.min ) {
+    stats.min = error;
+  }
+
+  if ( error > stats.max ) {
+    stats.max = error;
+  }
+
+  stats.sum += error;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( histogram_bounds_us ); ++i ) {
+    if ( error < (uint64_t) histogram_bounds_us[ i ] * 1000 ) {
+      break;
+    }
+  }
+
+  ++stats.histogram[ i ];
+}
+
+static void print_result( const char *type )
+{
+  const char *sep;
+  size_t i;
+
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"timers\": \"%s\",\n"
+    "    \"ns-per-tick\": %" PRIu32 ",\n"
+    "    \"samples\": %i,\n"
+    "    \"min-ns\": %" PRIu64 ",\n"
+    "    \"max-ns\": %" PRIu64 ",\n"
+    "    \"mean-ns\": %" PRIu64 ",\n"
+    "    \"histogram-upper-bounds-us\": [",
+    test_sep,
+    type,
+    TIMER_IMPLEMENTATION,
+    rtems_configuration_get_nanoseconds_per_tick(),
+    SAMPLE_COUNT,
+    stats.min,
+    stats.max,
+    stats.sum / SAMPLE_COUNT
+  );
+
+  sep = "";
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( histogram_bounds_us ); ++i ) {
+    printf( "%s%" PRIu32, sep, histogram_bounds_us[ i ] );
+    sep = ", ";
+  }
+
+  printf( "],\n    \"histogram\": [" );
+  sep = "";
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( stats.histogram ); ++i ) {
+    printf( "%s%" PRIu32, sep, stats.histogram[ i ] );
+    sep = ", ";
+  }
+
+  printf( "]\n  }" );
+  test_sep = ", ";
+}
+
+static void test_clock_nanosleep( void )
+{
+  int i;
+
+  reset_statistics();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    struct timespec ts;
+    uint64_t target;
+    int eno;
+
+    target = now_ns() + random_delay();
+    ns_to_timespec( target, &ts );
+    eno = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL );
+    rtems_test_assert( eno == 0 );
+    add_sample( target, now_ns() );
+  }
+
+  print_result( "clock-nanosleep" );
+}
+
+static void test_timer_settime( void )
+{
+  sigset_t set;
+  int i;
+
+  sigemptyset( &set );
+  sigaddset( &set, TIMER_SIGNAL );
+  reset_statistics();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    struct itimerspec value;
+    uint64_t target;
+    int sig;
+    int eno;
+    int rv;
+
+    memset( &value, 0, sizeof( value ) );
+    target = now_ns() + random_delay();
+    ns_to_timespec( target, &value.it_value );
+    rv = timer_settime( timer, TIMER_ABSTIME, &value, NULL );
+    rtems_test_assert( rv == 0 );
+
+    sig = 0;
+    eno = sigwait( &set, &sig );
+    rtems_test_assert( eno == 0 );
+    rtems_test_assert( sig == TIMER_SIGNAL );
+    add_sample( target, now_ns() );
+  }
+
+  print_result( "timer-settime" );
+}
+
+static void *POSIX_Init( void *arg )
+{
+  struct sigevent event;
+  sigset_t set;
+  int eno;
+  int rv;
+
+  TEST_BEGIN();
+
+  sigemptyset( &set );
+  sigaddset( &set, TIMER_SIGNAL );
+  eno = pthread_sigmask( SIG_BLOCK, &set, NULL );
+  rtems_test_assert( eno == 0 );
+
+  memset( &event, 0, sizeof( event ) );
+  event.sigev_notify = SIGEV_SIGNAL;
+  event.sigev_signo = TIMER_SIGNAL;
+  rv = timer_create( CLOCK_MONOTONIC, &event, &timer );
+  rtems_test_assert( rv == 0 );
+
+  srand( 1 );
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+  test_clock_nanosleep();
+  test_timer_settime();
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  rv = timer_delete( timer );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_TIMERS 1
+
+#if !defined(PSXTMHRTIMER02)
+#define CONFIGURE_HIGH_RESOLUTION_TIMERS
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,233 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/posix/pthread.h>
+
+const char rtems_test_name[] = "PSXTMMUTEXSPIN 1";
+
+#define SAMPLE_COUNT 1000
+
+#define HOLD_TIME_NS 2000
+
+typedef struct {
+  pthread_mutex_t mutex;
+  atomic_uint round;
+  atomic_uint locked;
+  atomic_bool done;
+  rtems_counter_ticks release_instant;
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+} test_context;
+
+static test_context test_instance;
+
+static const char *test_sep = "";
+
+static void set_affinity( pthread_t thread, uint32_t cpu_index )
+{
+  cpu_set_t set;
+  int eno;
+
+  CPU_ZERO( &set );
+  CPU_SET( (int) cpu_index, &set );
+  eno = pthread_setaffinity_np( thread, sizeof( set ), &set );
+  rtems_test_assert( eno == 0 );
+}
+
+static void *owner_body( void *arg )
+{
+  test_context *ctx;
+  unsigned int last;
+
+  ctx = arg;
+  last = 0;
+
+  while ( !atomic_load_explicit( &ctx->done, memory_order_acquire ) ) {
+    unsigned int round;
+    int eno;
+
+    round = atomic_load_explicit( &ctx->round, memory_order_acquire );
+
+    if ( round == last ) {
+      continue;
+    }
+
+    last = round;
+    eno = pthread_mutex_lock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+    atomic_store_explicit( &ctx->locked, round, memory_order_release );
+
+    /* Critical section of the owner on the other processor */
+    rtems_counter_delay_nanoseconds( HOLD_TIME_NS );
+
+    ctx->release_instant = rtems_counter_read();
+    eno = pthread_mutex_unlock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+  }
+
+  return NULL;
+}
+
+static void measure( test_context *ctx, const char *type, int mutex_type )
+{
+  pthread_mutexattr_t attr;
+  pthread_t owner;
+  unsigned int round;
+  int eno;
+
+  eno = pthread_mutexattr_init( &attr );
+  rtems_test_assert( eno == 0 );
+  eno = pthread_mutexattr_settype( &attr, mutex_type );
+  rtems_test_assert( eno == 0 );
+  eno = pthread_mutex_init( &ctx->mutex, &attr );
+  rtems_test_assert( eno == 0 );
+  eno = pthread_mutexattr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+
+  atomic_store_explicit( &ctx->round, 0, memory_order_relaxed );
+  atomic_store_explicit( &ctx->locked, 0, memory_order_relaxed );
+  atomic_store_explicit( &ctx->done, false, memory_order_release );
+  ctx->min = UINT64_MAX;
+  ctx->max = 0;
+  ctx->sum = 0;
+
+  eno = pthread_create( &owner, NULL, owner_body, ctx );
+  rtems_test_assert( eno == 0 );
+  set_affinity( owner, 1 );
+
+  for ( round = 1; round <= SAMPLE_COUNT; ++round ) {
+    rtems_counter_ticks acquired;
+    uint64_t latency;
+
+    atomic_store_explicit( &ctx->round, round, memory_order_release );
+
+    while (
+      atomic_load_explicit( &ctx->locked, memory_order_acquire ) != round
+    ) {
+      /* Wait for the owner */
+    }
+
+    /*
+     * The owner releases the mutex after the hold time.  Measure the time
+     * from the release until the mutex is owned by this thread.
+     */
+    eno = pthread_mutex_lock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+    acquired = rtems_counter_read();
+    latency = rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference( acquired, ctx->release_instant )
+    );
+    eno = pthread_mutex_unlock( &ctx->mutex );
+    rtems_test_assert( eno == 0 );
+
+    if ( latency < ctx->min ) {
+      ctx->min = latency;
+    }
+
+    if ( latency > ctx->max ) {
+      ctx->max = latency;
+    }
+
+    ctx->sum += latency;
+  }
+
+  atomic_store_explicit( &ctx->done, true, memory_order_release );
+  eno = pthread_join( owner, NULL );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_destroy( &ctx->mutex );
+  rtems_test_assert( eno == 0 );
+
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"hold-time-ns\": %i,\n"
+    "    \"samples\": %i,\n"
+    "    \"min-ns\": %" PRIu64 ",\n"
+    "    \"max-ns\": %" PRIu64 ",\n"
+    "    \"mean-ns\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    HOLD_TIME_NS,
+    SAMPLE_COUNT,
+    ctx->min,
+    ctx->max,
+    ctx->sum / SAMPLE_COUNT
+  );
+  test_sep = ", ";
+}
+
+static void *POSIX_Init( void *arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  if ( rtems_scheduler_get_processor_maximum() >= 2 ) {
+    set_affinity( pthread_self(), 0 );
+
+    printf( "*** BEGIN OF JSON DATA ***\n[" );
+    measure( ctx, "normal", PTHREAD_MUTEX_NORMAL );
+    measure( ctx, "adaptive", PTHREAD_MUTEX_ADAPTIVE_NP );
+    printf( "\n]\n*** END OF JSON DATA ***\n" );
+  }
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 2
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,438 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/brlock.h>
+#include <rtems/test-info.h>
+#include <rtems/posix/pthread.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPBRLOCK 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 3
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *test_sep;
+  const char *counter_sep;
+  pthread_rwlock_t default_rwlock;
+  pthread_rwlock_t read_mostly_rwlock;
+  rtems_brlock brlock;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return test_duration();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *lock,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long sum = 0;
+  const char *value_sep;
+  size_t i;
+
+  if (active_workers == 1) {
+    printf(
+      "%s{\n"
+      "    \"lock\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      lock
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "%s%lu",
+      value_sep,
+      local_counter
+    );
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"read-locks-per-second\": %lu",
+    sum * rtems_clock_get_ticks_per_second() / test_duration()
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+  }
+}
+
+static void rwlock_body(
+  test_context *ctx,
+  pthread_rwlock_t *rwlock,
+  size_t test,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    int eno;
+
+    eno = pthread_rwlock_rdlock(rwlock);
+    rtems_test_assert(eno == 0);
+
+    eno = pthread_rwlock_unlock(rwlock);
+    rtems_test_assert(eno == 0);
+
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  rwlock_body(ctx, &ctx->default_rwlock, 0, active_workers, worker_index);
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "pthread rwlock default", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  rwlock_body(ctx, &ctx->read_mostly_rwlock, 1, active_workers, worker_index);
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "pthread rwlock read mostly", 1, active_workers);
+}
+
+static void test_2_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 2;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+
+    sc = rtems_brlock_read_lock(&ctx->brlock);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_brlock_read_unlock(&ctx->brlock);
+
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_2_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "brlock", 2, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_2_body,
+    .fini = test_2_fini,
+    .cascade = true
+  }
+};
+
+static void test_rwlockattr_kind(void)
+{
+  pthread_rwlockattr_t attr;
+  int kind;
+  int eno;
+
+  eno = pthread_rwlockattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  kind = -1;
+  eno = pthread_rwlockattr_getkind_np(&attr, &kind);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(kind == PTHREAD_RWLOCK_DEFAULT_NP);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, -1);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_setkind_np(NULL, PTHREAD_RWLOCK_READ_MOSTLY_NP);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_getkind_np(&attr, NULL);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_READ_MOSTLY_NP);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getkind_np(&attr, &kind);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(kind == PTHREAD_RWLOCK_READ_MOSTLY_NP);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_DEFAULT_NP);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getkind_np(&attr, &kind);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(kind == PTHREAD_RWLOCK_DEFAULT_NP);
+
+  eno = pthread_rwlockattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+}
+
+static void test_read_mostly_rwlock(pthread_rwlock_t *rwlock)
+{
+  pthread_rwlockattr_t attr;
+  int eno;
+
+  eno = pthread_rwlockattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_READ_MOSTLY_NP);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_init(rwlock, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_rdlock(rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_tryrdlock(rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_trywrlock(rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = pthread_rwlock_unlock(rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_wrlock(rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_tryrdlock(rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_destroy(rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_unlock(rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void test_brlock(rtems_brlock *lock)
+{
+  rtems_status_code sc;
+
+  sc = rtems_brlock_initialize(lock, "BRL");
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_try_read_lock(lock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_read_lock(lock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_try_write_lock(lock);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_brlock_read_unlock(lock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_read_unlock(lock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_read_unlock(lock);
+  rtems_test_assert(sc == RTEMS_NOT_OWNER_OF_RESOURCE);
+
+  sc = rtems_brlock_write_lock(lock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_brlock_try_read_lock(lock);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_brlock_destroy(lock);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  rtems_brlock_write_unlock(lock);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  int eno;
+
+  test_rwlockattr_kind();
+
+  eno = pthread_rwlock_init(&ctx->default_rwlock, NULL);
+  rtems_test_assert(eno == 0);
+
+  test_read_mostly_rwlock(&ctx->read_mostly_rwlock);
+  test_brlock(&ctx->brlock);
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+
+  eno = pthread_rwlock_destroy(&ctx->default_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_destroy(&ctx->read_mostly_rwlock);
+  rtems_test_assert(eno == 0);
+
+  sc = rtems_brlock_destroy(&ctx->brlock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,343 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPBROADCAST 1";
+
+#define CPU_MAX 32
+
+#define MAIN_PRIORITY 1
+
+#define WAITER_PRIORITY 2
+
+#define SAMPLE_COUNT 100
+
+#define SETTLE_TIME_NS 100000
+
+typedef enum {
+  VARIANT_CLASSIC_BARRIER,
+  VARIANT_POSIX_BARRIER
+} test_variant;
+
+typedef struct {
+  test_variant variant;
+  rtems_id barrier;
+  pthread_barrier_t posix_barrier;
+  uint32_t waiter_count;
+  atomic_uint arrived;
+  atomic_uint woken;
+  bool done;
+  rtems_counter_ticks wake_instants[CPU_MAX];
+  const char *test_sep;
+} test_context;
+
+static test_context test_instance;
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t set;
+
+  CPU_ZERO(&set);
+  CPU_SET((int) cpu_index, &set);
+  sc = rtems_task_set_affinity(id, sizeof(set), &set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_on_barrier(test_context *ctx)
+{
+  if (ctx->variant == VARIANT_CLASSIC_BARRIER) {
+    rtems_status_code sc;
+
+    sc = rtems_barrier_wait(ctx->barrier, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    int eno;
+
+    eno = pthread_barrier_wait(&ctx->posix_barrier);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static void release_barrier(test_context *ctx)
+{
+  if (ctx->variant == VARIANT_CLASSIC_BARRIER) {
+    rtems_status_code sc;
+    uint32_t released;
+
+    sc = rtems_barrier_release(ctx->barrier, &released);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(released == ctx->waiter_count);
+  } else {
+    int eno;
+
+    /* The main task is the last thread which arrives at the barrier */
+    eno = pthread_barrier_wait(&ctx->posix_barrier);
+    rtems_test_assert(eno == PTHREAD_BARRIER_SERIAL_THREAD);
+  }
+}
+
+static void waiter_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t index = (uint32_t) arg;
+
+  while (true) {
+    atomic_fetch_add_explicit(&ctx->arrived, 1, memory_order_release);
+    wait_on_barrier(ctx);
+    ctx->wake_instants[index] = rtems_counter_read();
+    atomic_fetch_add_explicit(&ctx->woken, 1, memory_order_release);
+
+    if (ctx->done) {
+      rtems_task_exit();
+    }
+  }
+}
+
+static void wait_for_arrival(test_context *ctx)
+{
+  while (
+    atomic_load_explicit(&ctx->arrived, memory_order_acquire)
+      != ctx->waiter_count
+  ) {
+    /* Wait */
+  }
+
+  atomic_store_explicit(&ctx->arrived, 0, memory_order_relaxed);
+
+  /* Give the waiters enough time to block on the barrier */
+  rtems_counter_delay_nanoseconds(SETTLE_TIME_NS);
+}
+
+static void wait_for_wake_up(test_context *ctx)
+{
+  while (
+    atomic_load_explicit(&ctx->woken, memory_order_acquire)
+      != ctx->waiter_count
+  ) {
+    /* Wait */
+  }
+
+  atomic_store_explicit(&ctx->woken, 0, memory_order_relaxed);
+}
+
+static void measure(test_context *ctx, test_variant variant, const char *type)
+{
+  rtems_status_code sc;
+  rtems_id waiters[CPU_MAX];
+  uint64_t first_sum;
+  uint64_t last_sum;
+  uint64_t spread_min;
+  uint64_t spread_max;
+  uint64_t spread_sum;
+  uint32_t i;
+  int eno;
+  int sample;
+
+  ctx->variant = variant;
+  ctx->done = false;
+
+  if (variant == VARIANT_CLASSIC_BARRIER) {
+    sc = rtems_barrier_create(
+      rtems_build_name('B', 'A', 'R', 'R'),
+      RTEMS_BARRIER_MANUAL_RELEASE,
+      0,
+      &ctx->barrier
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    eno = pthread_barrier_init(
+      &ctx->posix_barrier,
+      NULL,
+      ctx->waiter_count + 1
+    );
+    rtems_test_assert(eno == 0);
+  }
+
+  /* One waiter on each processor except the processor of the main task */
+  for (i = 0; i < ctx->waiter_count; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'A', 'I', 'T'),
+      WAITER_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &waiters[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    set_affinity(waiters[i], i + 1);
+
+    sc = rtems_task_start(waiters[i], waiter_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  first_sum = 0;
+  last_sum = 0;
+  spread_min = UINT64_MAX;
+  spread_max = 0;
+  spread_sum = 0;
+
+  for (sample = 0; sample < SAMPLE_COUNT; ++sample) {
+    rtems_counter_ticks release_instant;
+    uint64_t first;
+    uint64_t last;
+    uint64_t spread;
+
+    wait_for_arrival(ctx);
+    release_instant = rtems_counter_read();
+    release_barrier(ctx);
+    wait_for_wake_up(ctx);
+
+    first = UINT64_MAX;
+    last = 0;
+
+    for (i = 0; i < ctx->waiter_count; ++i) {
+      uint64_t latency;
+
+      latency = rtems_counter_ticks_to_nanoseconds(
+        rtems_counter_difference(ctx->wake_instants[i], release_instant)
+      );
+
+      if (latency < first) {
+        first = latency;
+      }
+
+      if (latency > last) {
+        last = latency;
+      }
+    }
+
+    first_sum += first;
+    last_sum += last;
+    spread = last - first;
+
+    if (spread < spread_min) {
+      spread_min = spread;
+    }
+
+    if (spread > spread_max) {
+      spread_max = spread;
+    }
+
+    spread_sum += spread;
+  }
+
+  /* Let the waiters exit */
+  wait_for_arrival(ctx);
+  ctx->done = true;
+  release_barrier(ctx);
+  wait_for_wake_up(ctx);
+
+  if (variant == VARIANT_CLASSIC_BARRIER) {
+    sc = rtems_barrier_delete(ctx->barrier);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    eno = pthread_barrier_destroy(&ctx->posix_barrier);
+    rtems_test_assert(eno == 0);
+  }
+
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"waiters\": %" PRIu32 ",\n"
+    "    \"samples\": %i,\n"
+    "    \"first-mean-ns\": %" PRIu64 ",\n"
+    "    \"last-mean-ns\": %" PRIu64 ",\n"
+    "    \"spread-min-ns\": %" PRIu64 ",\n"
+    "    \"spread-max-ns\": %" PRIu64 ",\n"
+    "    \"spread-mean-ns\": %" PRIu64 "\n"
+    "  }",
+    ctx->test_sep,
+    type,
+    ctx->waiter_count,
+    SAMPLE_COUNT,
+    first_sum / SAMPLE_COUNT,
+    last_sum / SAMPLE_COUNT,
+    spread_min,
+    spread_max,
+    spread_sum / SAMPLE_COUNT
+  );
+  ctx->test_sep = ", ";
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count;
+
+  TEST_BEGIN();
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (cpu_count >= 2) {
+    ctx->waiter_count = cpu_count - 1;
+    set_affinity(RTEMS_SELF, 0);
+
+    printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+    ctx->test_sep = "";
+    measure(ctx, VARIANT_CLASSIC_BARRIER, "classic-barrier");
+    measure(ctx, VARIANT_POSIX_BARRIER, "posix-barrier");
+    printf("\n]\n*** END OF JSON DATA ***\n");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_MAX
+
+#define CONFIGURE_MAXIMUM_TASKS (2 * CPU_MAX)
+
+#define CONFIGURE_MAXIMUM_BARRIERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY MAIN_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
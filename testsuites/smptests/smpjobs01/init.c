@@ -0,0 +1,335 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/test-info.h>
+#include <rtems/score/processormaskimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPJOBS 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 16
+
+#define TEST_COUNT 2
+
+typedef struct {
+  unsigned long count;
+  rtems_counter_ticks sum;
+  rtems_counter_ticks max;
+} test_counter;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *test_sep;
+  const char *counter_sep;
+  Processor_mask targets;
+  test_counter counters[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t i;
+
+  /* The actions target exactly the processors of the active workers */
+  _Processor_mask_Zero(&ctx->targets);
+
+  for (i = 0; i < active_workers; ++i) {
+    _Processor_mask_Set(&ctx->targets, (uint32_t) i);
+  }
+
+  return test_duration();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *action,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long count = 0;
+  rtems_counter_ticks sum = 0;
+  rtems_counter_ticks max = 0;
+  const char *value_sep;
+  size_t i;
+
+  if (active_workers == 1) {
+    printf(
+      "%s{\n"
+      "    \"action\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      action
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    const test_counter *counter;
+
+    counter = &ctx->counters[active_workers - 1][test][i];
+    count += counter->count;
+    sum += counter->sum;
+
+    if (counter->max > max) {
+      max = counter->max;
+    }
+
+    printf("%s%lu", value_sep, counter->count);
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"actions-per-second\": %lu,\n"
+    "        \"mean-latency-ns\": %" PRIu64 ",\n"
+    "        \"max-latency-ns\": %" PRIu64,
+    count * rtems_clock_get_ticks_per_second() / test_duration(),
+    count > 0 ? rtems_counter_ticks_to_nanoseconds(sum) / count : 0,
+    rtems_counter_ticks_to_nanoseconds(max)
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+  }
+}
+
+static void action_handler(void *arg)
+{
+  (void) arg;
+}
+
+static void count_action(
+  test_counter *counter,
+  rtems_counter_ticks a,
+  rtems_counter_ticks b
+)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(b, a);
+  ++counter->count;
+  counter->sum += d;
+
+  if (d > counter->max) {
+    counter->max = d;
+  }
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  test_counter counter = { 0, 0, 0 };
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    Per_CPU_Control *cpu_self;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    cpu_self = _Thread_Dispatch_disable();
+    a = rtems_counter_read();
+    _SMP_Multicast_action(&ctx->targets, action_handler, NULL);
+    b = rtems_counter_read();
+    _Thread_Dispatch_enable(cpu_self);
+
+    count_action(&counter, a, b);
+  }
+
+  ctx->counters[active_workers - 1][0][worker_index] = counter;
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "multicast", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  test_counter counter = { 0, 0, 0 };
+  uint32_t next;
+
+  next = (uint32_t) ((worker_index + 1) % active_workers);
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    Per_CPU_Control *cpu_self;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    cpu_self = _Thread_Dispatch_disable();
+    a = rtems_counter_read();
+    _SMP_Unicast_action(next, action_handler, NULL);
+    b = rtems_counter_read();
+    _Thread_Dispatch_enable(cpu_self);
+
+    count_action(&counter, a, b);
+  }
+
+  ctx->counters[active_workers - 1][1][worker_index] = counter;
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(ctx, "unicast", 1, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }
+};
+
+static void test_job_order(void)
+{
+  static const Per_CPU_Job_context context = {
+    .handler = action_handler
+  };
+  Per_CPU_Job jobs[3];
+  Per_CPU_Control *cpu_self;
+  size_t i;
+
+  /* Jobs added without a message are performed with the next message */
+  cpu_self = _Thread_Dispatch_disable();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(jobs); ++i) {
+    jobs[i].context = &context;
+    _Per_CPU_Add_job(cpu_self, &jobs[i]);
+  }
+
+  _SMP_Send_message(cpu_self, SMP_MESSAGE_PERFORM_JOBS);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(jobs); ++i) {
+    _Per_CPU_Wait_for_job(cpu_self, &jobs[i]);
+  }
+
+  _Thread_Dispatch_enable(cpu_self);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  test_job_order();
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
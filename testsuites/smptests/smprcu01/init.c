@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/rcu.h>
+#include <rtems/test-info.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPRCU 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define OBJECT_COUNT 2
+
+typedef struct {
+  unsigned long value;
+} test_object;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  test_object objects[OBJECT_COUNT];
+  test_object *current;
+  unsigned long updates;
+  unsigned long reads[CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void updater(test_context *ctx)
+{
+  unsigned long value = 1;
+  size_t index = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    test_object *next;
+    test_object *previous;
+
+    index = (index + 1) % OBJECT_COUNT;
+    next = &ctx->objects[index];
+    rtems_test_assert(next->value == 0);
+
+    ++value;
+    next->value = value;
+    previous = ctx->current;
+    RTEMS_RCU_PUBLISH(&ctx->current, next);
+
+    rtems_rcu_synchronize();
+
+    /* No reader shall observe the reclaimed object */
+    previous->value = 0;
+    ++ctx->updates;
+  }
+}
+
+static void reader(test_context *ctx, size_t worker_index)
+{
+  unsigned long reads = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    test_object *object;
+    unsigned long value;
+    int i;
+
+    rtems_rcu_read_lock();
+    object = RTEMS_RCU_DEREFERENCE(&ctx->current);
+    value = object->value;
+    rtems_test_assert(value != 0);
+
+    for (i = 0; i < 100; ++i) {
+      rtems_test_assert(object->value == value);
+    }
+
+    rtems_rcu_read_unlock();
+    ++reads;
+  }
+
+  ctx->reads[worker_index] = reads;
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  if (rtems_test_parallel_is_master_worker(worker_index)) {
+    updater(ctx);
+  } else {
+    reader(ctx, worker_index);
+  }
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t i;
+
+  printf("updates: %lu\n", ctx->updates);
+
+  for (i = 1; i < active_workers; ++i) {
+    printf("reads on worker %zu: %lu\n", i, ctx->reads[i]);
+  }
+}
+
+static const rtems_test_parallel_job test_jobs[] = {
+  {
+    .init = test_init,
+    .body = test_body,
+    .fini = test_fini
+  }
+};
+
+static void test_nesting(void)
+{
+  test_context *ctx = &test_instance;
+  test_object *object;
+
+  rtems_rcu_read_lock();
+  rtems_rcu_read_lock();
+  object = RTEMS_RCU_DEREFERENCE(&ctx->current);
+  rtems_test_assert(object == &ctx->objects[0]);
+  rtems_rcu_read_unlock();
+  rtems_test_assert(object->value == 1);
+  rtems_rcu_read_unlock();
+
+  rtems_rcu_synchronize();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  ctx->objects[0].value = 1;
+  RTEMS_RCU_PUBLISH(&ctx->current, &ctx->objects[0]);
+
+  test_nesting();
+  rtems_test_parallel(
+    &ctx->base,
+    NULL,
+    &test_jobs[0],
+    RTEMS_ARRAY_SIZE(test_jobs)
+  );
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <tmacros.h>
+
+#define FATAL_ERROR_TEST_NAME            "37"
+#define FATAL_ERROR_DESCRIPTION          "double free of a cached memory area"
+#define FATAL_ERROR_EXPECTED_SOURCE      RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE
+#define FATAL_ERROR_EXPECTED_ERROR_CHECK spfatal37_is_expected_error
+
+static void *volatile spfatal37_area;
+
+static inline bool spfatal37_is_expected_error( rtems_fatal_code error )
+{
+  return error == (rtems_fatal_code) spfatal37_area;
+}
+
+/*
+ * Disable for the specific test case.
+ */
+#pragma GCC diagnostic ignored "-Wuse-after-free"
+
+static void force_error(void)
+{
+  void *p;
+
+  p = malloc(32);
+  rtems_test_assert(p != NULL);
+  spfatal37_area = p;
+
+  /* The first free puts the memory area into the per-processor cache */
+  free(p);
+  free(p);
+}
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#include "../spfatal_support/spfatalimpl.h"
@@ -0,0 +1,369 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <string.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SPMSGQREF 1";
+
+#define BUFFER_COUNT 4
+
+#define BUFFER_SIZE 1024
+
+#define MESSAGE_COUNT 16
+
+static RTEMS_MESSAGE_QUEUE_BUFFER( sizeof( rtems_message_queue_reference ) )
+  queue_buffers[ BUFFER_COUNT ];
+
+static RTEMS_MESSAGE_QUEUE_BUFFER( sizeof( rtems_message_queue_reference ) )
+  copy_queue_buffers[ BUFFER_COUNT ];
+
+static long partition_area[ BUFFER_COUNT * BUFFER_SIZE / sizeof( long ) ];
+
+static rtems_id partition;
+
+static rtems_status_code try_construct_queue(
+  void *storage_area,
+  size_t storage_size,
+  size_t maximum_message_size,
+  rtems_attribute attributes,
+  rtems_id *id
+)
+{
+  rtems_message_queue_config config = {
+    .name = rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    .maximum_pending_messages = BUFFER_COUNT,
+    .maximum_message_size = maximum_message_size,
+    .storage_area = storage_area,
+    .storage_size = storage_size,
+    .attributes = attributes
+  };
+
+  return rtems_message_queue_construct( &config, id );
+}
+
+static rtems_id construct_queue(
+  void *storage_area,
+  size_t storage_size,
+  size_t maximum_message_size,
+  rtems_attribute attributes
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = try_construct_queue(
+    storage_area,
+    storage_size,
+    maximum_message_size,
+    attributes,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_queue( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void producer_task( rtems_task_argument arg )
+{
+  rtems_id id;
+  uint32_t i;
+
+  id = (rtems_id) arg;
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    rtems_status_code sc;
+    void *buffer;
+
+    sc = rtems_partition_get_buffer( partition, &buffer );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    memset( buffer, (int) i, BUFFER_SIZE );
+
+    sc = rtems_message_queue_send_reference( id, buffer, BUFFER_SIZE - i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  rtems_task_exit();
+}
+
+static void test_transfer( rtems_attribute attributes )
+{
+  rtems_status_code sc;
+  rtems_id id;
+  rtems_id task;
+  void *begin;
+  size_t size;
+  uint32_t i;
+
+  id = construct_queue(
+    queue_buffers,
+    sizeof( queue_buffers ),
+    sizeof( rtems_message_queue_reference ),
+    attributes | RTEMS_MESSAGE_REFERENCE
+  );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'O', 'D' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( task, producer_task, (rtems_task_argument) id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    unsigned char *buffer;
+    size_t j;
+
+    sc = rtems_message_queue_receive_reference(
+      id,
+      &begin,
+      &size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( size == BUFFER_SIZE - i );
+
+    buffer = begin;
+    rtems_test_assert( buffer >= (unsigned char *) &partition_area[ 0 ] );
+    rtems_test_assert(
+      buffer < (unsigned char *) &partition_area[
+        RTEMS_ARRAY_SIZE( partition_area )
+      ]
+    );
+
+    for ( j = 0; j < BUFFER_SIZE; ++j ) {
+      rtems_test_assert( buffer[ j ] == (unsigned char) i );
+    }
+
+    sc = rtems_partition_return_buffer( partition, buffer );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_message_queue_receive_reference(
+    id,
+    &begin,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  delete_queue( id );
+}
+
+static void test_errors( void )
+{
+  rtems_status_code sc;
+  rtems_id id;
+  rtems_id copy_id;
+  void *begin;
+  size_t size;
+  uint32_t count;
+  char message[ sizeof( rtems_message_queue_reference ) ];
+
+  sc = try_construct_queue(
+    copy_queue_buffers,
+    sizeof( copy_queue_buffers ),
+    sizeof( rtems_message_queue_reference ) - 1,
+    RTEMS_MESSAGE_REFERENCE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  id = construct_queue(
+    queue_buffers,
+    sizeof( queue_buffers ),
+    sizeof( rtems_message_queue_reference ),
+    RTEMS_MESSAGE_REFERENCE
+  );
+
+  /*
+   * A copy queue with a maximum message size equal to the size of a reference
+   * shall not pass references.
+   */
+  copy_id = construct_queue(
+    copy_queue_buffers,
+    sizeof( copy_queue_buffers ),
+    sizeof( rtems_message_queue_reference ),
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+
+  sc = rtems_message_queue_send_reference( id, NULL, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_reference( 0, message, sizeof( message ) );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_message_queue_send_reference(
+    copy_id,
+    message,
+    sizeof( message )
+  );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_receive_reference(
+    id,
+    NULL,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive_reference(
+    id,
+    &begin,
+    NULL,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive_reference(
+    0,
+    &begin,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_message_queue_send( copy_id, message, sizeof( message ) );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_reference(
+    copy_id,
+    &begin,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_get_number_pending( copy_id, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 1 );
+
+  /* The copy directives shall reject a reference queue */
+  sc = rtems_message_queue_send( id, message, sizeof( message ) );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_urgent( id, message, sizeof( message ) );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_broadcast( id, message, sizeof( message ), &count );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_receive(
+    id,
+    message,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_get_number_pending( id, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 0 );
+
+  sc = rtems_message_queue_receive_reference(
+    id,
+    &begin,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  delete_queue( copy_id );
+  delete_queue( id );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_partition_create(
+    rtems_build_name( 'P', 'A', 'R', 'T' ),
+    partition_area,
+    sizeof( partition_area ),
+    BUFFER_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &partition
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_errors();
+  test_transfer( RTEMS_DEFAULT_ATTRIBUTES );
+  test_transfer( RTEMS_SINGLE_CONSUMER );
+  test_transfer( RTEMS_SINGLE_CONSUMER | RTEMS_SINGLE_PRODUCER );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 2
+
+#define CONFIGURE_MAXIMUM_PARTITIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
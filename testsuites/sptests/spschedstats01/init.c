@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/schedulerstats.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPSCHEDSTATS 1";
+
+#define MAIN_PRIORITY 10
+
+#define WORKER_PRIORITY 5
+
+#define WAKE_UP_COUNT 10
+
+static volatile uint32_t worker_counter;
+
+static void worker_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    rtems_event_set events;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++worker_counter;
+  }
+}
+
+static uint32_t histogram_sum(
+  const rtems_scheduler_latency_histogram *histogram
+)
+{
+  uint32_t sum;
+  size_t i;
+
+  sum = 0;
+
+  for (i = 0; i < RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT; ++i) {
+    sum += histogram->counts[i];
+  }
+
+  return sum;
+}
+
+static void test_invalid_parameters(rtems_id scheduler_id)
+{
+  rtems_scheduler_statistics statistics;
+  rtems_scheduler_latency_histogram histogram;
+  rtems_status_code sc;
+
+  sc = rtems_scheduler_get_statistics(scheduler_id, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_scheduler_get_statistics(0, &statistics);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_scheduler_get_latency_histogram(scheduler_id, 0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_scheduler_get_latency_histogram(0, 0, &histogram);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_scheduler_get_latency_histogram(
+    scheduler_id,
+    RTEMS_SCHEDULER_STATISTICS_PRIORITY_COUNT,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_PRIORITY);
+
+  sc = rtems_scheduler_reset_statistics(0);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void test_bucket_bounds(void)
+{
+  uint32_t bucket;
+
+  rtems_test_assert(rtems_scheduler_latency_bucket_lower_bound(0) == 0);
+
+  for (
+    bucket = 1;
+    bucket < RTEMS_SCHEDULER_STATISTICS_BUCKET_COUNT;
+    ++bucket
+  ) {
+    rtems_test_assert(
+      rtems_scheduler_latency_bucket_lower_bound(bucket - 1)
+        <= rtems_scheduler_latency_bucket_lower_bound(bucket)
+    );
+  }
+}
+
+static void test_wake_ups(rtems_id scheduler_id)
+{
+  rtems_scheduler_statistics statistics;
+  rtems_scheduler_latency_histogram histogram;
+  rtems_status_code sc;
+  rtems_id worker_id;
+  uint32_t i;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    WORKER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(worker_id, worker_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(worker_counter == 0);
+
+  sc = rtems_scheduler_reset_statistics(scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_get_statistics(scheduler_id, &statistics);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(statistics.unblocks == 0);
+  rtems_test_assert(statistics.preemptions == 0);
+
+  sc = rtems_scheduler_get_latency_histogram(
+    scheduler_id,
+    WORKER_PRIORITY,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(histogram_sum(&histogram) == 0);
+
+  for (i = 1; i <= WAKE_UP_COUNT; ++i) {
+    sc = rtems_event_send(worker_id, RTEMS_EVENT_0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(worker_counter == i);
+  }
+
+  sc = rtems_scheduler_get_statistics(scheduler_id, &statistics);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(statistics.unblocks >= WAKE_UP_COUNT);
+  rtems_test_assert(statistics.blocks >= WAKE_UP_COUNT);
+  rtems_test_assert(statistics.preemptions >= WAKE_UP_COUNT);
+  rtems_test_assert(statistics.switches >= 2 * WAKE_UP_COUNT);
+
+  sc = rtems_scheduler_get_latency_histogram(
+    scheduler_id,
+    WORKER_PRIORITY,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(histogram_sum(&histogram) == WAKE_UP_COUNT);
+
+  sc = rtems_task_delete(worker_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_disabled(rtems_id scheduler_id)
+{
+  rtems_scheduler_latency_histogram histogram;
+  rtems_status_code sc;
+
+  sc = rtems_scheduler_get_latency_histogram(
+    scheduler_id,
+    WORKER_PRIORITY,
+    &histogram
+  );
+  rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+
+  sc = rtems_scheduler_reset_statistics(scheduler_id);
+  rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_scheduler_statistics statistics;
+  rtems_status_code sc;
+  rtems_id scheduler_id;
+  int rv;
+
+  TEST_BEGIN();
+
+  sc = rtems_task_get_scheduler(RTEMS_SELF, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_invalid_parameters(scheduler_id);
+  test_bucket_bounds();
+
+  sc = rtems_scheduler_get_statistics(scheduler_id, &statistics);
+
+  if (sc == RTEMS_SUCCESSFUL) {
+    test_wake_ups(scheduler_id);
+  } else {
+    rtems_test_assert(sc == RTEMS_NOT_IMPLEMENTED);
+    test_disabled(scheduler_id);
+  }
+
+  rv = rtems_scheduler_statistics_report(&rtems_test_printer);
+  rtems_test_assert(rv > 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY MAIN_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
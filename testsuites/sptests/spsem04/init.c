@@ -0,0 +1,247 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+const char rtems_test_name[] = "SPSEM 4";
+
+#define PRIO_HIGH 3
+
+#define PRIO_A 5
+
+#define PRIO_B 6
+
+#define PRIO_INIT 10
+
+typedef struct {
+  rtems_id a;
+  rtems_id b;
+  rtems_id high;
+  rtems_id counting;
+  rtems_id mutex;
+  rtems_interval high_timeout;
+  rtems_status_code high_status;
+  size_t wake_up_count;
+  rtems_id wake_ups[4];
+} test_context;
+
+static test_context test_instance;
+
+static void assert_prio(rtems_id task_id, rtems_task_priority expected_prio)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  sc = rtems_task_set_priority(task_id, RTEMS_CURRENT_PRIORITY, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(prio == expected_prio);
+}
+
+static void create_task(rtems_id *id, rtems_task_priority prio)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    prio,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void start_task(rtems_id id, rtems_task_entry entry)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_start(id, entry, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void obtain(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void release(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_release(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void woken_up(test_context *ctx)
+{
+  rtems_test_assert(ctx->wake_up_count < RTEMS_ARRAY_SIZE(ctx->wake_ups));
+  ctx->wake_ups[ctx->wake_up_count] = rtems_task_self();
+  ++ctx->wake_up_count;
+}
+
+static void assert_wake_up(test_context *ctx, rtems_id expected_id)
+{
+  size_t count;
+
+  count = ctx->wake_up_count;
+  release(ctx->counting);
+  rtems_test_assert(ctx->wake_up_count == count + 1);
+  rtems_test_assert(ctx->wake_ups[count] == expected_id);
+}
+
+static void a_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    obtain(ctx->counting);
+    woken_up(ctx);
+  }
+}
+
+static void b_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    obtain(ctx->mutex);
+    obtain(ctx->counting);
+    woken_up(ctx);
+    release(ctx->mutex);
+  }
+}
+
+static void high_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_obtain(ctx->mutex, RTEMS_WAIT, ctx->high_timeout);
+    ctx->high_status = sc;
+
+    if (sc == RTEMS_SUCCESSFUL) {
+      release(ctx->mutex);
+    }
+
+    rtems_task_suspend(RTEMS_SELF);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  create_task(&ctx->a, PRIO_A);
+  create_task(&ctx->b, PRIO_B);
+  create_task(&ctx->high, PRIO_HIGH);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('C', 'N', 'T', ' '),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY | RTEMS_PRIORITY_BIT_MAP,
+    0,
+    &ctx->counting
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'T', 'X', ' '),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_INHERIT_PRIORITY | RTEMS_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Task A waits first, then task B waits while it owns the mutex */
+  start_task(ctx->a, a_task);
+  start_task(ctx->b, b_task);
+  assert_prio(ctx->b, PRIO_B);
+
+  /*
+   * The high priority task blocks on the mutex and task B inherits its
+   * priority while it waits on the counting semaphore.  Task B must be moved
+   * to the bucket of its new priority, so that it is dequeued before task A.
+   */
+  ctx->high_timeout = RTEMS_NO_TIMEOUT;
+  start_task(ctx->high, high_task);
+  assert_prio(ctx->b, PRIO_HIGH);
+  assert_wake_up(ctx, ctx->b);
+  rtems_test_assert(ctx->high_status == RTEMS_SUCCESSFUL);
+  assert_prio(ctx->b, PRIO_B);
+  assert_wake_up(ctx, ctx->a);
+
+  /*
+   * Task B waits again while it owns the mutex.  It inherits the priority of
+   * the high priority task and loses it again due to the timeout of the high
+   * priority task.  Task B must be moved back to the bucket of its real
+   * priority, so that task A is dequeued first.
+   */
+  ctx->high_timeout = 2;
+  sc = rtems_task_resume(ctx->high);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  assert_prio(ctx->b, PRIO_HIGH);
+
+  sc = rtems_task_wake_after(4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->high_status == RTEMS_TIMEOUT);
+  assert_prio(ctx->b, PRIO_B);
+  assert_wake_up(ctx, ctx->a);
+  assert_wake_up(ctx, ctx->b);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
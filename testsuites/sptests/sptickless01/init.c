@@ -0,0 +1,204 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <time.h>
+
+#include <rtems.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPTICKLESS 1";
+
+#define TIMER_EVENT RTEMS_EVENT_0
+
+typedef struct {
+  rtems_id init_task;
+  rtems_id timer;
+  rtems_interval fired;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval ticks( void )
+{
+  return rtems_clock_get_ticks_since_boot();
+}
+
+static void wait_for_tick( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after( 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void check_ticks_and_uptime(
+  rtems_interval ticks_begin,
+  uint64_t uptime_begin
+)
+{
+  rtems_interval elapsed_ticks;
+  uint64_t elapsed_uptime;
+  uint64_t ns_per_tick;
+
+  elapsed_ticks = ticks() - ticks_begin;
+  elapsed_uptime = rtems_clock_get_uptime_nanoseconds() - uptime_begin;
+  ns_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+
+  /*
+   * The ticks since boot shall be in line with the uptime even if clock ticks
+   * were skipped.
+   */
+  rtems_test_assert(
+    elapsed_uptime + 2 * ns_per_tick >= elapsed_ticks * ns_per_tick
+  );
+  rtems_test_assert(
+    elapsed_ticks * ns_per_tick + 2 * ns_per_tick >= elapsed_uptime
+  );
+}
+
+static void test_wake_after( void )
+{
+  rtems_status_code sc;
+  rtems_interval begin;
+  uint64_t uptime;
+  int i;
+
+  for ( i = 1; i <= 64; i *= 2 ) {
+    wait_for_tick();
+    begin = ticks();
+    uptime = rtems_clock_get_uptime_nanoseconds();
+
+    sc = rtems_task_wake_after( (rtems_interval) i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    rtems_test_assert( ticks() - begin == (rtems_interval) i );
+    check_ticks_and_uptime( begin, uptime );
+  }
+}
+
+static void timer_routine( rtems_id timer, void *arg )
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = arg;
+  ctx->fired = ticks();
+  sc = rtems_event_send( ctx->init_task, TIMER_EVENT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_timer( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_interval begin;
+  uint64_t uptime;
+
+  wait_for_tick();
+  begin = ticks();
+  uptime = rtems_clock_get_uptime_nanoseconds();
+
+  sc = rtems_timer_fire_after( ctx->timer, 37, timer_routine, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Block without a timeout, so that only the timer limits an idle period */
+  events = 0;
+  sc = rtems_event_receive(
+    TIMER_EVENT,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( events == TIMER_EVENT );
+  rtems_test_assert( ctx->fired == begin + 37 );
+  check_ticks_and_uptime( begin, uptime );
+}
+
+static void test_monotonic_sleep( void )
+{
+  struct timespec delay;
+  uint64_t begin;
+  uint64_t end;
+  int eno;
+
+  delay.tv_sec = 0;
+  delay.tv_nsec = 50000000;
+  begin = rtems_clock_get_uptime_nanoseconds();
+  eno = clock_nanosleep( CLOCK_MONOTONIC, 0, &delay, NULL );
+  rtems_test_assert( eno == 0 );
+  end = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert( end - begin >= 50000000 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+  ctx->init_task = rtems_task_self();
+
+  sc = rtems_timer_create(
+    rtems_build_name( 'T', 'I', 'M', 'R' ),
+    &ctx->timer
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_wake_after();
+  test_timer( ctx );
+  test_monotonic_sleep();
+
+  sc = rtems_timer_delete( ctx->timer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_TICKLESS_IDLE
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
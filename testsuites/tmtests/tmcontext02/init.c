@@ -0,0 +1,196 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMCONTEXT 2";
+
+#define SWITCH_COUNT 10000
+
+#define TASK_PRIORITY 2
+
+#if defined(AARCH64_USE_LAZY_FP_SWITCH) || \
+  defined(SPARC_USE_LAZY_FP_SWITCH) || CPU_USE_DEFERRED_FP_SWITCH == TRUE
+#define FP_SWITCH "lazy"
+#else
+#define FP_SWITCH "eager"
+#endif
+
+typedef struct {
+  volatile bool done;
+  bool init_uses_fp;
+  bool partner_uses_fp;
+} test_context;
+
+static test_context test_instance;
+
+static volatile double fp_value = 1.0;
+
+static const char *test_sep = "";
+
+static void use_fp( void )
+{
+  fp_value *= 1.0009765625;
+}
+
+static void yield( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void partner_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( !ctx->done ) {
+    if ( ctx->partner_uses_fp ) {
+      use_fp();
+    }
+
+    yield();
+  }
+
+  rtems_task_exit();
+}
+
+static void test(
+  test_context *ctx,
+  const char *type,
+  bool init_uses_fp,
+  bool partner_uses_fp
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  uint32_t i;
+
+  ctx->done = false;
+  ctx->init_uses_fp = init_uses_fp;
+  ctx->partner_uses_fp = partner_uses_fp;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'A', 'R', 'T' ),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_FLOATING_POINT,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, partner_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Let the partner task reach its loop */
+  yield();
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SWITCH_COUNT; ++i ) {
+    if ( ctx->init_uses_fp ) {
+      use_fp();
+    }
+
+    yield();
+  }
+
+  b = rtems_counter_read();
+
+  ctx->done = true;
+  yield();
+
+  /* Each yield switches to the partner task and back */
+  d = rtems_counter_difference( b, a );
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"fp-switch\": \"" FP_SWITCH "\",\n"
+    "    \"switches\": %" PRIu32 ",\n"
+    "    \"ticks-per-switch\": %" PRIu64 ",\n"
+    "    \"ns-per-switch\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    2 * SWITCH_COUNT,
+    (uint64_t) d / ( 2 * SWITCH_COUNT ),
+    rtems_counter_ticks_to_nanoseconds( d ) / ( 2 * SWITCH_COUNT )
+  );
+  test_sep = ", ";
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+  test( ctx, "no-fp", false, false );
+  test( ctx, "one-fp", true, false );
+  test( ctx, "both-fp", true, true );
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,252 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE ( 256 * 1024 )
+
+#define SMALL_SIZE 24
+
+#define LARGE_SIZE 96
+
+#define SAMPLE_COUNT 100
+
+typedef struct {
+  Heap_Control heap;
+  Heap_Segregated_index index;
+  void *blocks[ AREA_SIZE / ( SMALL_SIZE + LARGE_SIZE ) ];
+  size_t block_count;
+  char area[ AREA_SIZE ] RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT );
+} test_context;
+
+static test_context test_instance;
+
+static void fragment(test_context *ctx)
+{
+  size_t i;
+
+  /*
+   * Fill the heap with alternating small and large blocks.  Free all but a
+   * reserve of the small blocks afterwards, so that the free list contains
+   * many small blocks which are too small for the sample allocations.
+   */
+  ctx->block_count = 0;
+
+  while (ctx->block_count < RTEMS_ARRAY_SIZE(ctx->blocks)) {
+    uintptr_t size;
+    void *p;
+
+    if (ctx->block_count % 2 == 0) {
+      size = SMALL_SIZE;
+    } else {
+      size = LARGE_SIZE;
+    }
+
+    p = _Heap_Allocate(&ctx->heap, size);
+    if (p == NULL) {
+      break;
+    }
+
+    ctx->blocks[ctx->block_count] = p;
+    ++ctx->block_count;
+  }
+
+  for (i = 0; i < ctx->block_count; i += 2) {
+    rtems_test_assert(_Heap_Free(&ctx->heap, ctx->blocks[i]));
+    ctx->blocks[i] = NULL;
+  }
+
+  /* Provide room for the sample allocations at the end of the heap */
+  i = ctx->block_count - 1;
+  i -= ( i + 1 ) % 2;
+
+  while (i > ctx->block_count - 8) {
+    rtems_test_assert(_Heap_Free(&ctx->heap, ctx->blocks[i]));
+    ctx->blocks[i] = NULL;
+    i -= 2;
+  }
+}
+
+static void cleanup(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < ctx->block_count; ++i) {
+    rtems_test_assert(_Heap_Free(&ctx->heap, ctx->blocks[i]));
+  }
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+}
+
+static void measure(test_context *ctx, uintptr_t size, const char *name)
+{
+  rtems_counter_ticks max_alloc;
+  rtems_counter_ticks max_free;
+  uint64_t sum_alloc;
+  uint64_t sum_free;
+  size_t i;
+
+  max_alloc = 0;
+  max_free = 0;
+  sum_alloc = 0;
+  sum_free = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+    rtems_counter_ticks d;
+    void *p;
+    bool ok;
+
+    rtems_interrupt_local_disable(level);
+    a = rtems_counter_read();
+    p = _Heap_Allocate(&ctx->heap, size);
+    b = rtems_counter_read();
+    ok = _Heap_Free(&ctx->heap, p);
+    c = rtems_counter_read();
+    rtems_interrupt_local_enable(level);
+
+    rtems_test_assert(p != NULL);
+    rtems_test_assert(ok);
+
+    d = rtems_counter_difference(b, a);
+    sum_alloc += d;
+
+    if (d > max_alloc) {
+      max_alloc = d;
+    }
+
+    d = rtems_counter_difference(c, b);
+    sum_free += d;
+
+    if (d > max_free) {
+      max_free = d;
+    }
+  }
+
+  printf(
+    ",\n      \"%s\": {\n"
+    "        \"alloc-max\": %" PRIu64 ",\n"
+    "        \"alloc-avg\": %" PRIu64 ",\n"
+    "        \"free-max\": %" PRIu64 ",\n"
+    "        \"free-avg\": %" PRIu64 "\n"
+    "      }",
+    name,
+    rtems_counter_ticks_to_nanoseconds(max_alloc),
+    rtems_counter_ticks_to_nanoseconds(sum_alloc / SAMPLE_COUNT),
+    rtems_counter_ticks_to_nanoseconds(max_free),
+    rtems_counter_ticks_to_nanoseconds(sum_free / SAMPLE_COUNT)
+  );
+}
+
+static void test_heap(test_context *ctx, bool segregated, const char *sep)
+{
+  uintptr_t size;
+  Heap_Information_block info;
+
+  size = _Heap_Initialize(&ctx->heap, ctx->area, sizeof(ctx->area), 0);
+  rtems_test_assert(size > 0);
+
+  if (segregated) {
+    _Heap_Enable_segregated_fit(&ctx->heap, &ctx->index);
+  }
+
+  fragment(ctx);
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+  _Heap_Get_information(&ctx->heap, &info);
+
+  printf(
+    "%s{\n"
+    "      \"method\": \"%s\",\n"
+    "      \"free-blocks\": %" PRIuPTR,
+    sep,
+    segregated ? "segregated-fit" : "first-fit",
+    info.Free.number
+  );
+
+  measure(ctx, SMALL_SIZE, "small");
+  measure(ctx, LARGE_SIZE, "large");
+  measure(ctx, 2 * LARGE_SIZE, "huge");
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+  cleanup(ctx);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  test_heap(ctx, false, "\n    ");
+  test_heap(ctx, true, "\n    }, ");
+
+  printf("\n    }\n  ]\n}\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,322 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+#define MESSAGE_SIZE 16
+
+#define QUEUE_SIZE 64
+
+#define BATCH_COUNT 1000
+
+#define CROSS_CORE_MESSAGE_COUNT 100000
+
+typedef struct {
+  uint32_t sequence;
+  uint32_t payload[ MESSAGE_SIZE / sizeof( uint32_t ) - 1 ];
+} test_message;
+
+RTEMS_STATIC_ASSERT( sizeof( test_message ) == MESSAGE_SIZE, test_message );
+
+typedef struct {
+  const char *name;
+  rtems_attribute attributes;
+} test_variant;
+
+static const test_variant test_variants[] = {
+  { "default", RTEMS_DEFAULT_ATTRIBUTES },
+  { "spsc", RTEMS_SINGLE_CONSUMER | RTEMS_SINGLE_PRODUCER },
+  { "mpsc", RTEMS_SINGLE_CONSUMER }
+};
+
+static RTEMS_MESSAGE_QUEUE_BUFFER( MESSAGE_SIZE ) buffers[ QUEUE_SIZE ];
+
+static const char *test_sep = "";
+
+static rtems_id create_queue( const test_variant *variant )
+{
+  rtems_message_queue_config config = {
+    .name = rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    .maximum_pending_messages = RTEMS_ARRAY_SIZE( buffers ),
+    .maximum_message_size = MESSAGE_SIZE,
+    .storage_area = buffers,
+    .storage_size = sizeof( buffers ),
+    .attributes = variant->attributes
+  };
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_message_queue_construct( &config, &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_queue( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void print_result(
+  const char *type,
+  const test_variant *variant,
+  rtems_counter_ticks ticks,
+  uint32_t count
+)
+{
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"queue\": \"%s\",\n"
+    "    \"messages\": %" PRIu32 ",\n"
+    "    \"ticks-per-message\": %" PRIu64 ",\n"
+    "    \"ns-per-message\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    variant->name,
+    count,
+    (uint64_t) ticks / count,
+    rtems_counter_ticks_to_nanoseconds( ticks ) / count
+  );
+  test_sep = ", ";
+}
+
+static void test_uncontended( const test_variant *variant )
+{
+  rtems_id id;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  test_message msg;
+  uint32_t expected;
+  uint32_t i;
+
+  id = create_queue( variant );
+  msg.sequence = 0;
+  expected = 0;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < BATCH_COUNT; ++i ) {
+    uint32_t j;
+
+    for ( j = 0; j < QUEUE_SIZE; ++j ) {
+      rtems_status_code sc;
+
+      sc = rtems_message_queue_send( id, &msg, sizeof( msg ) );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      ++msg.sequence;
+    }
+
+    for ( j = 0; j < QUEUE_SIZE; ++j ) {
+      rtems_status_code sc;
+      size_t size;
+
+      sc = rtems_message_queue_receive(
+        id,
+        &msg,
+        &size,
+        RTEMS_NO_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( size == sizeof( msg ) );
+      rtems_test_assert( msg.sequence == expected );
+      ++expected;
+    }
+
+    msg.sequence = expected;
+  }
+
+  b = rtems_counter_read();
+
+  delete_queue( id );
+  print_result(
+    "uncontended",
+    variant,
+    rtems_counter_difference( b, a ),
+    BATCH_COUNT * QUEUE_SIZE
+  );
+}
+
+#if defined(RTEMS_SMP)
+static void set_affinity( rtems_id task, uint32_t cpu_index )
+{
+  rtems_status_code sc;
+  cpu_set_t set;
+
+  CPU_ZERO( &set );
+  CPU_SET( (int) cpu_index, &set );
+  sc = rtems_task_set_affinity( task, sizeof( set ), &set );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void producer_task( rtems_task_argument arg )
+{
+  rtems_id id;
+  test_message msg;
+
+  id = (rtems_id) arg;
+  msg.sequence = 0;
+
+  while ( msg.sequence < CROSS_CORE_MESSAGE_COUNT ) {
+    rtems_status_code sc;
+
+    sc = rtems_message_queue_send( id, &msg, sizeof( msg ) );
+
+    if ( sc == RTEMS_SUCCESSFUL ) {
+      ++msg.sequence;
+    } else {
+      rtems_test_assert( sc == RTEMS_TOO_MANY );
+    }
+  }
+
+  rtems_task_exit();
+}
+
+static void test_cross_core( const test_variant *variant )
+{
+  rtems_status_code sc;
+  rtems_id id;
+  rtems_id task;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  id = create_queue( variant );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'O', 'D' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  set_affinity( task, 1 );
+
+  a = rtems_counter_read();
+
+  sc = rtems_task_start( task, producer_task, (rtems_task_argument) id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < CROSS_CORE_MESSAGE_COUNT; ++i ) {
+    test_message msg;
+    size_t size;
+
+    sc = rtems_message_queue_receive(
+      id,
+      &msg,
+      &size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( size == sizeof( msg ) );
+    rtems_test_assert( msg.sequence == i );
+  }
+
+  b = rtems_counter_read();
+
+  /* Wait for the producer to exit */
+  while ( rtems_task_is_suspended( task ) != RTEMS_INVALID_ID ) {
+    rtems_task_wake_after( 1 );
+  }
+
+  delete_queue( id );
+  print_result(
+    "cross-core",
+    variant,
+    rtems_counter_difference( b, a ),
+    CROSS_CORE_MESSAGE_COUNT
+  );
+}
+#endif
+
+static void Init( rtems_task_argument arg )
+{
+  size_t i;
+
+  TEST_BEGIN();
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( test_variants ); ++i ) {
+    test_uncontended( &test_variants[ i ] );
+  }
+
+#if defined(RTEMS_SMP)
+  if ( rtems_scheduler_get_processor_maximum() >= 2 ) {
+    set_affinity( RTEMS_SELF, 0 );
+
+    for ( i = 0; i < RTEMS_ARRAY_SIZE( test_variants ); ++i ) {
+      test_cross_core( &test_variants[ i ] );
+    }
+  }
+#endif
+
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 2
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
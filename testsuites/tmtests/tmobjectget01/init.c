@@ -0,0 +1,317 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/rtems/semimpl.h>
+#include <rtems/rtems/tasksimpl.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/threadimpl.h>
+
+const char rtems_test_name[] = "TMOBJECTGET 1";
+
+#define SAMPLE_COUNT 10000
+
+static rtems_id semaphore_id;
+
+static rtems_id task_id;
+
+static const char *test_sep = "";
+
+static void print_result(
+  const char *type,
+  rtems_counter_ticks ticks,
+  uint32_t count
+)
+{
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"samples\": %" PRIu32 ",\n"
+    "    \"ticks-per-sample\": %" PRIu64 ",\n"
+    "    \"ns-per-sample\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    count,
+    (uint64_t) ticks / count,
+    rtems_counter_ticks_to_nanoseconds( ticks ) / count
+  );
+  test_sep = ", ";
+}
+
+static void test_objects_get( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    ISR_lock_Context lock_context;
+    Objects_Control *the_object;
+
+    the_object = _Objects_Get(
+      semaphore_id,
+      &lock_context,
+      &_Semaphore_Information
+    );
+    rtems_test_assert( the_object != NULL );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "objects-get",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_semaphore_get_configured( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    ISR_lock_Context lock_context;
+    Objects_Control *the_object;
+
+    the_object = _Semaphore_Get_configured( semaphore_id, &lock_context );
+    rtems_test_assert( the_object != NULL );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "semaphore-get-configured",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_thread_get( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    ISR_lock_Context lock_context;
+    Thread_Control *the_thread;
+
+    the_thread = _Thread_Get( task_id, &lock_context );
+    rtems_test_assert( the_thread != NULL );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "thread-get",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_tasks_get_configured( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    ISR_lock_Context lock_context;
+    Objects_Control *the_object;
+
+    the_object = _RTEMS_tasks_Get_configured( task_id, &lock_context );
+    rtems_test_assert( the_object != NULL );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "tasks-get-configured",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_semaphore_invalid_id( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    /* Only the directive entry and the failed object lookup are measured */
+    sc = rtems_semaphore_release( 0 );
+    rtems_test_assert( sc == RTEMS_INVALID_ID );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "semaphore-release-invalid-id",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_semaphore_release_obtain( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_release( semaphore_id );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_semaphore_obtain( semaphore_id, RTEMS_NO_WAIT, 0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "semaphore-release-obtain",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void test_event_send_receive( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    /* Use the task identifier and not RTEMS_SELF to get the object lookup */
+    sc = rtems_event_send( task_id, RTEMS_EVENT_0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+      0,
+      &events
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "event-send-receive",
+    rtems_counter_difference( b, a ),
+    SAMPLE_COUNT
+  );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  task_id = rtems_task_self();
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', 'A' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &semaphore_id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+  test_objects_get();
+  test_semaphore_get_configured();
+  test_thread_get();
+  test_tasks_get_configured();
+  test_semaphore_invalid_id();
+  test_semaphore_release_obtain();
+  test_event_send_receive();
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  sc = rtems_semaphore_delete( semaphore_id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
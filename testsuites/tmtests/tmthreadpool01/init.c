@@ -0,0 +1,201 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMTHREADPOOL 1";
+
+#define REQUEST_COUNT 10000
+
+#define WORKER_PRIORITY 1
+
+static rtems_thread_pool pool;
+
+static rtems_thread_pool_work work;
+
+static uint32_t request_counter;
+
+static const char *test_sep = "";
+
+static void print_result(
+  const char *type,
+  rtems_counter_ticks ticks,
+  uint32_t count
+)
+{
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"requests\": %" PRIu32 ",\n"
+    "    \"ticks-per-request\": %" PRIu64 ",\n"
+    "    \"ns-per-request\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    count,
+    (uint64_t) ticks / count,
+    rtems_counter_ticks_to_nanoseconds( ticks ) / count
+  );
+  test_sep = ", ";
+}
+
+static void request_task( rtems_task_argument arg )
+{
+  (void) arg;
+
+  ++request_counter;
+  rtems_task_exit();
+}
+
+static void test_task_per_request( void )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  request_counter = 0;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    rtems_status_code sc;
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'R', 'E', 'Q', ' ' ),
+      WORKER_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    /* The request task preempts us and exits before the start returns */
+    sc = rtems_task_start( id, request_task, 0 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  rtems_test_assert( request_counter == REQUEST_COUNT );
+  print_result(
+    "task-per-request",
+    rtems_counter_difference( b, a ),
+    REQUEST_COUNT
+  );
+}
+
+static void request_handler( rtems_thread_pool_work *w )
+{
+  rtems_test_assert( w == &work );
+  ++request_counter;
+}
+
+static void test_thread_pool( void )
+{
+  rtems_thread_pool_config config = {
+    .name = rtems_build_name( 'P', 'O', 'O', 'L' ),
+    .worker_count = 1,
+    .initial_priority = WORKER_PRIORITY,
+    .stack_size = RTEMS_MINIMUM_STACK_SIZE,
+    .initial_modes = RTEMS_DEFAULT_MODES,
+    .attributes = RTEMS_DEFAULT_ATTRIBUTES
+  };
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  request_counter = 0;
+  rtems_thread_pool_work_initialize( &work, request_handler, NULL );
+
+  sc = rtems_thread_pool_create( &pool, &config );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    /* The idle worker preempts us and carries out the work item */
+    sc = rtems_thread_pool_submit( &pool, &work );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  rtems_test_assert( request_counter == REQUEST_COUNT );
+
+  sc = rtems_thread_pool_delete( &pool );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_thread_pool_submit( &pool, &work );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  print_result(
+    "thread-pool",
+    rtems_counter_difference( b, a ),
+    REQUEST_COUNT
+  );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+  test_task_per_request();
+  test_thread_pool();
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,264 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 embedded brains GmbH & Co. KG
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#if defined(TMTIMEOUT02)
+const char rtems_test_name[] = "TMTIMEOUT 2";
+#define WATCHDOG_IMPLEMENTATION "timing-wheel"
+#else
+const char rtems_test_name[] = "TMTIMEOUT 1";
+#define WATCHDOG_IMPLEMENTATION "red-black-tree"
+#endif
+
+#define MAXIMUM_BACKGROUND_TIMERS 4096
+
+#define ITERATION_COUNT 10000
+
+#define TIMEOUT 1000
+
+static const uint32_t background_timer_counts[] = { 0, 64, 512, 4096 };
+
+static rtems_id background_timers[ MAXIMUM_BACKGROUND_TIMERS ];
+
+static uint32_t active_background_timers;
+
+static rtems_id semaphore;
+
+static rtems_id releaser;
+
+static rtems_id timer;
+
+static const char *test_sep = "";
+
+static void background_timer_routine( rtems_id id, void *arg )
+{
+  rtems_test_assert( 0 );
+}
+
+static void timer_routine( rtems_id id, void *arg )
+{
+  rtems_test_assert( 0 );
+}
+
+static void set_background_timer_count( uint32_t count )
+{
+  while ( active_background_timers < count ) {
+    rtems_status_code sc;
+    rtems_interval ticks;
+
+    /* Spread the expiration times over the levels of a timing wheel */
+    ticks = 100000 + (rtems_interval) ( rand() % 10000000 );
+    sc = rtems_timer_fire_after(
+      background_timers[ active_background_timers ],
+      ticks,
+      background_timer_routine,
+      NULL
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    ++active_background_timers;
+  }
+}
+
+static void print_result(
+  const char *type,
+  uint32_t background_timer_count,
+  rtems_counter_ticks ticks
+)
+{
+  printf(
+    "%s{\n"
+    "    \"type\": \"%s\",\n"
+    "    \"watchdog\": \"%s\",\n"
+    "    \"background-timers\": %" PRIu32 ",\n"
+    "    \"ns-per-iteration\": %" PRIu64 "\n"
+    "  }",
+    test_sep,
+    type,
+    WATCHDOG_IMPLEMENTATION,
+    background_timer_count,
+    rtems_counter_ticks_to_nanoseconds( ticks ) / ITERATION_COUNT
+  );
+  test_sep = ", ";
+}
+
+static void releaser_task( rtems_task_argument arg )
+{
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_release( semaphore );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_semaphore_obtain_timeout( uint32_t background_timer_count )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  /*
+   * Each obtain blocks with a timeout, then the lower priority releaser task
+   * satisfies the request and the timeout is cancelled.
+   */
+  for ( i = 0; i < ITERATION_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_obtain( semaphore, RTEMS_WAIT, TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "semaphore-obtain-timeout",
+    background_timer_count,
+    rtems_counter_difference( b, a )
+  );
+}
+
+static void test_timer_fire_after_cancel( uint32_t background_timer_count )
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for ( i = 0; i < ITERATION_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_timer_fire_after( timer, TIMEOUT, timer_routine, NULL );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_timer_cancel( timer );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  b = rtems_counter_read();
+
+  print_result(
+    "timer-fire-after-cancel",
+    background_timer_count,
+    rtems_counter_difference( b, a )
+  );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+  size_t i;
+
+  TEST_BEGIN();
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', 'A' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &semaphore
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'E', 'L', 'S' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &releaser
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( releaser, releaser_task, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_timer_create( rtems_build_name( 'T', 'I', 'M', 'R' ), &timer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < MAXIMUM_BACKGROUND_TIMERS; ++i ) {
+    sc = rtems_timer_create(
+      rtems_build_name( 'B', 'G', 'N', 'D' ),
+      &background_timers[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  srand( 1 );
+
+  printf( "*** BEGIN OF JSON DATA ***\n[" );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( background_timer_counts ); ++i ) {
+    set_background_timer_count( background_timer_counts[ i ] );
+    test_semaphore_obtain_timeout( background_timer_counts[ i ] );
+    test_timer_fire_after_cancel( background_timer_counts[ i ] );
+  }
+
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS ( MAXIMUM_BACKGROUND_TIMERS + 1 )
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#if defined(TMTIMEOUT02)
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>